@@ -20,6 +20,7 @@
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/cbtCollisionDispatcherMt.h"
 #include "chrono/collision/bullet/LinearMath/cbtIDebugDraw.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 extern cbtScalar gContactBreakingThreshold;
 
@@ -149,6 +150,7 @@ void ChCollisionSystemBullet::Remove(ChCollisionModel* model) {
 }
 
 void ChCollisionSystemBullet::Run() {
+    CH_PROFILE_ZONE("CollisionBullet");
     if (bt_collision_world) {
         bt_collision_world->performDiscreteCollisionDetection();
     }
@@ -20,6 +20,7 @@
 #include "chrono/physics/ChSystem.h"
 #include "chrono/collision/ChCollisionSystemChrono.h"
 #include "chrono/collision/chrono/ChRayTest.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 namespace collision {
@@ -44,16 +45,34 @@ void ChCollisionSystemChrono::SetEnvelope(double envelope) {
 void ChCollisionSystemChrono::SetBroadphaseGridResolution(const ChVector<int>& num_bins) {
     broadphase.grid_resolution = vec3(num_bins.x(), num_bins.y(), num_bins.z());
     broadphase.grid_type = ChBroadphase::GridType::FIXED_RESOLUTION;
+    broadphase.grid_valid = false;
 }
 
 void ChCollisionSystemChrono::SetBroadphaseGridSize(const ChVector<>& bin_size) {
     broadphase.bin_size = real3(bin_size.x(), bin_size.y(), bin_size.z());
     broadphase.grid_type = ChBroadphase::GridType::FIXED_RESOLUTION;
+    broadphase.grid_valid = false;
 }
 
 void ChCollisionSystemChrono::SetBroadphaseGridDensity(double density) {
     broadphase.grid_density = real(density);
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
+    broadphase.grid_valid = false;
+}
+
+void ChCollisionSystemChrono::SetBroadphaseGridAdaptive(double initial_density) {
+    broadphase.grid_density = real(initial_density);
+    broadphase.grid_type = ChBroadphase::GridType::ADAPTIVE;
+    broadphase.grid_valid = false;
+    broadphase.adapt_scale = 0;
+    broadphase.adapt_step = 0;
+    broadphase.adapt_cost = -1;
+}
+
+void ChCollisionSystemChrono::EnableIncrementalBroadphase(bool val, double grid_margin) {
+    broadphase.incremental = val;
+    broadphase.grid_margin = real(grid_margin);
+    broadphase.grid_valid = false;
 }
 
 void ChCollisionSystemChrono::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
@@ -71,6 +90,7 @@ void ChCollisionSystemChrono::SetNumThreads(int nthreads) {
 #ifdef _OPENMP
     omp_set_num_threads(nthreads);
 #endif
+    narrowphase.num_threads = nthreads;
 }
 
 // -----------------------------------------------------------------------------
@@ -92,6 +112,11 @@ void ChCollisionSystemChrono::GetBoundingBox(ChVector<>& aabb_min, ChVector<>& a
     aabb_max.z() = cd_data->max_bounding_point.z;
 }
 
+ChVector<int> ChCollisionSystemChrono::GetBroadphaseGridResolution() const {
+    const vec3& bins = cd_data->bins_per_axis;
+    return ChVector<int>(bins.x, bins.y, bins.z);
+}
+
 double ChCollisionSystemChrono::GetTimerCollisionBroad() const {
     return m_timer_broad();
 }
@@ -106,6 +131,9 @@ void ChCollisionSystemChrono::Add(ChCollisionModel* model) {
     if (!model->GetPhysicsItem()->GetCollide())
         return;
 
+    // The set of shapes changes; the incremental broadphase must rebuild its grid
+    broadphase.grid_valid = false;
+
     ChCollisionModelChrono* pmodel = static_cast<ChCollisionModelChrono*>(model);
 
     int body_id = pmodel->GetBody()->GetId();
@@ -204,6 +232,8 @@ void ChCollisionSystemChrono::Add(ChCollisionModel* model) {
 #define ERASE_MACRO_LEN(x, y, z) x.erase(x.begin() + y, x.begin() + y + z);
 
 void ChCollisionSystemChrono::Remove(ChCollisionModel* model) {
+    broadphase.grid_valid = false;
+
     /*
     ChCollisionModelChrono* pmodel = static_cast<ChCollisionModelChrono*>(model);
     int body_id = pmodel->GetBody()->GetId();
@@ -297,6 +327,7 @@ void ChCollisionSystemChrono::Remove(ChCollisionModel* model) {
 void ChCollisionSystemChrono::ResetTimers() {
     m_timer_broad.reset();
     m_timer_narrow.reset();
+    broadphase.ResetTimers();
 }
 
 void ChCollisionSystemChrono::PreProcess() {
@@ -368,13 +399,19 @@ void ChCollisionSystemChrono::Run() {
 
     // Broadphase
     m_timer_broad.start();
-    GenerateAABB();
-    broadphase.Process();
+    {
+        CH_PROFILE_ZONE("Broadphase");
+        GenerateAABB();
+        broadphase.Process();
+    }
     m_timer_broad.stop();
 
     // Narrowphase
     m_timer_narrow.start();
-    narrowphase.Process();
+    {
+        CH_PROFILE_ZONE("Narrowphase");
+        narrowphase.Process();
+    }
     m_timer_narrow.stop();
 }
 
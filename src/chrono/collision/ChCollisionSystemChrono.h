@@ -67,6 +67,24 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Set an adaptive number of grid bins.
+    /// The grid resolution is initialized as with SetBroadphaseGridDensity for the specified density and then tuned
+    /// at each grid rebuild so as to minimize the broadphase cost, estimated from the measured number of bin-shape
+    /// intersections and of AABB-AABB tests in occupied bins. This is appropriate for scenes with a very non-uniform
+    /// distribution of collision shapes (e.g., a vehicle on a large terrain patch). The current resolution can be
+    /// queried with GetBroadphaseGridResolution.
+    void SetBroadphaseGridAdaptive(double initial_density = 5);
+
+    /// Enable/disable the incremental broadphase (default: false).
+    /// If enabled, the broadphase exploits temporal coherence: the grid is kept fixed for as long as all collision
+    /// shapes remain inside it and only shapes with a modified AABB (e.g., not belonging to fixed or sleeping bodies) are
+    /// re-binned and tested for overlap. Pairs of unmodified shapes are carried over from the previous step. To reduce
+    /// the number of grid rebuilds, the grid covers the bounding box of all shapes inflated on each side by the
+    /// specified fraction of its largest dimension. In this mode, the list of overlapping shape pairs is kept sorted, so
+    /// that the order of the contacts does not depend on when the grid is rebuilt. Not used if the system contains
+    /// fluid particles.
+    void EnableIncrementalBroadphase(bool val, double grid_margin = 0.1);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
@@ -93,6 +111,8 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     virtual void Remove(ChCollisionModel* model) override;
 
     /// Set the number of OpenMP threads for collision detection.
+    /// The rigid-rigid narrowphase uses exactly this number of threads and generates the contacts in the same order,
+    /// regardless of the number of threads.
     virtual void SetNumThreads(int nthreads) override;
 
     /// Synchronization operations, invoked before running the collision detection.
@@ -118,6 +138,31 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// Return the time (in seconds) for narrowphase collision detection.
     virtual double GetTimerCollisionNarrow() const override;
 
+    /// Return the time (in seconds) for the broadphase bounding box and grid setup.
+    /// This includes the detection of modified shapes when using the incremental broadphase.
+    /// Included in GetTimerCollisionBroad().
+    double GetTimerBroadphaseGrid() const { return broadphase.m_timer_grid(); }
+
+    /// Return the time (in seconds) for binning of shapes in the broadphase grid.
+    /// Included in GetTimerCollisionBroad().
+    double GetTimerBroadphaseBinning() const { return broadphase.m_timer_bin(); }
+
+    /// Return the time (in seconds) for generation of overlapping shape pairs in the broadphase.
+    /// Included in GetTimerCollisionBroad().
+    double GetTimerBroadphasePairs() const { return broadphase.m_timer_pairs(); }
+
+    /// Return the current number of broadphase grid bins in each direction.
+    ChVector<int> GetBroadphaseGridResolution() const;
+
+    /// Return the number of AABB-AABB tests in occupied bins at the last full broadphase pass (adaptive grid only).
+    double GetNumBroadphaseTests() const { return broadphase.num_aabb_tests; }
+
+    /// Return the number of shapes with modified AABB at the last broadphase (incremental broadphase only).
+    int GetNumBroadphaseMovedShapes() const { return (int)broadphase.num_moved; }
+
+    /// Return the number of grid rebuilds performed so far (incremental broadphase only).
+    int GetNumBroadphaseRebuilds() const { return broadphase.num_rebuilds; }
+
     /// Fill in the provided contact container with collision information after Run().
     virtual void ReportContacts(ChContactContainer* container) override;
 
@@ -13,7 +13,9 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cassert>
 #include <climits>
+#include <cmath>
 
 #include "chrono/collision/chrono/ChBroadphase.h"
 #include "chrono/collision/chrono/ChCollisionUtils.h"
@@ -39,6 +41,16 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      incremental(false),
+      grid_margin(0.1),
+      grid_valid(false),
+      num_moved(0),
+      num_rebuilds(0),
+      adapt_scale(0),
+      adapt_step(0),
+      adapt_cost(-1),
+      adapt_ref_cost(0),
+      num_aabb_tests(0),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -198,6 +210,20 @@ void ChBroadphase::ComputeTopLevelResolution() {
             break;
         case GridType::FIXED_DENSITY:
             bins_per_axis = Compute_Grid_Resolution(num_shapes, diag, grid_density);
+            break;
+        case GridType::ADAPTIVE: {
+            vec3 base = Compute_Grid_Resolution(num_shapes, diag, grid_density);
+            real factor = std::pow(real(2), adapt_scale);
+            // Limit the total number of bins (the broadphase uses arrays of size equal to the number of bins)
+            real max_bins = std::max(real(4096), real(64) * num_shapes);
+            real num_bins = (base.x * factor) * (base.y * factor) * (base.z * factor);
+            if (num_bins > max_bins)
+                factor *= std::cbrt(max_bins / num_bins);
+            bins_per_axis.x = std::max(1, (int)(base.x * factor));
+            bins_per_axis.y = std::max(1, (int)(base.y * factor));
+            bins_per_axis.z = std::max(1, (int)(base.z * factor));
+            break;
+        }
     }
 
     // Calculate actual bin dimension
@@ -209,22 +235,186 @@ void ChBroadphase::ComputeTopLevelResolution() {
 
 // -----------------------------------------------------------------------------
 
+void ChBroadphase::ResetTimers() {
+    m_timer_grid.reset();
+    m_timer_bin.reset();
+    m_timer_pairs.reset();
+}
+
+// Check if the box [amin, amax] is contained in the box [bmin, bmax].
+static inline bool Inside(const real3& amin, const real3& amax, const real3& bmin, const real3& bmax) {
+    return amin.x >= bmin.x && amin.y >= bmin.y && amin.z >= bmin.z &&  //
+           amax.x <= bmax.x && amax.y <= bmax.y && amax.z <= bmax.z;
+}
+
 // Use spatial subdivision to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
-    // Compute overall AABB and then offset all AABBs
+    // The incremental broadphase does not support fluid particles
+    bool use_incremental = incremental && cd_data->state_data.num_fluid_bodies == 0;
+
+    m_timer_grid.start();
+
+    // Compute overall AABB
     DetermineBoundingBox();
+
+    // In incremental mode, reuse the current grid if possible (grid not invalidated by adding or removing collision
+    // models, all AABBs inside the grid). Otherwise, set a new grid over an inflated bounding box.
+    bool rebuild = true;
+    if (use_incremental) {
+        rebuild = !grid_valid || !Inside(cd_data->min_bounding_point, cd_data->max_bounding_point, grid_min, grid_max);
+        assert(rebuild || prev_aabb_min.size() == cd_data->num_rigid_shapes);
+        if (rebuild) {
+            real3 size = cd_data->max_bounding_point - cd_data->min_bounding_point;
+            real margin = grid_margin * Max(size.x, Max(size.y, size.z));
+            grid_min = cd_data->min_bounding_point - margin;
+            grid_max = cd_data->max_bounding_point + margin;
+            num_rebuilds++;
+        }
+        cd_data->min_bounding_point = grid_min;
+        cd_data->max_bounding_point = grid_max;
+        cd_data->global_origin = grid_min;
+
+        FlagMovedShapes(rebuild);
+    }
+
+    // Offset all AABBs
     OffsetAABB();
 
     // Determine resolution of the top level grid
-    ComputeTopLevelResolution();
+    if (rebuild)
+        ComputeTopLevelResolution();
+
+    m_timer_grid.stop();
 
+    grid_valid = false;
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (rebuild) {
+            OneLevelBroadphase();
+            if (grid_type == GridType::ADAPTIVE)
+                AdaptResolution();
+        } else {
+            IncrementalBroadphase();
+        }
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
+        if (use_incremental) {
+            // In incremental mode, the list of shape pairs is kept sorted, so that its order (and hence the order of the
+            // contacts) does not depend on when the grid is rebuilt
+            std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+            pair_shapeIDs.resize(cd_data->num_possible_collisions);
+            if (rebuild) {
+                std::sort(pair_shapeIDs.begin(), pair_shapeIDs.end());
+                CacheBinRanges();
+            }
+            grid_valid = true;
+        }
     }
     return;
 }
 
+// Update the grid resolution scaling for GridType::ADAPTIVE, based on the last full broadphase pass.
+// The cost of a pass is estimated as the number of bin-shape intersections (binning and sorting) plus the number of
+// AABB-AABB tests in the active bins (pair generation). The scaling is adjusted with a line search: the search
+// continues in the same direction as long as the cost decreases and reverses with half the step otherwise. Once
+// converged, the search is restarted if the cost changes significantly (e.g., if the shape distribution changed).
+void ChBroadphase::AdaptResolution() {
+    const std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    const uint num_active_bins = cd_data->num_active_bins;
+
+    double num_tests = 0;
+#pragma omp parallel for reduction(+ : num_tests)
+    for (int i = 0; i < (signed)num_active_bins; i++) {
+        double n = bin_start_index[i + 1] - bin_start_index[i];
+        num_tests += n * (n - 1) / 2;
+    }
+    num_aabb_tests = num_tests;
+
+    real cost = real(cd_data->num_bin_aabb_intersections + num_tests);
+
+    const real max_scale = 4;       // maximum scaling of number of bins per axis: 2^4
+    const real initial_step = 0.5;  // initial search step (log2 scale)
+    const real min_step = 0.0625;   // search step at convergence
+
+    if (adapt_step == 0) {
+        if (adapt_cost >= 0 && cost < 2 * adapt_ref_cost && 2 * cost > adapt_ref_cost) {
+            adapt_cost = cost;
+            return;
+        }
+        // First call or significant change of cost: start a new search, refining the grid if pair tests dominate
+        adapt_step = (num_tests > cd_data->num_bin_aabb_intersections) ? initial_step : -initial_step;
+    } else if (cost > adapt_cost) {
+        // Cost increased: reverse search direction with half the step
+        adapt_step = -adapt_step / 2;
+        if (std::abs(adapt_step) < min_step) {
+            adapt_step = 0;
+            adapt_ref_cost = cost;
+        }
+    }
+
+    adapt_cost = cost;
+    adapt_scale = ChClamp(adapt_scale + adapt_step, -max_scale, max_scale);
+}
+
+// Flag shapes with a modified AABB or with a change in the active or collide state of their associated body.
+// Cache the current AABBs (in the global frame) and body flags.
+void ChBroadphase::FlagMovedShapes(bool rebuild) {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+    const std::vector<char>& active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& collide = *cd_data->state_data.collide_rigid;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    shape_moved.resize(num_shapes);
+
+    if (rebuild) {
+        prev_aabb_min = aabb_min;
+        prev_aabb_max = aabb_max;
+        prev_active = active;
+        prev_collide = collide;
+        std::fill(shape_moved.begin(), shape_moved.end(), 1);
+        num_moved = num_shapes;
+        return;
+    }
+
+    int count = 0;
+#pragma omp parallel for reduction(+ : count)
+    for (int i = 0; i < num_shapes; i++) {
+        uint b = id_rigid[i];
+        bool moved = !(aabb_min[i] == prev_aabb_min[i]) || !(aabb_max[i] == prev_aabb_max[i]);
+        if (b != UINT_MAX)
+            moved = moved || active[b] != prev_active[b] || collide[b] != prev_collide[b];
+        shape_moved[i] = moved;
+        if (moved) {
+            prev_aabb_min[i] = aabb_min[i];
+            prev_aabb_max[i] = aabb_max[i];
+            count++;
+        }
+    }
+    num_moved = count;
+
+    prev_active = active;
+    prev_collide = collide;
+}
+
+// Cache the bin ranges of all shapes (in the current grid).
+void ChBroadphase::CacheBinRanges() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    prev_bin_min.resize(num_shapes);
+    prev_bin_max.resize(num_shapes);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        prev_bin_min[i] = HashMin(aabb_min[i], inv_bin_size);
+        prev_bin_max[i] = HashMax(aabb_max[i], inv_bin_size);
+    }
+}
+
 void ChBroadphase::OneLevelBroadphase() {
     const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
     const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
@@ -254,6 +444,8 @@ void ChBroadphase::OneLevelBroadphase() {
 
     num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
 
+    m_timer_bin.start();
+
     bin_intersections.resize(num_shapes + 1);
     bin_intersections[num_shapes] = 0;
 
@@ -273,8 +465,6 @@ void ChBroadphase::OneLevelBroadphase() {
 
     bin_number.resize(num_bin_aabb_intersections);
     bin_aabb_number.resize(num_bin_aabb_intersections);
-    bin_active.resize(num_bin_aabb_intersections);       // will be resized after calculation of num_active_bins
-    bin_start_index.resize(num_bin_aabb_intersections);  // will be resized after calculation of num_active_bins
 
     // For each shape, store the bin index and the shape ID for intersections with this shape 
 #pragma omp parallel for
@@ -287,18 +477,14 @@ void ChBroadphase::OneLevelBroadphase() {
 
     // Find the number of active bins (i.e. with at least one shape AABB intersection)
     Thrust_Sort_By_Key(bin_number, bin_aabb_number);
-    num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
+    m_timer_bin.stop();
 
-    if (num_active_bins <= 0) {
+    if (!BuildActiveBins()) {
         num_possible_collisions = 0;
         return;
     }
 
-    bin_active.resize(num_active_bins);
-    bin_start_index.resize(num_active_bins + 1);
-    bin_start_index[num_active_bins] = 0;
-
-    Thrust_Exclusive_Scan(bin_start_index);
+    m_timer_pairs.start();
     bin_num_contact.resize(num_active_bins + 1);
     bin_num_contact[num_active_bins] = 0;
 
@@ -323,6 +509,37 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 
     pair_shapeIDs.resize(num_possible_collisions);
+    m_timer_pairs.stop();
+}
+
+// Find the active bins from the sorted list of bin - shape AABB intersections and set the start indices of each bin.
+// Return false if there are no active bins.
+bool ChBroadphase::BuildActiveBins() {
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+
+    const uint num_bins = cd_data->num_bins;
+    uint& num_active_bins = cd_data->num_active_bins;
+
+    m_timer_bin.start();
+
+    bin_active.resize(cd_data->num_bin_aabb_intersections);       // resized after calculation of num_active_bins
+    bin_start_index.resize(cd_data->num_bin_aabb_intersections);  // resized after calculation of num_active_bins
+
+    num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
+
+    if (num_active_bins <= 0) {
+        m_timer_bin.stop();
+        return false;
+    }
+
+    bin_active.resize(num_active_bins);
+    bin_start_index.resize(num_active_bins + 1);
+    bin_start_index[num_active_bins] = 0;
+
+    Thrust_Exclusive_Scan(bin_start_index);
 
     // For use in ray intersection tests, also create an "extended" vector of start indices that also includes bins with
     // no shape AABB intersections. 
@@ -342,6 +559,174 @@ void ChBroadphase::OneLevelBroadphase() {
     for (int j = bin_active[num_active_bins - 1] + 1; j <= (signed)num_bins; j++) {
         bin_start_index_ext[j] = bin_start_index[num_active_bins];
     }
+
+    m_timer_bin.stop();
+    return true;
+}
+
+// Update the broadphase results from the previous call, processing only the moved shapes.
+// The grid is assumed unchanged and the AABBs already offset.
+void ChBroadphase::IncrementalBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    uint& num_active_bins = cd_data->num_active_bins;
+    uint& num_bin_aabb_intersections = cd_data->num_bin_aabb_intersections;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    // Nothing to do if no shape moved
+    if (num_moved == 0)
+        return;
+
+    m_timer_bin.start();
+
+    // Find the moved shapes that intersect a different set of bins
+    shape_rebinned.resize(num_shapes);
+    int num_rebinned = 0;
+#pragma omp parallel for reduction(+ : num_rebinned)
+    for (int i = 0; i < num_shapes; i++) {
+        shape_rebinned[i] = 0;
+        if (!shape_moved[i] || obj_data_id[i] == UINT_MAX)
+            continue;
+        vec3 gmin = HashMin(aabb_min[i], inv_bin_size);
+        vec3 gmax = HashMax(aabb_max[i], inv_bin_size);
+        const vec3& pmin = prev_bin_min[i];
+        const vec3& pmax = prev_bin_max[i];
+        if (gmin.x != pmin.x || gmin.y != pmin.y || gmin.z != pmin.z ||  //
+            gmax.x != pmax.x || gmax.y != pmax.y || gmax.z != pmax.z) {
+            shape_rebinned[i] = 1;
+            prev_bin_min[i] = gmin;
+            prev_bin_max[i] = gmax;
+            num_rebinned++;
+        }
+    }
+
+    if (num_rebinned > 0) {
+        // New bin - shape AABB intersections for the re-binned shapes, sorted by bin index
+        new_entries.clear();
+        for (int i = 0; i < num_shapes; i++) {
+            if (!shape_rebinned[i])
+                continue;
+            const vec3& gmin = prev_bin_min[i];
+            const vec3& gmax = prev_bin_max[i];
+            for (int x = gmin.x; x <= gmax.x; x++)
+                for (int y = gmin.y; y <= gmax.y; y++)
+                    for (int z = gmin.z; z <= gmax.z; z++)
+                        new_entries.push_back(std::make_pair(Hash_Index(vec3(x, y, z), bins_per_axis), (uint)i));
+        }
+        std::sort(new_entries.begin(), new_entries.end());
+
+        // Merge the new intersections with the retained ones (all sorted by bin index, then by shape index, as after
+        // a full rebuild)
+        size_t num_old = bin_number.size();
+        size_t num_new = new_entries.size();
+        tmp_bin_number.resize(num_old + num_new);
+        tmp_bin_aabb_number.resize(num_old + num_new);
+        size_t i = 0, j = 0, k = 0;
+        while (i < num_old || j < num_new) {
+            if (i < num_old && shape_rebinned[bin_aabb_number[i]]) {
+                i++;
+            } else if (j == num_new ||
+                       (i < num_old && std::make_pair(bin_number[i], bin_aabb_number[i]) < new_entries[j])) {
+                tmp_bin_number[k] = bin_number[i];
+                tmp_bin_aabb_number[k] = bin_aabb_number[i];
+                i++;
+                k++;
+            } else {
+                tmp_bin_number[k] = new_entries[j].first;
+                tmp_bin_aabb_number[k] = new_entries[j].second;
+                j++;
+                k++;
+            }
+        }
+        tmp_bin_number.resize(k);
+        tmp_bin_aabb_number.resize(k);
+        bin_number.swap(tmp_bin_number);
+        bin_aabb_number.swap(tmp_bin_aabb_number);
+        num_bin_aabb_intersections = (uint)k;
+        m_timer_bin.stop();
+
+        if (!BuildActiveBins()) {
+            pair_shapeIDs.clear();
+            num_possible_collisions = 0;
+            return;
+        }
+    } else {
+        m_timer_bin.stop();
+    }
+
+    m_timer_pairs.start();
+
+    // Retain the pairs of shapes that did not move (in sorted order)
+    auto last = std::remove_if(pair_shapeIDs.begin(), pair_shapeIDs.end(), [this](long long p) {
+        return shape_moved[(uint)(p >> 32)] || shape_moved[(uint)(p & 0xffffffff)];
+    });
+    pair_shapeIDs.erase(last, pair_shapeIDs.end());
+
+    // Flag the active bins which contain moved shapes
+    bin_dirty.resize(num_active_bins);
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_active_bins; index++) {
+        bin_dirty[index] = 0;
+        for (uint i = bin_start_index[index]; i < bin_start_index[index + 1]; i++) {
+            if (shape_moved[bin_aabb_number[i]]) {
+                bin_dirty[index] = 1;
+                break;
+            }
+        }
+    }
+
+    // Count the AABB-AABB intersections involving moved shapes, in each dirty bin -> bin_num_contact
+    bin_num_contact.resize(num_active_bins + 1);
+    bin_num_contact[num_active_bins] = 0;
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_active_bins; i++) {
+        if (!bin_dirty[i]) {
+            bin_num_contact[i] = 0;
+            continue;
+        }
+        f_Count_AABB_AABB_Intersection(i, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_active,
+                                       bin_aabb_number, bin_start_index, fam_data, obj_active, obj_collide, obj_data_id,
+                                       bin_num_contact, &shape_moved);
+    }
+
+    thrust::exclusive_scan(bin_num_contact.begin(), bin_num_contact.end(), bin_num_contact.begin());
+    new_pairs.resize(bin_num_contact.back());
+
+    // Store the new shape pairs and append them to the retained ones
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_active_bins; index++) {
+        if (!bin_dirty[index])
+            continue;
+        f_Store_AABB_AABB_Intersection(index, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_active,
+                                       bin_aabb_number, bin_start_index, bin_num_contact, fam_data, obj_active,
+                                       obj_collide, obj_data_id, new_pairs, &shape_moved);
+    }
+
+    // Merge the new pairs with the retained ones (sorted)
+    std::sort(new_pairs.begin(), new_pairs.end());
+    size_t num_retained = pair_shapeIDs.size();
+    pair_shapeIDs.insert(pair_shapeIDs.end(), new_pairs.begin(), new_pairs.end());
+    std::inplace_merge(pair_shapeIDs.begin(), pair_shapeIDs.begin() + num_retained, pair_shapeIDs.end());
+    num_possible_collisions = (uint)pair_shapeIDs.size();
+
+    m_timer_pairs.stop();
 }
 
 }  // end namespace collision
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include "chrono/core/ChTimer.h"
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/chrono/ChCollisionData.h"
 
@@ -28,13 +30,18 @@ namespace collision {
 /// @{
 
 /// Class for performing broad-phase collision detection.
+/// In incremental mode, the grid is kept fixed (over slightly inflated extents) for as long as all shapes remain inside
+/// it. At each call, only shapes with a modified AABB (or whose body changed its active or collide state) are processed:
+/// shapes are re-binned only if their range of bins changed, pairs between unmodified shapes are carried over from the
+/// previous call, and new pairs are searched only in bins containing modified shapes.
 class ChApi ChBroadphase {
   public:
     /// Method for computing grid resolution
     enum class GridType {
         FIXED_RESOLUTION,  ///< user-specified number of bins in each direction
         FIXED_BIN_SIZE,    ///< user-specified grid bin dimension
-        FIXED_DENSITY      ///< user-specified density of shapes per bin
+        FIXED_DENSITY,     ///< user-specified density of shapes per bin
+        ADAPTIVE           ///< resolution tuned at each grid rebuild, based on measured bin occupancy
     };
 
     ChBroadphase();
@@ -43,11 +50,19 @@ class ChApi ChBroadphase {
     /// Collision detection results are loaded in the shared data object (see ChCollisionData).
     void Process();
 
+    /// Reset the timers for the broadphase stages.
+    void ResetTimers();
+
   private:
     void OneLevelBroadphase();
+    void IncrementalBroadphase();
+    bool BuildActiveBins();
+    void FlagMovedShapes(bool rebuild);
+    void CacheBinRanges();
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
+    void AdaptResolution();
     void RigidBoundingBox();
     void FluidBoundingBox();
 
@@ -56,7 +71,45 @@ class ChApi ChBroadphase {
     GridType grid_type;    ///< (input) method for setting grid resolution
     vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
-    real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
+    real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY and ADAPTIVE)
+
+    bool incremental;   ///< (input) enable incremental broadphase
+    real grid_margin;   ///< (input) relative inflation of the grid extents in incremental mode
+    bool grid_valid;    ///< current grid and bin data can be reused by the incremental broadphase
+    uint num_moved;     ///< number of shapes with modified AABB in last call
+    int num_rebuilds;   ///< number of full broadphase rebuilds in incremental mode
+
+    // Adaptive grid resolution (GridType::ADAPTIVE).
+    // The number of bins per axis is the one obtained with GridType::FIXED_DENSITY, scaled by 2^adapt_scale. After each
+    // full broadphase pass, adapt_scale is updated through a line search minimizing the measured broadphase cost.
+    real adapt_scale;       ///< log2 of the scaling of the number of bins per axis
+    real adapt_step;        ///< current search step for adapt_scale (0 if converged)
+    real adapt_cost;        ///< broadphase cost at the previous full pass (negative if none)
+    real adapt_ref_cost;    ///< broadphase cost at convergence of the search
+    double num_aabb_tests;  ///< number of AABB-AABB tests in the last full broadphase pass
+
+    // Data from the previous call, used by the incremental broadphase
+    std::vector<real3> prev_aabb_min;  ///< [num_rigid_shapes] AABB lower corners (global frame)
+    std::vector<real3> prev_aabb_max;  ///< [num_rigid_shapes] AABB upper corners (global frame)
+    std::vector<vec3> prev_bin_min;    ///< [num_rigid_shapes] lower corners of bin ranges
+    std::vector<vec3> prev_bin_max;    ///< [num_rigid_shapes] upper corners of bin ranges
+    std::vector<char> prev_active;     ///< [num_rigid_bodies] body active flags
+    std::vector<char> prev_collide;    ///< [num_rigid_bodies] body collide flags
+    real3 grid_min;                    ///< lower corner of the current grid
+    real3 grid_max;                    ///< upper corner of the current grid
+
+    // Work arrays for the incremental broadphase
+    std::vector<char> shape_moved;                   ///< [num_rigid_shapes] shapes with modified AABB
+    std::vector<char> shape_rebinned;                ///< [num_rigid_shapes] shapes with modified bin range
+    std::vector<char> bin_dirty;                     ///< [num_active_bins] bins containing moved shapes
+    std::vector<std::pair<uint, uint>> new_entries;  ///< new bin-shape intersections (bin index, shape ID)
+    std::vector<uint> tmp_bin_number;
+    std::vector<uint> tmp_bin_aabb_number;
+    std::vector<long long> new_pairs;
+
+    ChTimer<> m_timer_grid;   ///< timer for bounding box and grid setup (including detection of moved shapes)
+    ChTimer<> m_timer_bin;    ///< timer for shape binning
+    ChTimer<> m_timer_pairs;  ///< timer for generation of shape pairs
 
     friend class ChCollisionSystemChrono;
     friend class ChCollisionSystemChronoMulticore;
@@ -16,6 +16,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <climits>
 
 #include "chrono/collision/chrono/ChCollisionUtils.h"
@@ -97,7 +98,8 @@ void f_Count_AABB_AABB_Intersection(const uint index,
                                     const std::vector<char>& body_active,
                                     const std::vector<char>& body_collide,
                                     const std::vector<uint>& body_id,
-                                    std::vector<uint>& num_contact) {
+                                    std::vector<uint>& num_contact,
+                                    const std::vector<char>* shape_moved) {
     uint start = bin_start_index[index];
     uint end = bin_start_index[index + 1];
     uint count = 0;
@@ -134,6 +136,8 @@ void f_Count_AABB_AABB_Intersection(const uint index,
                 continue;
             if (!body_active[bodyA] && !body_active[bodyB])
                 continue;
+            if (shape_moved && !(*shape_moved)[shapeA] && !(*shape_moved)[shapeB])
+                continue;
             if (!collide(famA, fam_data[shapeB]))
                 continue;
             if (!overlap(Amin, Amax, Bmin, Bmax))
@@ -161,7 +165,8 @@ void f_Store_AABB_AABB_Intersection(const uint index,
                                     const std::vector<char>& body_active,
                                     const std::vector<char>& body_collide,
                                     const std::vector<uint>& body_id,
-                                    std::vector<long long>& potential_contacts) {
+                                    std::vector<long long>& potential_contacts,
+                                    const std::vector<char>* shape_moved) {
     uint start = bin_start_index[index];
     uint end = bin_start_index[index + 1];
     // Terminate early if there is only one object in the bin
@@ -199,6 +204,8 @@ void f_Store_AABB_AABB_Intersection(const uint index,
                 continue;
             if (!body_active[bodyA] && !body_active[bodyB])
                 continue;
+            if (shape_moved && !(*shape_moved)[shapeA] && !(*shape_moved)[shapeB])
+                continue;
             if (!collide(famA, fam_data[shapeB]))
                 continue;
             if (!overlap(Amin, Amax, Bmin, Bmax))
@@ -206,13 +213,11 @@ void f_Store_AABB_AABB_Intersection(const uint index,
             if (current_bin(Amin, Amax, Bmin, Bmax, inv_bin_size_vec, bins_per_axis, bin_number[index]) == false)
                 continue;
 
-            if (shapeB < shapeA) {
-                uint t = shapeA;
-                shapeA = shapeB;
-                shapeB = t;
-            }
-            // the two indices of the shapes that make up the contact
-            potential_contacts[offset + count] = ((long long)shapeA << 32 | (long long)shapeB);
+            // the two indices of the shapes that make up the contact (smaller index first; note that shapeA is
+            // still used in the next iterations, so it must not be modified)
+            uint shape1 = std::min(shapeA, shapeB);
+            uint shape2 = std::max(shapeA, shapeB);
+            potential_contacts[offset + count] = ((long long)shape1 << 32 | (long long)shape2);
             count++;
         }
     }
@@ -22,6 +22,7 @@
 #include "chrono/collision/chrono/ChCollisionUtils.h"
 
 #include "chrono/multicore_math/utility.h"
+#include "chrono/utils/ChOpenMP.h"
 
 // Always include ChConfig.h *before* any Thrust headers!
 #include "chrono/ChConfig.h"
@@ -41,6 +42,7 @@ ChNarrowphase::ChNarrowphase()
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
+      num_threads(0),
       cd_data(nullptr) {}
 
 void ChNarrowphase::ClearContacts() {
@@ -107,7 +109,7 @@ int ChNarrowphase::PreprocessCount() {
         // encoded shape IDs (per collision pair)
         const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
 
-#pragma omp parallel for
+#pragma omp parallel for num_threads(GetNumThreads())
         for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
             // Identify the two candidate shapes and get their types.
             vec2 pair = I2(int(pair_shapeIDs[index] >> 32), int(pair_shapeIDs[index] & 0xffffffff));
@@ -195,6 +197,10 @@ void ChNarrowphase::PreprocessLocalToParent() {
 
 // -----------------------------------------------------------------------------
 
+int ChNarrowphase::GetNumThreads() const {
+    return (num_threads > 0) ? num_threads : ChOMP::GetMaxThreads();
+}
+
 void ChNarrowphase::Dispatch_Init(uint index,
                                   uint& icoll,
                                   uint& ID_A,
@@ -244,7 +250,7 @@ void ChNarrowphase::DispatchMPR() {
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB) num_threads(GetNumThreads())
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
@@ -269,7 +275,7 @@ void ChNarrowphase::DispatchPRIMS() {
     ConvexShape shapeA;
     ConvexShape shapeB;
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB) num_threads(GetNumThreads())
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
@@ -297,7 +303,7 @@ void ChNarrowphase::DispatchHybridMPR() {
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB) num_threads(GetNumThreads())
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
@@ -130,6 +130,9 @@ class ChApi ChNarrowphase {
     void ProcessRigidRigid();
     void ProcessRigidFluid();
 
+    /// Return the number of threads for the rigid-rigid narrowphase.
+    int GetNumThreads() const;
+
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
@@ -143,6 +146,11 @@ class ChApi ChNarrowphase {
     std::vector<char> contact_fluid_active;
     std::vector<uint> contact_index;
 
+    /// Number of threads for rigid-rigid narrowphase (default: 0, use the current OpenMP setting).
+    /// Each candidate pair writes its contacts in preallocated slots (see PreprocessCount) which are then compacted in
+    /// order, so that the resulting contact order does not depend on the number of threads.
+    int num_threads;
+
     uint num_potential_rigid_contacts;
     uint num_potential_fluid_contacts;
     uint num_potential_rigid_fluid_contacts;
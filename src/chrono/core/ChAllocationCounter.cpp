@@ -0,0 +1,31 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <atomic>
+
+#include "chrono/core/ChAllocationCounter.h"
+
+namespace chrono {
+
+// Note: the counter is constant-initialized, so it can be safely incremented by allocations performed before the
+// dynamic initialization of this library.
+static std::atomic<unsigned long long> num_allocations(0);
+
+void ChAllocationCounter::Increment() {
+    num_allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+unsigned long long ChAllocationCounter::GetCount() {
+    return num_allocations.load(std::memory_order_relaxed);
+}
+
+}  // end namespace chrono
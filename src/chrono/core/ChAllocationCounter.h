@@ -0,0 +1,72 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_ALLOCATION_COUNTER_H
+#define CH_ALLOCATION_COUNTER_H
+
+#include <cstdlib>
+#include <new>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+/// Process-wide counter of dynamic memory allocations.
+/// The counter is incremented only by the counting allocation functions installed with
+/// CH_INSTALL_ALLOCATION_COUNTER(). If these are not installed, the count remains zero.
+/// ChSystem uses this counter to report the number of allocations performed during a time step (see
+/// ChSystem::GetNumAllocationsStep).
+class ChApi ChAllocationCounter {
+  public:
+    /// Increment the allocation count (thread safe).
+    static void Increment();
+
+    /// Return the total number of allocations recorded so far (thread safe).
+    static unsigned long long GetCount();
+};
+
+}  // end namespace chrono
+
+/// Install counting allocation functions.
+/// This macro must be placed at global scope in exactly one source file of the executable (typically the file
+/// containing main). On platforms using the GNU C library, malloc, calloc, and realloc are replaced (this also covers
+/// operator new and all Eigen dynamic matrices). On other platforms, only the global operator new is replaced.
+#if defined(__GLIBC__)
+extern "C" void* __libc_malloc(std::size_t size);
+extern "C" void* __libc_calloc(std::size_t num, std::size_t size);
+extern "C" void* __libc_realloc(void* ptr, std::size_t size);
+#define CH_INSTALL_ALLOCATION_COUNTER()                                \
+    extern "C" void* malloc(std::size_t size) noexcept {               \
+        chrono::ChAllocationCounter::Increment();                      \
+        return __libc_malloc(size);                                    \
+    }                                                                  \
+    extern "C" void* calloc(std::size_t num, std::size_t size) noexcept { \
+        chrono::ChAllocationCounter::Increment();                      \
+        return __libc_calloc(num, size);                               \
+    }                                                                  \
+    extern "C" void* realloc(void* ptr, std::size_t size) noexcept {   \
+        chrono::ChAllocationCounter::Increment();                      \
+        return __libc_realloc(ptr, size);                              \
+    }
+#else
+#define CH_INSTALL_ALLOCATION_COUNTER()                         \
+    void* operator new(std::size_t size) {                      \
+        chrono::ChAllocationCounter::Increment();               \
+        if (void* ptr = std::malloc(size ? size : 1))           \
+            return ptr;                                         \
+        throw std::bad_alloc();                                 \
+    }                                                           \
+    void operator delete(void* ptr) noexcept { std::free(ptr); } \
+    void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+#endif
+
+#endif
@@ -75,6 +75,36 @@ class ChApi ChElementBase {
     /// Corotational elements can take the local Kl & Rl matrices and rotate them.
     virtual void ComputeKRMmatricesGlobal(ChMatrixRef H, double Kfactor, double Rfactor = 0, double Mfactor = 0) = 0;
 
+    /// Return true if this element evaluates products with its K, R, M matrices without forming them (see
+    /// ComputeKRMmatricesProduct and ComputeKRMmatricesDiagonal). Only such elements use matrix-free K blocks.
+    virtual bool ProvidesKRMmatricesProduct() const { return false; }
+
+    /// Computes the product Hv = H * v of the matrix H = Kfactor * K + Rfactor * R + Mfactor * M (see
+    /// ComputeKRMmatricesGlobal) with a vector v, with n.rows = n.of dof of element.
+    /// This default implementation forms H in a temporary matrix. Elements can provide a matrix-free implementation
+    /// (see ProvidesKRMmatricesProduct).
+    virtual void ComputeKRMmatricesProduct(ChVectorRef Hv,
+                                           ChVectorConstRef v,
+                                           double Kfactor,
+                                           double Rfactor = 0,
+                                           double Mfactor = 0) {
+        ChMatrixDynamic<> H(v.size(), v.size());
+        H.setZero();
+        ComputeKRMmatricesGlobal(H, Kfactor, Rfactor, Mfactor);
+        Hv = H * v;
+    }
+
+    /// Computes the diagonal Hd of the matrix H = Kfactor * K + Rfactor * R + Mfactor * M (see
+    /// ComputeKRMmatricesGlobal), with n.rows = n.of dof of element.
+    /// This default implementation forms H in a temporary matrix. Elements can provide a matrix-free implementation
+    /// (see ProvidesKRMmatricesProduct).
+    virtual void ComputeKRMmatricesDiagonal(ChVectorRef Hd, double Kfactor, double Rfactor = 0, double Mfactor = 0) {
+        ChMatrixDynamic<> H(Hd.size(), Hd.size());
+        H.setZero();
+        ComputeKRMmatricesGlobal(H, Kfactor, Rfactor, Mfactor);
+        Hd = H.diagonal();
+    }
+
     /// Computes the internal forces (ex. the actual position of nodes is not in relaxed reference position) and set
     /// values in the Fi vector, with n.rows = n.of dof of element.
     virtual void ComputeInternalForces(ChVectorDynamic<>& Fi) = 0;
@@ -102,6 +132,14 @@ class ChApi ChElementBase {
     ///   R += forces * c
     virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {}
 
+    /// Adds the internal forces into a global vector R, multiplied by a scaling factor c (see above).
+    /// If 'atomic' is false, R is updated with plain (non-atomic) increments. This is only safe if no other thread
+    /// concurrently updates the entries of R corresponding to the nodes of this element (e.g., if elements are
+    /// processed in groups of elements with no shared nodes). The default implementation ignores 'atomic'.
+    virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c, bool atomic) {
+        EleIntLoadResidual_F(R, c);
+    }
+
     /// Adds the product of element mass M by a vector w (pasted at global nodes offsets) into
     /// a global vector R, multiplied by a scaling factor c, as
     ///   R += M * w * c
@@ -115,6 +153,16 @@ class ChApi ChElementBase {
     /// and not even the g vector, for instance if using lumped masses. 
     virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector<>& G_acc, const double c) = 0;
 
+    /// Adds the contribution of gravity loads, multiplied by a scaling factor c (see above).
+    /// If 'atomic' is false, R is updated with plain (non-atomic) increments (see EleIntLoadResidual_F).
+    /// The default implementation ignores 'atomic'.
+    virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R,
+                                              const ChVector<>& G_acc,
+                                              const double c,
+                                              bool atomic) {
+        EleIntLoadResidual_F_gravity(R, G_acc, c);
+    }
+
 
     //
     // Functions for interfacing to the solver
@@ -130,6 +178,18 @@ class ChApi ChElementBase {
     /// values Kfactor, Rfactor, Mfactor.
     virtual void KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) = 0;
 
+    /// Tell to a system descriptor that there are item(s) of type ChKblock in this object, which provide products with
+    /// the K, R, M matrices without storing them (see ChKblockMatrixFree).
+    /// The default implementation falls back to InjectKRMmatrices.
+    virtual void InjectKRMproducts(ChSystemDescriptor& mdescriptor) { InjectKRMmatrices(mdescriptor); }
+
+    /// Set the scaling values Kfactor, Rfactor, Mfactor of the K, R, M matrices in the matrix-free ChKblock item(s)
+    /// injected with InjectKRMproducts. No matrices are evaluated at this time.
+    /// The default implementation falls back to KRMmatricesLoad.
+    virtual void KRMproductsLoad(double Kfactor, double Rfactor, double Mfactor) {
+        KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+    }
+
     /// Adds the internal forces, expressed as nodal forces, into the
     /// encapsulated ChVariables, in the 'fb' part: qf+=forces*factor
     /// WILL BE DEPRECATED - see EleIntLoadResidual_F
@@ -0,0 +1,330 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batched evaluation of the generalized internal forces of groups of elements of
+// the same type.
+//
+// All per-element arrays are stored with the element (lane) index as the fastest
+// varying index, so that the innermost loops are fixed-size loops over the WIDTH
+// elements of a batch.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+
+#include "chrono/fea/ChElementBatch.h"
+#include "chrono/fea/ChElementBeamANCF_3333.h"
+#include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChElementShellANCF_3833.h"
+
+namespace chrono {
+namespace fea {
+
+const int ChElementBatch::WIDTH;
+
+namespace {
+
+const int W = ChElementBatch::WIDTH;
+
+// Calculate the deformation gradients at all quadrature points, FC[c][j][w] = sum_k SD[c][k][w] * ebar[k][j][w].
+// The first 3 columns (j) of ebar are the nodal coordinates; if NJ = 6, the last 3 columns are their time derivatives.
+template <int NSF, int NJ>
+void CalcDeformationGradients(int nc, const double* SD, const double* ebar, double* FC) {
+    for (int c = 0; c < nc; c++) {
+        const double* sd = SD + c * NSF * W;
+        double acc[NJ][W] = {};
+        for (int k = 0; k < NSF; k++) {
+            const double* eb = ebar + k * 6 * W;
+            for (int j = 0; j < NJ; j++)
+                for (int w = 0; w < W; w++)
+                    acc[j][w] += sd[k * W + w] * eb[j * W + w];
+        }
+        double* fc = FC + c * 6 * W;
+        for (int j = 0; j < NJ; j++)
+            for (int w = 0; w < W; w++)
+                fc[j * W + w] = acc[j][w];
+    }
+}
+
+}  // end namespace
+
+// -----------------------------------------------------------------------------
+
+template <class E>
+ChElementBatchANCF<E>::ChElementBatchANCF(const std::vector<std::shared_ptr<E>>& elements,
+                                          const std::vector<int>& indices) {
+    assert(!elements.empty() && elements.size() <= W);
+    assert(elements.size() == indices.size());
+
+    m_indices = indices;
+    m_nip = (int)elements[0]->m_SD.cols() / 3;
+    m_damping = elements[0]->m_damping_enabled;
+
+    // Unused lanes have zero shape function derivatives and quadrature weights and do not contribute any forces
+    int nc = 3 * m_nip;
+    m_SD.assign(nc * NSF * W, 0.0);
+    m_kGQ.assign(m_nip * W, 0.0);
+    m_alpha.assign(W, 0.0);
+    m_ebar.assign(NSF * 6 * W, 0.0);
+
+    for (int w = 0; w < (int)elements.size(); w++) {
+        auto& element = elements[w];
+        m_elements.push_back(element);
+        for (int c = 0; c < nc; c++)
+            for (int k = 0; k < NSF; k++)
+                m_SD[(c * NSF + k) * W + w] = element->m_SD(k, c);
+        m_alpha[w] = element->m_Alpha;
+        LoadElementData(*element, w);
+    }
+
+    m_Fi.resize(elements.size(), 3 * NSF);
+}
+
+template <class E>
+bool ChElementBatchANCF<E>::IsSupported(const E& element) {
+    return element.m_method == E::IntFrcMethod::ContInt && element.m_SD.rows() == NSF && element.m_SD.cols() > 0;
+}
+
+template <class E>
+void ChElementBatchANCF<E>::AddBatches(const std::vector<std::shared_ptr<ChElementBase>>& elements,
+                                       std::vector<std::shared_ptr<ChElementBatch>>& batches) {
+    // Group the supported elements by number of quadrature points and damping flag
+    std::map<std::pair<int, bool>, std::vector<int>> groups;
+    for (int ie = 0; ie < (int)elements.size(); ie++) {
+        auto element = std::dynamic_pointer_cast<E>(elements[ie]);
+        if (element && IsSupported(*element))
+            groups[std::make_pair((int)element->m_SD.cols(), element->m_damping_enabled)].push_back(ie);
+    }
+
+    // Split each group in batches of at most WIDTH elements
+    for (const auto& group : groups) {
+        const auto& indices = group.second;
+        for (size_t start = 0; start < indices.size(); start += W) {
+            size_t end = std::min(start + W, indices.size());
+            std::vector<int> batch_indices(indices.begin() + start, indices.begin() + end);
+            std::vector<std::shared_ptr<E>> batch_elements;
+            for (auto ie : batch_indices)
+                batch_elements.push_back(std::dynamic_pointer_cast<E>(elements[ie]));
+            batches.push_back(chrono_types::make_shared<ChElementBatchANCF<E>>(batch_elements, batch_indices));
+        }
+    }
+}
+
+template <class E>
+void ChElementBatchANCF<E>::SetStiffness(int set, int w, const ChMatrixNM<double, 6, 6>& D) {
+    size_t size = static_cast<size_t>(set + 1) * 36 * W;
+    if (m_D.size() < size)
+        m_D.resize(size, 0.0);
+    for (int i = 0; i < 6; i++)
+        for (int m = 0; m < 6; m++)
+            m_D[(set * 36 + 6 * i + m) * W + w] = D(i, m);
+}
+
+template <class E>
+void ChElementBatchANCF<E>::LoadCoordinates() {
+    for (int w = 0; w < GetNelements(); w++) {
+        auto element = static_cast<E*>(m_elements[w].get());
+        if (m_damping) {
+            typename E::MatrixNx6 ebar_ebardot;
+            element->CalcCombinedCoordMatrix(ebar_ebardot);
+            for (int k = 0; k < NSF; k++)
+                for (int j = 0; j < 6; j++)
+                    m_ebar[(k * 6 + j) * W + w] = ebar_ebardot(k, j);
+        } else {
+            typename E::Matrix3xN ebar;
+            element->CalcCoordMatrix(ebar);
+            for (int k = 0; k < NSF; k++)
+                for (int j = 0; j < 3; j++)
+                    m_ebar[(k * 6 + j) * W + w] = ebar(j, k);
+        }
+    }
+}
+
+template <class E>
+template <bool DAMPING>
+void ChElementBatchANCF<E>::ComputeStresses(const double* FC, double* P) const {
+    for (size_t s = 0; s < m_sets.size(); s++) {
+        const auto& set = m_sets[s];
+        const double* D = &m_D[s * 36 * W];
+
+        for (int g = 0; g < set.num; g++) {
+            // Rows of the deformation gradient blocks for this quadrature point.
+            // Note that the indices of the components are in transposed order (see the element implementations).
+            int r0 = 3 * set.offset + g;
+            int r1 = r0 + set.num;
+            int r2 = r1 + set.num;
+            const double* a = FC + r0 * 6 * W;
+            const double* b = FC + r1 * 6 * W;
+            const double* c = FC + r2 * 6 * W;
+            const double* kGQ = &m_kGQ[(set.offset + g) * W];
+            double* Pa = P + r0 * 3 * W;
+            double* Pb = P + r1 * 3 * W;
+            double* Pc = P + r2 * 3 * W;
+
+            for (int w = 0; w < W; w++) {
+                double a0 = a[w], a1 = a[W + w], a2 = a[2 * W + w];
+                double b0 = b[w], b1 = b[W + w], b2 = b[2 * W + w];
+                double c0 = c[w], c1 = c[W + w], c2 = c[2 * W + w];
+
+                // Green-Lagrange strains in Voigt notation (with engineering shear strains), plus the scaled strain
+                // rates for Kelvin-Voigt damping
+                double Eps[6];
+                Eps[0] = 0.5 * (a0 * a0 + a1 * a1 + a2 * a2 - 1);
+                Eps[1] = 0.5 * (b0 * b0 + b1 * b1 + b2 * b2 - 1);
+                Eps[2] = 0.5 * (c0 * c0 + c1 * c1 + c2 * c2 - 1);
+                Eps[3] = b0 * c0 + b1 * c1 + b2 * c2;
+                Eps[4] = a0 * c0 + a1 * c1 + a2 * c2;
+                Eps[5] = a0 * b0 + a1 * b1 + a2 * b2;
+                if (DAMPING) {
+                    double ad0 = a[3 * W + w], ad1 = a[4 * W + w], ad2 = a[5 * W + w];
+                    double bd0 = b[3 * W + w], bd1 = b[4 * W + w], bd2 = b[5 * W + w];
+                    double cd0 = c[3 * W + w], cd1 = c[4 * W + w], cd2 = c[5 * W + w];
+                    double alpha = m_alpha[w];
+                    Eps[0] += alpha * (a0 * ad0 + a1 * ad1 + a2 * ad2);
+                    Eps[1] += alpha * (b0 * bd0 + b1 * bd1 + b2 * bd2);
+                    Eps[2] += alpha * (c0 * cd0 + c1 * cd1 + c2 * cd2);
+                    Eps[3] += alpha * (b0 * cd0 + b1 * cd1 + b2 * cd2 + c0 * bd0 + c1 * bd1 + c2 * bd2);
+                    Eps[4] += alpha * (a0 * cd0 + a1 * cd1 + a2 * cd2 + c0 * ad0 + c1 * ad1 + c2 * ad2);
+                    Eps[5] += alpha * (a0 * bd0 + a1 * bd1 + a2 * bd2 + b0 * ad0 + b1 * ad1 + b2 * ad2);
+                }
+                for (int i = 0; i < 6; i++)
+                    Eps[i] *= kGQ[w];
+
+                // Scaled second Piola-Kirchhoff stresses
+                double S[6];
+                for (int i = 0; i < 6; i++) {
+                    S[i] = 0;
+                    for (int m = 0; m < 6; m++)
+                        S[i] += D[(6 * i + m) * W + w] * Eps[m];
+                }
+
+                // Scaled first Piola-Kirchhoff stresses (transposed)
+                Pa[w] = a0 * S[0] + b0 * S[5] + c0 * S[4];
+                Pa[W + w] = a1 * S[0] + b1 * S[5] + c1 * S[4];
+                Pa[2 * W + w] = a2 * S[0] + b2 * S[5] + c2 * S[4];
+                Pb[w] = a0 * S[5] + b0 * S[1] + c0 * S[3];
+                Pb[W + w] = a1 * S[5] + b1 * S[1] + c1 * S[3];
+                Pb[2 * W + w] = a2 * S[5] + b2 * S[1] + c2 * S[3];
+                Pc[w] = a0 * S[4] + b0 * S[3] + c0 * S[2];
+                Pc[W + w] = a1 * S[4] + b1 * S[3] + c1 * S[2];
+                Pc[2 * W + w] = a2 * S[4] + b2 * S[3] + c2 * S[2];
+            }
+        }
+    }
+}
+
+template <class E>
+void ChElementBatchANCF<E>::ComputeInternalForces() {
+    int nc = 3 * m_nip;
+
+    LoadCoordinates();
+
+    // Scratch space for the deformation gradients and stresses at all quadrature points.
+    // Thread-local, as different batches may be evaluated concurrently.
+    static thread_local std::vector<double> FC;
+    static thread_local std::vector<double> P;
+    FC.resize(nc * 6 * W);
+    P.resize(nc * 3 * W);
+
+    if (m_damping) {
+        CalcDeformationGradients<NSF, 6>(nc, m_SD.data(), m_ebar.data(), FC.data());
+        ComputeStresses<true>(FC.data(), P.data());
+    } else {
+        CalcDeformationGradients<NSF, 3>(nc, m_SD.data(), m_ebar.data(), FC.data());
+        ComputeStresses<false>(FC.data(), P.data());
+    }
+
+    // Generalized internal forces in compact form, Q[k][j][w] = sum_c SD[c][k][w] * P[c][j][w]
+    double Q[NSF][3][W] = {};
+    for (int c = 0; c < nc; c++) {
+        const double* sd = &m_SD[c * NSF * W];
+        const double* p = &P[c * 3 * W];
+        for (int k = 0; k < NSF; k++)
+            for (int j = 0; j < 3; j++)
+                for (int w = 0; w < W; w++)
+                    Q[k][j][w] += sd[k * W + w] * p[j * W + w];
+    }
+
+    // Reshape into the element internal force vectors (stacking the rows of the compact form)
+    for (int w = 0; w < GetNelements(); w++)
+        for (int k = 0; k < NSF; k++)
+            for (int j = 0; j < 3; j++)
+                m_Fi(w, 3 * k + j) = Q[k][j][w];
+}
+
+// -----------------------------------------------------------------------------
+// Element-specific quadrature point sets and stiffness matrices
+
+template <>
+void ChElementBatchANCF<ChElementHexaANCF_3843>::LoadElementData(ChElementHexaANCF_3843& element, int w) {
+    m_sets = {{0, m_nip}};
+    SetStiffness(0, w, element.GetMaterial()->Get_D());
+    for (int g = 0; g < m_nip; g++)
+        m_kGQ[g * W + w] = element.m_kGQ(g, 0);
+}
+
+template <>
+void ChElementBatchANCF<ChElementShellANCF_3833>::LoadElementData(ChElementShellANCF_3833& element, int w) {
+    // One set of quadrature points for each layer, with the layer stiffness matrix rotated by the fiber angle
+    const int NIP = ChElementShellANCF_3833::NIP;
+    m_sets.clear();
+    for (int kl = 0; kl < element.m_numLayers; kl++) {
+        m_sets.push_back({kl * NIP, NIP});
+        ChMatrixNM<double, 6, 6> D = element.m_layers[kl].GetMaterial()->Get_E_eps();
+        element.RotateReorderStiffnessMatrix(D, element.m_layers[kl].Get_theta());
+        SetStiffness(kl, w, D);
+    }
+    for (int g = 0; g < m_nip; g++)
+        m_kGQ[g * W + w] = element.m_kGQ(g, 0);
+}
+
+template <>
+void ChElementBatchANCF<ChElementBeamANCF_3333>::LoadElementData(ChElementBeamANCF_3333& element, int w) {
+    // Quadrature points excluding the Poisson effect (diagonal stiffness matrix), followed by the quadrature points
+    // for the Poisson effect (normal strain terms only)
+    const int NIP_D0 = ChElementBeamANCF_3333::NIP_D0;
+    const int NIP_Dv = ChElementBeamANCF_3333::NIP_Dv;
+    m_sets = {{0, NIP_D0}, {NIP_D0, NIP_Dv}};
+
+    ChMatrixNM<double, 6, 6> D;
+    D.setZero();
+    D.diagonal() = element.GetMaterial()->Get_D0();
+    SetStiffness(0, w, D);
+    D.setZero();
+    D.block<3, 3>(0, 0) = element.GetMaterial()->Get_Dv();
+    SetStiffness(1, w, D);
+
+    for (int g = 0; g < NIP_D0; g++)
+        m_kGQ[g * W + w] = element.m_kGQ_D0(g, 0);
+    for (int g = 0; g < NIP_Dv; g++)
+        m_kGQ[(NIP_D0 + g) * W + w] = element.m_kGQ_Dv(g, 0);
+}
+
+template class ChElementBatchANCF<ChElementHexaANCF_3843>;
+template class ChElementBatchANCF<ChElementShellANCF_3833>;
+template class ChElementBatchANCF<ChElementBeamANCF_3333>;
+
+// -----------------------------------------------------------------------------
+
+std::vector<std::shared_ptr<ChElementBatch>> ChElementBatch::CreateBatches(
+    const std::vector<std::shared_ptr<ChElementBase>>& elements) {
+    std::vector<std::shared_ptr<ChElementBatch>> batches;
+    ChElementBatchANCF<ChElementHexaANCF_3843>::AddBatches(elements, batches);
+    ChElementBatchANCF<ChElementShellANCF_3833>::AddBatches(elements, batches);
+    ChElementBatchANCF<ChElementBeamANCF_3333>::AddBatches(elements, batches);
+    return batches;
+}
+
+}  // end namespace fea
+}  // end namespace chrono
@@ -0,0 +1,134 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batched evaluation of the generalized internal forces of groups of elements of
+// the same type.
+//
+// =============================================================================
+
+#ifndef CHELEMENTBATCH_H
+#define CHELEMENTBATCH_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/fea/ChElementGeneric.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_elements
+/// @{
+
+/// Base class for the batched evaluation of the generalized internal forces of a group of elements of the same type.
+/// A batch holds up to WIDTH elements, which are evaluated together: the element data is stored in a structure-of-arrays
+/// layout (one SIMD lane per element), such that the loops over the element shape functions and quadrature points have
+/// fixed-size, vectorizable inner loops over the elements of the batch.
+/// The element data is loaded when the batch is created; batches must be recreated if the element setup changes (e.g.,
+/// new material, damping, or internal force calculation method).
+class ChApi ChElementBatch {
+  public:
+    /// Maximum number of elements in a batch.
+    static const int WIDTH = 4;
+
+    virtual ~ChElementBatch() {}
+
+    /// Get the number of elements in this batch.
+    int GetNelements() const { return (int)m_elements.size(); }
+
+    /// Get the i-th element in this batch.
+    std::shared_ptr<ChElementGeneric> GetElement(int i) const { return m_elements[i]; }
+
+    /// Get the index of the i-th element in this batch, in the list of elements used to create the batches.
+    int GetElementIndex(int i) const { return m_indices[i]; }
+
+    /// Compute the generalized internal forces of all elements in this batch.
+    virtual void ComputeInternalForces() = 0;
+
+    /// Add the internal forces of the i-th element in this batch (as calculated by the last call to
+    /// ComputeInternalForces), multiplied by a scaling factor c, into the global vector R.
+    /// R is updated with atomic increments only if 'atomic' is true (see ChElementBase::EleIntLoadResidual_F).
+    void LoadResidual_F(int i, ChVectorDynamic<>& R, const double c, bool atomic) {
+        m_elements[i]->LoadNodalVector(R, m_Fi.row(i).transpose(), c, atomic);
+    }
+
+    /// Group the specified elements in batches.
+    /// Currently, batched evaluation is supported for the ChElementHexaANCF_3843, ChElementShellANCF_3833, and
+    /// ChElementBeamANCF_3333 elements using the "Continuous Integration" style internal force calculation method.
+    /// Elements of other types, or that were not yet initialized, are not included in any batch.
+    static std::vector<std::shared_ptr<ChElementBatch>> CreateBatches(
+        const std::vector<std::shared_ptr<ChElementBase>>& elements);
+
+  protected:
+    std::vector<std::shared_ptr<ChElementGeneric>> m_elements;  ///< elements in this batch
+    std::vector<int> m_indices;                                 ///< element indices in the original element list
+    ChMatrixDynamic<> m_Fi;                                     ///< element internal forces (one row per element)
+};
+
+/// Batch of ANCF elements of type E, evaluated with the "Continuous Integration" style method.
+/// The element quadrature points are partitioned in sets with the same material stiffness matrix (e.g., the layers of a
+/// shell element). All elements in the batch must have the same number of quadrature points and the same damping flag.
+template <class E>
+class ChElementBatchANCF : public ChElementBatch {
+  public:
+    static const int NSF = E::NSF;  ///< number of shape functions
+
+    /// Create a batch with the specified elements (at most WIDTH), with given indices in the original element list.
+    ChElementBatchANCF(const std::vector<std::shared_ptr<E>>& elements, const std::vector<int>& indices);
+
+    /// Group all elements of type E in the specified list in batches and append these to the given batch list.
+    static void AddBatches(const std::vector<std::shared_ptr<ChElementBase>>& elements,
+                           std::vector<std::shared_ptr<ChElementBatch>>& batches);
+
+    /// Compute the generalized internal forces of all elements in this batch.
+    virtual void ComputeInternalForces() override;
+
+  private:
+    /// Set of quadrature points sharing the same stiffness matrix.
+    struct PointSet {
+        int offset;  ///< index of the first quadrature point in the set
+        int num;     ///< number of quadrature points in the set
+    };
+
+    /// Return true if the specified element can be evaluated in a batch.
+    static bool IsSupported(const E& element);
+
+    /// Load the quadrature point sets, stiffness matrices, and quadrature scale factors of the element in lane w.
+    void LoadElementData(E& element, int w);
+
+    /// Set the stiffness matrix of the specified quadrature point set, in lane w.
+    void SetStiffness(int set, int w, const ChMatrixNM<double, 6, 6>& D);
+
+    /// Load the current nodal coordinates (and, if needed, their time derivatives) of all elements.
+    void LoadCoordinates();
+
+    /// Calculate the scaled first Piola-Kirchhoff stresses P from the deformation gradients FC (and their time
+    /// derivatives) at all quadrature points.
+    template <bool DAMPING>
+    void ComputeStresses(const double* FC, double* P) const;
+
+    int m_nip;                      ///< number of quadrature points per element
+    bool m_damping;                 ///< internal damping enabled
+    std::vector<PointSet> m_sets;   ///< quadrature point sets
+    std::vector<double> m_SD;       ///< shape function derivatives, [3 * nip][NSF][WIDTH]
+    std::vector<double> m_kGQ;      ///< quadrature weight and Jacobian scale factors, [nip][WIDTH]
+    std::vector<double> m_D;        ///< stiffness matrices, [set][6 x 6][WIDTH]
+    std::vector<double> m_alpha;    ///< structural damping coefficients, [WIDTH]
+    std::vector<double> m_ebar;     ///< nodal coordinates and their time derivatives, [NSF][6][WIDTH]
+};
+
+/// @} fea_elements
+
+}  // end of namespace fea
+}  // end of namespace chrono
+
+#endif
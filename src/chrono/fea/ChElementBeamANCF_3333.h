@@ -39,6 +39,7 @@
 #include "chrono/fea/ChMaterialBeamANCF.h"
 #include "chrono/core/ChQuadrature.h"
 #include "chrono/fea/ChElementBeam.h"
+#include "chrono/fea/ChElementBatch.h"
 #include "chrono/fea/ChNodeFEAxyzDD.h"
 
 namespace chrono {
@@ -451,6 +452,9 @@ class ChApi ChElementBeamANCF_3333 : public ChElementBeam, public ChLoadableU, p
 
   public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    template <class E>
+    friend class ChElementBatchANCF;
 };
 
 /// @} fea_elements
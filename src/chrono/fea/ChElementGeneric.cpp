@@ -19,29 +19,36 @@
 namespace chrono {
 namespace fea {
 
-void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {
-    ChVectorDynamic<> mFi(this->GetNdofs());
-    this->ComputeInternalForces(mFi);
-    // GetLog() << "EleIntLoadResidual_F , mFi=" << mFi << "  c=" << c << "\n";
-    mFi *= c;
-
-    //// RADU
-    //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
-
+// This is called from within parallel OMP loops; unless the caller guarantees that no other thread writes to the
+// entries of R for the nodes of this element, atomic increments must be used.
+void ChElementGeneric::LoadNodalVector(ChVectorDynamic<>& R, ChVectorConstRef F, const double c, bool atomic) {
     int stride = 0;
-    for (int in = 0; in < this->GetNnodes(); in++) {
+    for (int in = 0; in < GetNnodes(); in++) {
         int nodedofs = GetNodeNdofs(in);
-        // GetLog() << "  in=" << in << "  stride=" << stride << "  nodedofs=" << nodedofs << " offset=" <<
-        // GetNodeN(in)->NodeGetOffset_w() << "\n";
-        if (!GetNodeN(in)->GetFixed()) {
-            for (int j = 0; j < nodedofs; j++)
+        auto node = GetNodeN(in);
+        if (!node->GetFixed()) {
+            int offset = node->NodeGetOffset_w();
+            if (atomic) {
+                for (int j = 0; j < nodedofs; j++)
 #pragma omp atomic
-                R(GetNodeN(in)->NodeGetOffset_w() + j) += mFi(stride + j);
+                    R(offset + j) += c * F(stride + j);
+            } else {
+                R.segment(offset, nodedofs) += c * F.segment(stride, nodedofs);
+            }
         }
         stride += nodedofs;
     }
-    // GetLog() << "EleIntLoadResidual_F , R=" << R << "\n";
+}
+
+void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {
+    EleIntLoadResidual_F(R, c, true);
+}
+
+void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c, bool atomic) {
+    ChVectorDynamic<> mFi(this->GetNdofs());
+    this->ComputeInternalForces(mFi);
+
+    LoadNodalVector(R, mFi, c, atomic);
 }
 
 void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) {
@@ -77,24 +84,17 @@ void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVecto
 
 
 void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector<>& G_acc, const double c) {
-    
+    EleIntLoadResidual_F_gravity(R, G_acc, c, true);
+}
+
+void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R,
+                                                    const ChVector<>& G_acc,
+                                                    const double c,
+                                                    bool atomic) {
     ChVectorDynamic<> mFg(this->GetNdofs());
     this->ComputeGravityForces(mFg, G_acc);
-    mFg *= c;
-
-
-    int stride = 0;
-    for (int in = 0; in < this->GetNnodes(); in++) {
-        int nodedofs = GetNodeNdofs(in);
-        if (!GetNodeN(in)->GetFixed()) {
-            for (int j = 0; j < nodedofs; j++)
-                //// ATOMIC as called from an OMP parallel loop: this is here to avoid race conditions when writing to R
-                #pragma omp atomic  
-                R(GetNodeN(in)->NodeGetOffset_w() + j) += mFg(stride + j);
-        }
-        stride += nodedofs;
-    }
 
+    LoadNodalVector(R, mFg, c, atomic);
 }
 
 /*
@@ -150,6 +150,43 @@ void ChElementGeneric::ComputeGravityForces(ChVectorDynamic<>& Fg, const ChVecto
 }
 
 
+void ChElementGeneric::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
+    // Restore the K block storage, if it was released when switching to matrix-free products
+    if (Kmatr.GetNvars() == 0 && Kprod.GetNvars() > 0)
+        Kmatr.SetVariables(Kprod.GetVariables());
+
+    mdescriptor.InsertKblock(&Kmatr);
+}
+
+void ChElementGeneric::InjectKRMproducts(ChSystemDescriptor& mdescriptor) {
+    // Without analytic products, a matrix-free K block would form the element Jacobian at each product
+    if (!ProvidesKRMmatricesProduct()) {
+        InjectKRMmatrices(mdescriptor);
+        return;
+    }
+
+    // Take over the element variables and release the K block storage
+    if (Kmatr.GetNvars() > 0) {
+        std::vector<ChVariables*> mvars(Kmatr.GetNvars());
+        for (unsigned int iv = 0; iv < Kmatr.GetNvars(); iv++)
+            mvars[iv] = Kmatr.GetVariableN(iv);
+        Kprod.SetVariables(mvars);
+        Kmatr = ChKblockGeneric();
+    }
+
+    Kprod.SetElement(this);
+    mdescriptor.InsertKblock(&Kprod);
+}
+
+void ChElementGeneric::KRMproductsLoad(double Kfactor, double Rfactor, double Mfactor) {
+    if (!ProvidesKRMmatricesProduct()) {
+        KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+        return;
+    }
+
+    Kprod.SetFactors(Kfactor, Rfactor, Mfactor);
+}
+
 void ChElementGeneric::VariablesFbLoadInternalForces(double factor) {
     throw(ChException("ChElementGeneric::VariablesFbLoadInternalForces is deprecated"));
 }
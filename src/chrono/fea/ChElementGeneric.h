@@ -16,6 +16,7 @@
 #define CHELEMENTGENERIC_H
 
 #include "chrono/solver/ChKblockGeneric.h"
+#include "chrono/solver/ChKblockMatrixFree.h"
 #include "chrono/solver/ChVariablesNode.h"
 #include "chrono/fea/ChElementBase.h"
 
@@ -35,7 +36,55 @@ namespace fea {
 /// and optionally ComputeGravityForces().
 class ChApi ChElementGeneric : public ChElementBase {
   protected:
+    /// Matrix-free proxy to the element K, R, M matrices, with products evaluated on the fly by the element.
+    class KblockProduct : public ChKblockMatrixFree {
+      public:
+        KblockProduct() : m_element(nullptr), m_Kfactor(0), m_Rfactor(0), m_Mfactor(0) {}
+
+        void SetElement(ChElementGeneric* element) { m_element = element; }
+
+        void SetFactors(double Kfactor, double Rfactor, double Mfactor) {
+            m_Kfactor = Kfactor;
+            m_Rfactor = Rfactor;
+            m_Mfactor = Mfactor;
+        }
+
+      private:
+        virtual void ComputeProduct(ChVectorRef Hv, ChVectorConstRef v) const override {
+            m_element->ComputeLoadedKRMmatricesProduct(Hv, v, m_Kfactor, m_Rfactor, m_Mfactor);
+        }
+        virtual void ComputeDiagonal(ChVectorRef Hd) const override {
+            m_element->ComputeLoadedKRMmatricesDiagonal(Hd, m_Kfactor, m_Rfactor, m_Mfactor);
+        }
+        virtual void ComputeMatrix(ChMatrixRef H) const override {
+            m_element->ComputeKRMmatricesGlobal(H, m_Kfactor, m_Rfactor, m_Mfactor);
+        }
+
+        ChElementGeneric* m_element;
+        double m_Kfactor;
+        double m_Rfactor;
+        double m_Mfactor;
+    };
+
     ChKblockGeneric Kmatr;
+    KblockProduct Kprod;
+
+    /// Evaluate the product with the element Jacobian loaded with KRMproductsLoad (used by the matrix-free K block).
+    /// The default implementation evaluates the product at the current element state. Elements can override this to
+    /// reuse data computed once in KRMproductsLoad.
+    virtual void ComputeLoadedKRMmatricesProduct(ChVectorRef Hv,
+                                                 ChVectorConstRef v,
+                                                 double Kfactor,
+                                                 double Rfactor,
+                                                 double Mfactor) {
+        ComputeKRMmatricesProduct(Hv, v, Kfactor, Rfactor, Mfactor);
+    }
+
+    /// Evaluate the diagonal of the element Jacobian loaded with KRMproductsLoad (used by the matrix-free K block).
+    /// The default implementation evaluates the diagonal at the current element state.
+    virtual void ComputeLoadedKRMmatricesDiagonal(ChVectorRef Hd, double Kfactor, double Rfactor, double Mfactor) {
+        ComputeKRMmatricesDiagonal(Hd, Kfactor, Rfactor, Mfactor);
+    }
 
   public:
     ChElementGeneric() {}
@@ -54,6 +103,9 @@ class ChApi ChElementGeneric : public ChElementBase {
     /// implementing this EleIntLoadResidual_F function, unless you need faster code)
     virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) override;
 
+    /// Same as above, with atomic updates of R only if 'atomic' is true.
+    virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c, bool atomic) override;
+
     /// (This is a default (VERY UNOPTIMAL) book keeping so that in children classes you can avoid
     /// implementing this EleIntLoadResidual_Mv function, unless you need faster code.)
     virtual void EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) override;
@@ -64,6 +116,17 @@ class ChApi ChElementGeneric : public ChElementBase {
     /// only if they are inherited by ChLoadableUVW so it can use GetDensity() and Gauss quadrature.
     virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector<>& G_acc, const double c) override;
 
+    /// Same as above, with atomic updates of R only if 'atomic' is true.
+    virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R,
+                                              const ChVector<>& G_acc,
+                                              const double c,
+                                              bool atomic) override;
+
+    /// Add a vector F of generalized element forces (ordered as the element nodes), multiplied by a scaling factor c,
+    /// into the global vector R at the offsets of the element nodes, skipping fixed nodes.
+    /// R is updated with atomic increments only if 'atomic' is true (see EleIntLoadResidual_F).
+    void LoadNodalVector(ChVectorDynamic<>& R, ChVectorConstRef F, const double c, bool atomic);
+
 
     //
     // FEM functions
@@ -86,7 +149,7 @@ class ChApi ChElementGeneric : public ChElementBase {
 
     /// Tell to a system descriptor that there are item(s) of type
     /// ChKblock in this object (for further passing it to a solver)
-    virtual void InjectKRMmatrices(ChSystemDescriptor& mdescriptor) override { mdescriptor.InsertKblock(&Kmatr); }
+    virtual void InjectKRMmatrices(ChSystemDescriptor& mdescriptor) override;
 
     /// Adds the current stiffness K and damping R and mass M matrices in encapsulated
     /// ChKblock item(s), if any. The K, R, M matrices are load with scaling
@@ -95,6 +158,16 @@ class ChApi ChElementGeneric : public ChElementBase {
         this->ComputeKRMmatricesGlobal(this->Kmatr.Get_K(), Kfactor, Rfactor, Mfactor);
     }
 
+    /// Tell to a system descriptor that there is a matrix-free ChKblock item in this object, which evaluates products
+    /// with the K, R, M matrices through ComputeKRMmatricesProduct and ComputeKRMmatricesDiagonal.
+    /// The storage of the K block used by InjectKRMmatrices is released.
+    /// Elements that do not provide matrix-free products (see ProvidesKRMmatricesProduct) inject their K block instead.
+    virtual void InjectKRMproducts(ChSystemDescriptor& mdescriptor) override;
+
+    /// Set the scaling values Kfactor, Rfactor, Mfactor used by the matrix-free ChKblock item.
+    /// Elements that do not provide matrix-free products load their K, R, M matrices instead.
+    virtual void KRMproductsLoad(double Kfactor, double Rfactor, double Mfactor) override;
+
     /// Adds the internal forces, expressed as nodal forces, into the
     /// encapsulated ChVariables, in the 'fb' part: qf+=forces*factor
     /// (This is a default (a bit unoptimal) book keeping so that in children classes you can avoid
@@ -493,6 +493,198 @@ void ChElementHexaANCF_3843::ComputeKRMmatricesGlobal(ChMatrixRef H, double Kfac
     }
 }
 
+// Calculate the product of the global matrix H = Mfactor * [M] + Kfactor * [K] + Rfactor * [R] with a vector v.
+// For the "Continuous Integration" style method, this is the directional derivative of the generalized internal force
+// vector along the nodal coordinate variation (Kfactor * v) and nodal coordinate time derivative variation
+// (Rfactor * v), plus the scaled mass matrix times v, evaluated without forming H.
+
+void ChElementHexaANCF_3843::ComputeKRMmatricesProduct(ChVectorRef Hv,
+                                                       ChVectorConstRef v,
+                                                       double Kfactor,
+                                                       double Rfactor,
+                                                       double Mfactor) {
+    assert((Hv.size() == 3 * NSF) && (v.size() == 3 * NSF));
+
+    if (m_method != IntFrcMethod::ContInt) {
+        ChElementGeneric::ComputeKRMmatricesProduct(Hv, v, Kfactor, Rfactor, Mfactor);
+        return;
+    }
+
+    // Note that the stiffness and damping factors are negated since the Jacobian of the generalized internal force
+    // vector is minus the stiffness and damping matrices
+    ChMatrixNMc<double, 3 * NIP, 3> FC;
+    ChMatrixNMc<double, 3 * NIP, 3> FCscaled;
+    ChMatrixNM<double, NIP, 6> SPK2;
+    CalcJacobianDataContInt(FC, FCscaled, SPK2, -Kfactor, -Rfactor);
+    CalcKRMmatricesProductContInt(Hv, v, FC, FCscaled, SPK2, Kfactor, Mfactor);
+}
+
+void ChElementHexaANCF_3843::CalcKRMmatricesProductContInt(ChVectorRef Hv,
+                                                           ChVectorConstRef v,
+                                                           const ChMatrixNMc<double, 3 * NIP, 3>& FC,
+                                                           const ChMatrixNMc<double, 3 * NIP, 3>& FCscaled,
+                                                           const ChMatrixNM<double, NIP, 6>& SPK2,
+                                                           double Kfactor,
+                                                           double Mfactor) {
+    // Variation of the deformation gradient, with the vector v reshaped in the same way as the nodal coordinates
+    Eigen::Map<const MatrixNx3> vbar(v.data(), NSF, 3);
+    ChMatrixNMc<double, 3 * NIP, 3> dFC = m_SD.transpose() * vbar;
+
+    // Variation of the scaled transpose of the 1st Piola-Kirchoff stresses, dP = dF * S + F * dS, where the stress
+    // variation results from the variation of the Green-Lagrange strains combined with their scaled time derivatives
+    const ChMatrixNM<double, 6, 6>& D = GetMaterial()->Get_D();
+    ChMatrixNMc<double, 3 * NIP, 3> dP_Block;
+    for (auto g = 0; g < NIP; g++) {
+        ChVectorN<double, 6> dE;
+        dE(0) = FCscaled.row(g).dot(dFC.row(g));
+        dE(1) = FCscaled.row(NIP + g).dot(dFC.row(NIP + g));
+        dE(2) = FCscaled.row(2 * NIP + g).dot(dFC.row(2 * NIP + g));
+        dE(3) = FCscaled.row(NIP + g).dot(dFC.row(2 * NIP + g)) + FCscaled.row(2 * NIP + g).dot(dFC.row(NIP + g));
+        dE(4) = FCscaled.row(g).dot(dFC.row(2 * NIP + g)) + FCscaled.row(2 * NIP + g).dot(dFC.row(g));
+        dE(5) = FCscaled.row(g).dot(dFC.row(NIP + g)) + FCscaled.row(NIP + g).dot(dFC.row(g));
+        ChVectorN<double, 6> dS = m_kGQ(g) * (D * dE);
+
+        // Symmetric stress tensors, with the Voigt components ordered as [S11,S22,S33,S23,S13,S12]
+        ChMatrix33<> S;
+        S << SPK2(g, 0), SPK2(g, 5), SPK2(g, 4), SPK2(g, 5), SPK2(g, 1), SPK2(g, 3), SPK2(g, 4), SPK2(g, 3), SPK2(g, 2);
+        ChMatrix33<> dSmat;
+        dSmat << dS(0), dS(5), dS(4), dS(5), dS(1), dS(3), dS(4), dS(3), dS(2);
+
+        for (auto k = 0; k < 3; k++) {
+            for (auto j = 0; j < 3; j++) {
+                double d = 0;
+                for (auto m = 0; m < 3; m++)
+                    d += -Kfactor * dFC(m * NIP + g, j) * S(m, k) + FC(m * NIP + g, j) * dSmat(m, k);
+                dP_Block(k * NIP + g, j) = d;
+            }
+        }
+    }
+
+    MatrixNx3 HvCompact = m_SD * dP_Block;
+    Hv = Eigen::Map<Vector3N>(HvCompact.data(), HvCompact.size());
+
+    // Add the scaled mass matrix (stored in compact upper triangular form) times v
+    unsigned int idx = 0;
+    for (unsigned int i = 0; i < NSF; i++) {
+        for (unsigned int j = i; j < NSF; j++) {
+            double d = Mfactor * m_MassMatrix(idx);
+            Hv.segment(3 * i, 3) += d * v.segment(3 * j, 3);
+            if (i != j)
+                Hv.segment(3 * j, 3) += d * v.segment(3 * i, 3);
+            idx++;
+        }
+    }
+}
+
+// Calculate the diagonal of the global matrix H = Mfactor * [M] + Kfactor * [K] + Rfactor * [R].
+// For the "Continuous Integration" style method, the diagonal is evaluated without forming H.
+
+void ChElementHexaANCF_3843::ComputeKRMmatricesDiagonal(ChVectorRef Hd,
+                                                        double Kfactor,
+                                                        double Rfactor,
+                                                        double Mfactor) {
+    assert(Hd.size() == 3 * NSF);
+
+    if (m_method != IntFrcMethod::ContInt) {
+        ChElementGeneric::ComputeKRMmatricesDiagonal(Hd, Kfactor, Rfactor, Mfactor);
+        return;
+    }
+
+    ChMatrixNMc<double, 3 * NIP, 3> FC;
+    ChMatrixNMc<double, 3 * NIP, 3> FCscaled;
+    ChMatrixNM<double, NIP, 6> SPK2;
+    CalcJacobianDataContInt(FC, FCscaled, SPK2, -Kfactor, -Rfactor);
+    CalcKRMmatricesDiagonalContInt(Hd, FC, FCscaled, SPK2, Kfactor, Mfactor);
+}
+
+void ChElementHexaANCF_3843::CalcKRMmatricesDiagonalContInt(ChVectorRef Hd,
+                                                            const ChMatrixNMc<double, 3 * NIP, 3>& FC,
+                                                            const ChMatrixNMc<double, 3 * NIP, 3>& FCscaled,
+                                                            const ChMatrixNM<double, NIP, 6>& SPK2,
+                                                            double Kfactor,
+                                                            double Mfactor) {
+    const ChMatrixNM<double, 6, 6>& D = GetMaterial()->Get_D();
+
+    // Diagonal entry for the nodal coordinate j of shape function i.  With a_k the derivatives of the shape function at
+    // a Gauss quadrature point, this is the sum over all Gauss quadrature points of the stress term a'*S*a and the
+    // material term kGQ * p'*D*ps, where p and ps are the strain variations for F and FCscaled, respectively.
+    unsigned int idx = 0;
+    for (unsigned int i = 0; i < NSF; i++) {
+        ChVectorN<double, 3> d;
+        d.setZero();
+        for (auto g = 0; g < NIP; g++) {
+            double a0 = m_SD(i, g);
+            double a1 = m_SD(i, NIP + g);
+            double a2 = m_SD(i, 2 * NIP + g);
+
+            double aSa = SPK2(g, 0) * a0 * a0 + SPK2(g, 1) * a1 * a1 + SPK2(g, 2) * a2 * a2 +
+                         2 * (SPK2(g, 3) * a1 * a2 + SPK2(g, 4) * a0 * a2 + SPK2(g, 5) * a0 * a1);
+
+            for (auto j = 0; j < 3; j++) {
+                double f0 = FC(g, j);
+                double f1 = FC(NIP + g, j);
+                double f2 = FC(2 * NIP + g, j);
+                ChVectorN<double, 6> p;
+                p << f0 * a0, f1 * a1, f2 * a2, f1 * a2 + f2 * a1, f0 * a2 + f2 * a0, f0 * a1 + f1 * a0;
+
+                f0 = FCscaled(g, j);
+                f1 = FCscaled(NIP + g, j);
+                f2 = FCscaled(2 * NIP + g, j);
+                ChVectorN<double, 6> ps;
+                ps << f0 * a0, f1 * a1, f2 * a2, f1 * a2 + f2 * a1, f0 * a2 + f2 * a0, f0 * a1 + f1 * a0;
+
+                d(j) += -Kfactor * aSa + m_kGQ(g) * p.dot(D * ps);
+            }
+        }
+
+        // Diagonal entry of the mass matrix (stored in compact upper triangular form)
+        Hd.segment(3 * i, 3) = d.array() + Mfactor * m_MassMatrix(idx);
+        idx += NSF - i;
+    }
+}
+
+// For the "Continuous Integration" style method, the quadrature point data of the Jacobian is computed once when the
+// matrix-free Jacobian is loaded and reused by all products with it during the solve, so that each product only costs
+// the variation of the internal forces.
+
+void ChElementHexaANCF_3843::KRMproductsLoad(double Kfactor, double Rfactor, double Mfactor) {
+    ChElementGeneric::KRMproductsLoad(Kfactor, Rfactor, Mfactor);
+
+    if (m_method != IntFrcMethod::ContInt)
+        return;
+
+    if (!m_jacobian_data)
+        m_jacobian_data.reset(new JacobianDataContInt);
+    CalcJacobianDataContInt(m_jacobian_data->FC, m_jacobian_data->FCscaled, m_jacobian_data->SPK2, -Kfactor, -Rfactor);
+}
+
+void ChElementHexaANCF_3843::ComputeLoadedKRMmatricesProduct(ChVectorRef Hv,
+                                                             ChVectorConstRef v,
+                                                             double Kfactor,
+                                                             double Rfactor,
+                                                             double Mfactor) {
+    if (m_method != IntFrcMethod::ContInt || !m_jacobian_data) {
+        ComputeKRMmatricesProduct(Hv, v, Kfactor, Rfactor, Mfactor);
+        return;
+    }
+
+    CalcKRMmatricesProductContInt(Hv, v, m_jacobian_data->FC, m_jacobian_data->FCscaled, m_jacobian_data->SPK2,
+                                  Kfactor, Mfactor);
+}
+
+void ChElementHexaANCF_3843::ComputeLoadedKRMmatricesDiagonal(ChVectorRef Hd,
+                                                              double Kfactor,
+                                                              double Rfactor,
+                                                              double Mfactor) {
+    if (m_method != IntFrcMethod::ContInt || !m_jacobian_data) {
+        ComputeKRMmatricesDiagonal(Hd, Kfactor, Rfactor, Mfactor);
+        return;
+    }
+
+    CalcKRMmatricesDiagonalContInt(Hd, m_jacobian_data->FC, m_jacobian_data->FCscaled, m_jacobian_data->SPK2, Kfactor,
+                                   Mfactor);
+}
+
 // Compute the generalized force vector due to gravity using the efficient ANCF specific method
 void ChElementHexaANCF_3843::ComputeGravityForces(ChVectorDynamic<>& Fg, const ChVector<>& G_acc) {
     assert(Fg.size() == 3 * NSF);
@@ -2275,6 +2467,47 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianPreInt(ChMatrixRef& H,
     }
 }
 
+// Calculate the deformation gradient, its combination with the time derivative of the deformation gradient, and the
+// scaled 2nd Piola-Kirchoff stresses at all Gauss quadrature points, for the matrix-free evaluation of the Jacobian
+
+void ChElementHexaANCF_3843::CalcJacobianDataContInt(ChMatrixNMc<double, 3 * NIP, 3>& FC,
+                                                     ChMatrixNMc<double, 3 * NIP, 3>& FCscaled,
+                                                     ChMatrixNM<double, NIP, 6>& SPK2,
+                                                     double Kfactor,
+                                                     double Rfactor) {
+    MatrixNx6 ebar_ebardot;
+    CalcCombinedCoordMatrix(ebar_ebardot);
+
+    // Deformation gradient and its time derivative, ordered as in ComputeInternalForcesContIntDamping
+    ChMatrixNMc<double, 3 * NIP, 6> FC_FCdot = m_SD.transpose() * ebar_ebardot;
+    FC = FC_FCdot.template block<3 * NIP, 3>(0, 0);
+
+    double alpha = m_damping_enabled ? m_Alpha : 0;
+    FCscaled = (Kfactor + alpha * Rfactor) * FC + (alpha * Kfactor) * FC_FCdot.template block<3 * NIP, 3>(0, 3);
+
+    // Green-Lagrange strains combined with their scaled time derivatives (Voigt notation), scaled by the Gauss
+    // quadrature weight times the element Jacobian, and the corresponding 2nd Piola-Kirchoff stresses
+    const ChMatrixNM<double, 6, 6>& D = GetMaterial()->Get_D();
+    for (auto g = 0; g < NIP; g++) {
+        auto f0 = FC_FCdot.template block<1, 3>(g, 0);
+        auto f1 = FC_FCdot.template block<1, 3>(NIP + g, 0);
+        auto f2 = FC_FCdot.template block<1, 3>(2 * NIP + g, 0);
+        auto fd0 = FC_FCdot.template block<1, 3>(g, 3);
+        auto fd1 = FC_FCdot.template block<1, 3>(NIP + g, 3);
+        auto fd2 = FC_FCdot.template block<1, 3>(2 * NIP + g, 3);
+
+        ChVectorN<double, 6> E;
+        E(0) = 0.5 * (f0.dot(f0) - 1) + alpha * f0.dot(fd0);
+        E(1) = 0.5 * (f1.dot(f1) - 1) + alpha * f1.dot(fd1);
+        E(2) = 0.5 * (f2.dot(f2) - 1) + alpha * f2.dot(fd2);
+        E(3) = f1.dot(f2) + alpha * (f1.dot(fd2) + fd1.dot(f2));
+        E(4) = f0.dot(f2) + alpha * (f0.dot(fd2) + fd0.dot(f2));
+        E(5) = f0.dot(f1) + alpha * (f0.dot(fd1) + fd0.dot(f1));
+
+        SPK2.row(g) = m_kGQ(g) * (D * E).transpose();
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Shape functions
 // -----------------------------------------------------------------------------
@@ -33,12 +33,14 @@
 #ifndef CH_ELEMENT_HEXA_ANCF_3843_H
 #define CH_ELEMENT_HEXA_ANCF_3843_H
 
+#include <memory>
 #include <vector>
 
 #include "chrono/fea/ChElementHexahedron.h"
 #include "chrono/fea/ChMaterialHexaANCF.h"
 #include "chrono/core/ChQuadrature.h"
 #include "chrono/fea/ChElementGeneric.h"
+#include "chrono/fea/ChElementBatch.h"
 #include "chrono/fea/ChNodeFEAxyzDDD.h"
 #include "chrono/physics/ChLoadable.h"
 
@@ -224,6 +226,31 @@ class ChApi ChElementHexaANCF_3843 : public ChElementHexahedron, public ChElemen
                                           double Rfactor = 0,
                                           double Mfactor = 0) override;
 
+    /// Return true if the products with the element Jacobian are calculated without forming it, which is the case for
+    /// the "Continuous Integration" style method.
+    virtual bool ProvidesKRMmatricesProduct() const override { return m_method == IntFrcMethod::ContInt; }
+
+    /// Compute the product Hv = H * v of a linear combination of M, K, and R with the vector v.
+    ///   H = Mfactor * [M] + Kfactor * [K] + Rfactor * [R],
+    /// For the "Continuous Integration" style method, the product is calculated without forming H.
+    virtual void ComputeKRMmatricesProduct(ChVectorRef Hv,
+                                           ChVectorConstRef v,
+                                           double Kfactor,
+                                           double Rfactor = 0,
+                                           double Mfactor = 0) override;
+
+    /// Compute the diagonal Hd of a linear combination of M, K, and R.
+    ///   H = Mfactor * [M] + Kfactor * [K] + Rfactor * [R],
+    /// For the "Continuous Integration" style method, the diagonal is calculated without forming H.
+    virtual void ComputeKRMmatricesDiagonal(ChVectorRef Hd,
+                                            double Kfactor,
+                                            double Rfactor = 0,
+                                            double Mfactor = 0) override;
+
+    /// Set the scaling factors of the matrix-free Jacobian and, for the "Continuous Integration" style method, compute
+    /// the quadrature point data used by all products with it during the next solve.
+    virtual void KRMproductsLoad(double Kfactor, double Rfactor, double Mfactor) override;
+
     /// Compute the generalized force vector due to gravity using the efficient ANCF specific method
     virtual void ComputeGravityForces(ChVectorDynamic<>& Fg, const ChVector<>& G_acc) override;
 
@@ -372,6 +399,50 @@ class ChApi ChElementHexaANCF_3843 : public ChElementHexahedron, public ChElemen
     /// This Jacobian includes the global mass matrix M with the global stiffness and damping matrix in H.
     void ComputeInternalJacobianPreInt(ChMatrixRef& H, double Kfactor, double Rfactor, double Mfactor);
 
+    /// Calculate the quantities at the Gauss quadrature points needed for the matrix-free evaluation of the Jacobian of
+    /// the internal force using the "Continuous Integration" style method: the deformation gradient FC (ordered as in
+    /// ComputeInternalForcesContIntDamping), its combination with the deformation gradient time derivative
+    ///     FCscaled = (Kfactor + alpha * Rfactor) * F + (alpha * Kfactor) * Fdot,
+    /// and the 2nd Piola-Kirchoff stresses SPK2 in Voigt notation (one row per Gauss quadrature point), scaled by the
+    /// Gauss quadrature weight times the element Jacobian and including the damping contribution.
+    void CalcJacobianDataContInt(ChMatrixNMc<double, 3 * NIP, 3>& FC,
+                                 ChMatrixNMc<double, 3 * NIP, 3>& FCscaled,
+                                 ChMatrixNM<double, NIP, 6>& SPK2,
+                                 double Kfactor,
+                                 double Rfactor);
+
+    /// Calculate the product Hv = H * v using the "Continuous Integration" style method, from the quadrature point data
+    /// computed with CalcJacobianDataContInt (with the stiffness and damping factors negated).
+    void CalcKRMmatricesProductContInt(ChVectorRef Hv,
+                                       ChVectorConstRef v,
+                                       const ChMatrixNMc<double, 3 * NIP, 3>& FC,
+                                       const ChMatrixNMc<double, 3 * NIP, 3>& FCscaled,
+                                       const ChMatrixNM<double, NIP, 6>& SPK2,
+                                       double Kfactor,
+                                       double Mfactor);
+
+    /// Calculate the diagonal Hd of H using the "Continuous Integration" style method, from the quadrature point data
+    /// computed with CalcJacobianDataContInt (with the stiffness and damping factors negated).
+    void CalcKRMmatricesDiagonalContInt(ChVectorRef Hd,
+                                        const ChMatrixNMc<double, 3 * NIP, 3>& FC,
+                                        const ChMatrixNMc<double, 3 * NIP, 3>& FCscaled,
+                                        const ChMatrixNM<double, NIP, 6>& SPK2,
+                                        double Kfactor,
+                                        double Mfactor);
+
+    /// Products with the Jacobian loaded with KRMproductsLoad, reusing the quadrature point data computed there.
+    virtual void ComputeLoadedKRMmatricesProduct(ChVectorRef Hv,
+                                                 ChVectorConstRef v,
+                                                 double Kfactor,
+                                                 double Rfactor,
+                                                 double Mfactor) override;
+
+    /// Diagonal of the Jacobian loaded with KRMproductsLoad, reusing the quadrature point data computed there.
+    virtual void ComputeLoadedKRMmatricesDiagonal(ChVectorRef Hd,
+                                                  double Kfactor,
+                                                  double Rfactor,
+                                                  double Mfactor) override;
+
     /// Calculate the current 3Nx1 vector of nodal coordinates.
     void CalcCoordVector(Vector3N& e);
 
@@ -445,8 +516,22 @@ class ChApi ChElementHexaANCF_3843 : public ChElementHexahedron, public ChElemen
         m_K13Compact;  ///< Saved results from the generalized internal force calculation that are reused for the
                        ///< Jacobian calculations for the "Pre-Integration" style method
 
+
+    /// Quadrature point data for the matrix-free Jacobian, computed in KRMproductsLoad (see CalcJacobianDataContInt).
+    struct JacobianDataContInt {
+        ChMatrixNMc<double, 3 * NIP, 3> FC;
+        ChMatrixNMc<double, 3 * NIP, 3> FCscaled;
+        ChMatrixNM<double, NIP, 6> SPK2;
+
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    };
+    std::unique_ptr<JacobianDataContInt> m_jacobian_data;  ///< allocated at the first matrix-free Jacobian load
+
   public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    template <class E>
+    friend class ChElementBatchANCF;
 };
 
 /// @} fea_elements
@@ -39,6 +39,7 @@
 #include "chrono/fea/ChMaterialShellANCF.h"
 #include "chrono/core/ChQuadrature.h"
 #include "chrono/fea/ChElementShell.h"
+#include "chrono/fea/ChElementBatch.h"
 #include "chrono/fea/ChNodeFEAxyzDD.h"
 
 namespace chrono {
@@ -530,6 +531,9 @@ class ChApi ChElementShellANCF_3833 : public ChElementShell, public ChLoadableUV
 
   public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    template <class E>
+    friend class ChElementBatchANCF;
 };
 
 /// @} fea_elements
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChLoad.h"
@@ -45,6 +46,14 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     automatic_gravity_load = other.automatic_gravity_load;
     num_points_gravity = other.num_points_gravity;
 
+    colored_assembly = other.colored_assembly;
+    element_colors = other.element_colors;
+    num_colored_elements = other.num_colored_elements;
+
+    batched_internal_forces = other.batched_internal_forces;
+
+    matrix_free_jacobian = other.matrix_free_jacobian;
+
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
 }
@@ -65,6 +74,75 @@ void ChMesh::SetupInitial() {
         //    - precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    ColorElements();
+
+    element_batches.clear();
+    element_batch_slots.clear();
+    if (batched_internal_forces)
+        BatchElements();
+}
+
+void ChMesh::ColorElements() {
+    element_colors.clear();
+
+    // Colors already assigned to elements connected to each node
+    std::unordered_map<ChNodeFEAbase*, std::vector<int>> node_colors;
+    std::vector<bool> used;
+
+    for (int ie = 0; ie < (int)velements.size(); ie++) {
+        auto& element = velements[ie];
+
+        // Flag colors of all elements sharing a node with this element
+        used.assign(element_colors.size() + 1, false);
+        for (int in = 0; in < element->GetNnodes(); in++) {
+            auto it = node_colors.find(element->GetNodeN(in).get());
+            if (it != node_colors.end()) {
+                for (auto color : it->second)
+                    used[color] = true;
+            }
+        }
+
+        // Assign the first available color
+        int color = (int)(std::find(used.begin(), used.end(), false) - used.begin());
+        if (color == (int)element_colors.size())
+            element_colors.emplace_back();
+        element_colors[color].push_back(ie);
+
+        for (int in = 0; in < element->GetNnodes(); in++)
+            node_colors[element->GetNodeN(in).get()].push_back(color);
+    }
+
+    num_colored_elements = velements.size();
+}
+
+void ChMesh::SetBatchedInternalForces(bool val) {
+    batched_internal_forces = val;
+
+    // batches are (re)created at the next internal force evaluation
+    element_batches.clear();
+    element_batch_slots.clear();
+}
+
+void ChMesh::BatchElements() {
+    element_batches = ChElementBatch::CreateBatches(velements);
+
+    element_batch_slots.assign(velements.size(), std::make_pair(-1, -1));
+    for (int ib = 0; ib < (int)element_batches.size(); ib++) {
+        for (int i = 0; i < element_batches[ib]->GetNelements(); i++)
+            element_batch_slots[element_batches[ib]->GetElementIndex(i)] = std::make_pair(ib, i);
+    }
+}
+
+void ChMesh::LoadElementResidual_F(int ie, ChVectorDynamic<>& R, const double c, bool atomic, bool batched) {
+    if (batched) {
+        const auto& slot = element_batch_slots[ie];
+        if (slot.first >= 0) {
+            element_batches[slot.first]->LoadResidual_F(slot.second, R, c, atomic);
+            return;
+        }
+    }
+    velements[ie]->EleIntLoadResidual_F(R, c, atomic);
 }
 
 void ChMesh::Relax() {
@@ -293,22 +371,72 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
 
     int nthreads = GetSystem()->nthreads_chrono;
 
+    // re-color the elements if any were added since the last coloring
+    if (nthreads > 1 && colored_assembly && num_colored_elements != velements.size())
+        ColorElements();
+
+    // re-batch the elements if any were added since the last batching
+    if (batched_internal_forces && element_batch_slots.size() != velements.size())
+        BatchElements();
+    bool batched = batched_internal_forces && !element_batches.empty();
+
     // elements internal forces
     timer_internal_forces.start();
-    //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+    if (batched) {
+        //***PARALLEL FOR*** over the element batches (these only write to their own element force vectors)
+        int nb = (int)element_batches.size();
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthreads)
+        for (int ib = 0; ib < nb; ib++) {
+            element_batches[ib]->ComputeInternalForces();
+        }
+    }
+    if (nthreads == 1) {
+        // sequential loop, no need to use omp atomic
+        for (int ie = 0; ie < velements.size(); ie++) {
+            LoadElementResidual_F(ie, R, c, false, batched);
+        }
+    } else if (colored_assembly) {
+        //***PARALLEL FOR*** over the elements of each color (no need to use omp atomic, as these do not share nodes)
+#pragma omp parallel num_threads(nthreads)
+        for (const auto& elements : element_colors) {
+            int ne = (int)elements.size();
+#pragma omp for schedule(dynamic, 4)
+            for (int k = 0; k < ne; k++) {
+                LoadElementResidual_F(elements[k], R, c, false, batched);
+            }
+        }
+    } else {
+        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+        for (int ie = 0; ie < velements.size(); ie++) {
+            LoadElementResidual_F(ie, R, c, true, batched);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+        const ChVector<>& G_acc = GetSystem()->Get_G_acc();
+        if (nthreads == 1) {
+            for (int ie = 0; ie < velements.size(); ie++) {
+                velements[ie]->EleIntLoadResidual_F_gravity(R, G_acc, c, false);
+            }
+        } else if (colored_assembly) {
+#pragma omp parallel num_threads(nthreads)
+            for (const auto& elements : element_colors) {
+                int ne = (int)elements.size();
+#pragma omp for schedule(dynamic, 4)
+                for (int k = 0; k < ne; k++) {
+                    velements[elements[k]]->EleIntLoadResidual_F_gravity(R, G_acc, c, false);
+                }
+            }
+        } else {
+            //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
+            for (int ie = 0; ie < velements.size(); ie++) {
+                velements[ie]->EleIntLoadResidual_F_gravity(R, G_acc, c, true);
+            }
         }
     }
 
@@ -406,8 +534,13 @@ void ChMesh::IntFromDescriptor(const unsigned int off_v,
 //// SOLVER FUNCTIONS
 
 void ChMesh::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
-    for (unsigned int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->InjectKRMmatrices(mdescriptor);
+    if (matrix_free_jacobian) {
+        for (unsigned int ie = 0; ie < velements.size(); ie++)
+            velements[ie]->InjectKRMproducts(mdescriptor);
+    } else {
+        for (unsigned int ie = 0; ie < velements.size(); ie++)
+            velements[ie]->InjectKRMmatrices(mdescriptor);
+    }
 }
 
 void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
@@ -415,8 +548,13 @@ void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
 
     timer_KRMload.start();
 #pragma omp parallel for num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+    for (int ie = 0; ie < velements.size(); ie++) {
+        // With matrix-free Jacobians, only the scaling factors are recorded (products are evaluated by the solver)
+        if (matrix_free_jacobian)
+            velements[ie]->KRMproductsLoad(Kfactor, Rfactor, Mfactor);
+        else
+            velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+    }
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
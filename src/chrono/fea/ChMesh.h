@@ -23,6 +23,7 @@
 #include "chrono/fea/ChContinuumMaterial.h"
 #include "chrono/fea/ChContactSurface.h"
 #include "chrono/fea/ChElementBase.h"
+#include "chrono/fea/ChElementBatch.h"
 #include "chrono/fea/ChMeshSurface.h"
 #include "chrono/fea/ChNodeFEAbase.h"
 
@@ -52,6 +53,16 @@ class ChApi ChMesh : public ChIndexedNodes {
     bool automatic_gravity_load;
     int num_points_gravity;
 
+    bool colored_assembly;                          ///< assemble element forces by color (no atomic updates)
+    std::vector<std::vector<int>> element_colors;  ///< element indices, grouped by color
+    size_t num_colored_elements;                    ///< number of elements in the current coloring
+
+    bool batched_internal_forces;                                  ///< evaluate internal forces in element batches
+    std::vector<std::shared_ptr<ChElementBatch>> element_batches;  ///< batches of elements of the same type
+    std::vector<std::pair<int, int>> element_batch_slots;          ///< batch and index in batch of each element
+
+    bool matrix_free_jacobian;  ///< provide the element Jacobians to the solver as matrix-free products
+
     ChTimer<> timer_internal_forces;
     ChTimer<> timer_KRMload;
     int ncalls_internal_forces;
@@ -63,6 +74,10 @@ class ChApi ChMesh : public ChIndexedNodes {
           n_dofs_w(0),
           automatic_gravity_load(true),
           num_points_gravity(1),
+          colored_assembly(true),
+          num_colored_elements(0),
+          batched_internal_forces(false),
+          matrix_free_jacobian(false),
           ncalls_internal_forces(0),
           ncalls_KRMload(0) {}
     ChMesh(const ChMesh& other);
@@ -173,6 +188,48 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Tell if this mesh will add automatically a gravity load to all contained elements.
     bool GetAutomaticGravity() { return automatic_gravity_load; }
 
+    /// Enable/disable assembly of element internal and gravity forces by element color (default: true).
+    /// At setup, the mesh elements are partitioned in colors such that elements of the same color do not share any
+    /// nodes. If enabled, the element forces are loaded one color at a time, in parallel over the elements of a color,
+    /// and the global residual is updated with plain stores. Otherwise, all elements are processed in parallel and the
+    /// global residual is updated with atomic increments. Colored assembly scales better with the number of threads
+    /// and produces results independent of thread scheduling.
+    void SetColoredAssembly(bool val) { colored_assembly = val; }
+
+    /// Return true if element forces are assembled by element color.
+    bool GetColoredAssembly() const { return colored_assembly; }
+
+    /// Get the number of element colors (0 if the coloring was not yet computed).
+    unsigned int GetNumElementColors() const { return (unsigned int)element_colors.size(); }
+
+    /// Enable/disable batched evaluation of element internal forces (default: false).
+    /// If enabled, elements of the same type which support batched evaluation (see ChElementBatch) are grouped in
+    /// batches at setup, and the internal forces of all elements in a batch are evaluated together with vectorized
+    /// kernels. Other elements are evaluated one at a time. The element forces are then assembled as specified with
+    /// SetColoredAssembly. Note that the element data (e.g., material properties) is loaded in the batches at setup.
+    void SetBatchedInternalForces(bool val);
+
+    /// Return true if element internal forces are evaluated in batches.
+    bool GetBatchedInternalForces() const { return batched_internal_forces; }
+
+    /// Get the number of element batches (0 if batched evaluation is disabled or was not yet set up).
+    unsigned int GetNumElementBatches() const { return (unsigned int)element_batches.size(); }
+
+    /// Enable/disable matrix-free element Jacobians (default: false).
+    /// If enabled, the element K, R, M matrices are not evaluated and stored when the solver requires the system
+    /// Jacobian. Instead, each element provides a matrix-free K block (see ChKblockMatrixFree) which evaluates products
+    /// with its Jacobian (and its diagonal, for the Jacobi preconditioner) on the fly, from the current element state.
+    /// This is intended for use with the iterative linear solvers (see ChIterativeSolverLS), for which the system matrix
+    /// is only needed through matrix-vector products, and keeps the memory use independent of the element size.
+    /// Elements that do not implement matrix-free products (see ChElementBase::ProvidesKRMmatricesProduct) still
+    /// evaluate and store their Jacobian, once per solver call, as without this option. If the solver assembles the
+    /// system matrix (e.g., a direct solver), the matrix-free element Jacobians are formed one at a time while
+    /// assembling.
+    void SetMatrixFreeJacobian(bool val) { matrix_free_jacobian = val; }
+
+    /// Return true if the element Jacobians are provided to the solver as matrix-free products.
+    bool GetMatrixFreeJacobian() const { return matrix_free_jacobian; }
+
     /// Get ChMesh mass properties
     void ComputeMassProperties(double& mass,          ///< ChMesh object mass
                                ChVector<>& com,       ///< ChMesh center of gravity
@@ -282,9 +339,22 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// <pre>
     ///   - Computes the total number of degrees of freedom
     ///   - Precompute auxiliary data, such as (local) stiffness matrices Kl, if any, for each element.
+    ///   - Compute the element coloring used for assembly of element forces.
+    ///   - Group the elements in batches, if batched evaluation of internal forces is enabled.
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Partition the elements in colors, such that elements of the same color do not share any nodes.
+    /// Uses a greedy (first-fit) coloring, in the order in which elements were added to the mesh.
+    void ColorElements();
+
+    /// Group the elements which support batched evaluation of internal forces in batches of elements of the same type.
+    void BatchElements();
+
+    /// Load the internal forces of the element with given index into R, using the results of the element batch
+    /// evaluation if 'batched' is true and the element is part of a batch.
+    void LoadElementResidual_F(int ie, ChVectorDynamic<>& R, const double c, bool atomic, bool batched);
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
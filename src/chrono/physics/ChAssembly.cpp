@@ -635,16 +635,21 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
+    //// NOTE: do not switch these to range for loops (OMP for, if parallel assembly is enabled)
+    int nthreads = GetNumThreadsAssembly();
+
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
     for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
         bodylist[ip]->Update(ChTime, update_assets);
     }
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
     for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
         shaftlist[ip]->Update(ChTime, update_assets);
     }
     for (int ip = 0; ip < (int)otherphysicslist.size(); ++ip) {
         otherphysicslist[ip]->Update(ChTime, update_assets);
     }
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
     for (int ip = 0; ip < (int)linklist.size(); ++ip) {
         linklist[ip]->Update(ChTime, update_assets);
     }
@@ -653,6 +658,10 @@ void ChAssembly::Update(bool update_assets) {
     }
 }
 
+int ChAssembly::GetNumThreadsAssembly() const {
+    return (system && system->parallel_assembly) ? system->nthreads_chrono : 1;
+}
+
 void ChAssembly::SetNoSpeedNoAcceleration() {
     for (auto& body : bodylist) {
         body->SetNoSpeedNoAcceleration();
@@ -916,15 +925,22 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
                                    const double c)          ///< a scaling factor
 {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreadsAssembly();
 
-    for (auto& body : bodylist) {
+    // Bodies and shafts only write in their own segments of R
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
+    // Links may apply forces to the connected bodies: keep serial
     for (auto& link : linklist) {
         if (link->IsActive())
             link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
@@ -944,12 +960,17 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
                                     const double c               ///< a scaling factor
 ) {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreadsAssembly();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntLoadResidual_Mv(displ_v + shaft->GetOffset_w(), R, w, c);
     }
@@ -1010,7 +1031,11 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
         if (shaft->IsActive())
             shaft->IntLoadConstraint_C(displ_L + shaft->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
-    for (auto& link : linklist) {
+    // Links only write in their own segments of Qc
+    int nthreads = GetNumThreadsAssembly();
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntLoadConstraint_C(displ_L + link->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
@@ -1037,7 +1062,11 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
         if (shaft->IsActive())
             shaft->IntLoadConstraint_Ct(displ_L + shaft->GetOffset_L(), Qc, c);
     }
-    for (auto& link : linklist) {
+    // Links only write in their own segments of Qc
+    int nthreads = GetNumThreadsAssembly();
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntLoadConstraint_Ct(displ_L + link->GetOffset_L(), Qc, c);
     }
@@ -1359,8 +1388,11 @@ void ChAssembly::ConstraintsLoadJacobians() {
     for (auto& shaft : shaftlist) {
         shaft->ConstraintsLoadJacobians();
     }
-    for (auto& link : linklist) {
-        link->ConstraintsLoadJacobians();
+    // Links only write in their own constraint Jacobians
+    int nthreads = GetNumThreadsAssembly();
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        linklist[ip]->ConstraintsLoadJacobians();
     }
     for (auto& mesh : meshlist) {
         mesh->ConstraintsLoadJacobians();
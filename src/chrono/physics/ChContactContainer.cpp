@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChSystem.h"
 
 namespace chrono {
 
@@ -24,6 +25,18 @@ ChContactContainer::ChContactContainer(const ChContactContainer& other) : ChPhys
     report_contact_callback = other.report_contact_callback;
 }
 
+void ChContactContainer::ResetContactForces(std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
+    if (GetSystem() && GetSystem()->IsBufferReuseEnabled()) {
+        for (auto& entry : contactforces) {
+            entry.second.force = VNULL;
+            entry.second.torque = VNULL;
+        }
+        return;
+    }
+
+    contactforces.clear();
+}
+
 void ChContactContainer::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChContactContainer>();
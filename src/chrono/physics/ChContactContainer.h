@@ -139,14 +139,20 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     std::shared_ptr<AddContactCallback> add_contact_callback;
     ReportContactCallback* report_contact_callback;
 
+    /// Utility function to reset the cache of contact forces before a call to SumAllContactForces.
+    /// If the owning system reuses per-step buffers (see ChSystem::EnableBufferReuse), existing entries are zeroed
+    /// and kept, so that no map nodes are reallocated at each step. Otherwise, the map is cleared.
+    void ResetContactForces(std::unordered_map<ChContactable*, ForceTorque>& contactforces);
+
     /// Utility function to accumulate contact forces from a specified list of contacts.
-    /// This function is templated by the contact type (assumed to be derived from ChContactTuple).
+    /// This function is templated by the contact storage (a std::list or a ChContactPool of pointers to contacts assumed
+    /// to be derived from ChContactTuple).
     /// Contact forces are accumulated in a map keyed by the contactable objects.
     /// Derived ChContactContainer classes can use this utility (processing their various lists
     /// of contacts) to cache information used for reporting through GetContactableForce and
     /// GetContactableTorque.
-    template <class Tcont>
-    void SumAllContactForces(std::list<Tcont*>& contactlist,
+    template <class Tlist>
+    void SumAllContactForces(Tlist& contactlist,
                              std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
         for (auto contact = contactlist.begin(); contact != contactlist.end(); ++contact) {
             // Extract information for current contact (expressed in global frame)
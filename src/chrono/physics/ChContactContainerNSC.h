@@ -15,19 +15,22 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactable.h"
 
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
-/// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
-/// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
+/// Implemented using pools of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
+/// reactions), one per combination of contactable types. Each pool stores its contacts in contiguous memory blocks
+/// that are reused from one step to the next (see ChContactPool). It might also contain ChContactNSCrolling objects
+/// (extended versions of ChContactNSC, with 6 reactions, that account also for rolling and spinning resistance), but
+/// also for '6dof vs 6dof' contactables.
 class ChApi ChContactContainerNSC : public ChContactContainer {
   public:
     typedef ChContactNSC<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSC_6_6;
@@ -44,43 +47,18 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     typedef ChContactNSCrolling<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSCrolling_6_6;
 
   protected:
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
-
-    int n_added_6_6;
-    int n_added_6_3;
-    int n_added_3_3;
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
-    int n_added_6_6_rolling;
-
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
+    ChContactPool<ChContactNSC_6_6> contactlist_6_6;
+    ChContactPool<ChContactNSC_6_3> contactlist_6_3;
+    ChContactPool<ChContactNSC_3_3> contactlist_3_3;
+    ChContactPool<ChContactNSC_333_3> contactlist_333_3;
+    ChContactPool<ChContactNSC_333_6> contactlist_333_6;
+    ChContactPool<ChContactNSC_333_333> contactlist_333_333;
+    ChContactPool<ChContactNSC_666_3> contactlist_666_3;
+    ChContactPool<ChContactNSC_666_6> contactlist_666_6;
+    ChContactPool<ChContactNSC_666_333> contactlist_666_333;
+    ChContactPool<ChContactNSC_666_666> contactlist_666_666;
+
+    ChContactPool<ChContactNSCrolling_6_6> contactlist_6_6_rolling;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
@@ -94,17 +72,19 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     /// Report the number of added contacts.
     virtual int GetNcontacts() const override {
-        return n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 + n_added_6_6_rolling;
+        return (int)(contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                     contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                     contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                     contactlist_666_666.size() + contactlist_6_6_rolling.size());
     }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of simply deleting all the previous contacts, this optimized implementation rewinds the
+    /// contact pools and reuses the previous contact objects (in place) until possible, to avoid allocation and
+    /// deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -120,13 +100,49 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void AddContact(const collision::ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). Contact objects that were not reused (if any) are kept in their pools for later steps; their memory
+    /// is only released by RemoveAllContacts().
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
     /// object.
     virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) override;
 
+    /// Reactions of a contact, in contact coordinates, and the pair of collision models in contact.
+    struct ContactReactions {
+        collision::ChCollisionModel* modelA;
+        collision::ChCollisionModel* modelB;
+        float reactions[3];
+    };
+
+    /// Entry in the cache of contact reactions, sorted by (ordered) pair of collision models.
+    struct CachedReactions {
+        collision::ChCollisionModel* modelA;  ///< collision model A of the contact
+        collision::ChCollisionModel* modelB;  ///< collision model B of the contact
+        int order;                            ///< order of generation
+        int used;                             ///< number of entries of this pair already used (first entry only)
+        float reactions[3];
+    };
+
+    /// Enable caching of contact reactions from one step to the next (default: false).
+    /// The collision systems that keep persistent contact manifolds (e.g. Bullet) provide a reaction cache for each
+    /// contact point, used to warm start the solver. If enabled, contacts generated by other collision systems (e.g.
+    /// ChCollisionSystemChrono) are warm started from the reactions of the contacts between the same pair of collision
+    /// models at the previous step, matched in the order in which they are generated.
+    void EnableReactionCache(bool val) { reaction_cache_enabled = val; }
+
+    /// Return true if caching of contact reactions is enabled.
+    bool IsReactionCacheEnabled() const { return reaction_cache_enabled; }
+
+    /// Collect the reactions of all current contacts.
+    void GetContactReactions(std::vector<ContactReactions>& reactions) const;
+
+    /// Set the reactions used to warm start the contacts generated at the next collision detection pass (e.g. when
+    /// restoring a checkpoint). Contacts are matched by (ordered) pair of collision models, in the order in which they
+    /// are generated. The reactions are stored in the reaction cache of the collision system, if any; otherwise, they
+    /// are only used if caching of contact reactions is enabled (see EnableReactionCache).
+    void SetContactReactions(const std::vector<ContactReactions>& reactions);
+
     /// Class to be used as a NSC-specific callback interface for some user defined action to be taken
     /// for each contact (already added to the container, maybe with already computed forces).
     /// It can be used to report or post-process contacts. 
@@ -159,9 +175,11 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Report the number of scalar unilateral constraints.
     /// Note: friction constraints aren't exactly unilaterals, but they are still counted.
     virtual int GetDOC_d() override {
-        return 3 * (n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-                    n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666) +
-               6 * (n_added_6_6_rolling);
+        return (int)(3 * (contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                          contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                          contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                          contactlist_666_666.size()) +
+                     6 * contactlist_6_6_rolling.size());
     }
 
     /// Update state of this contact container: compute jacobians, violations, etc.
@@ -224,8 +242,14 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
 
+  protected:
+    bool reaction_cache_enabled;
+    bool reaction_cache_restored;  ///< cache set with SetContactReactions, not used yet
+    std::vector<CachedReactions> reaction_cache;
+
   private:
     void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat);
+    void BuildReactionCache();
 };
 
 CH_CLASS_VERSION(ChContactContainerNSC, 0)
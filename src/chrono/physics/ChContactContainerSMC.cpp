@@ -58,7 +58,11 @@ void ChContactContainerSMC::Update(double mytime, bool update_assets) {
 }
 
 template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
+void _RemoveAllContacts(std::list<Tcont*>& contactlist,
+                        Titer& lastcontact,
+                        int& n_added,
+                        std::list<Tcont*>& sparelist) {
+    contactlist.splice(contactlist.end(), sparelist);
     typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         delete (*itercontact);
@@ -71,16 +75,16 @@ void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int&
 }
 
 void ChContactContainerSMC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
+    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3, sparelist_3_3);
+    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3, sparelist_6_3);
+    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6, sparelist_6_6);
+    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3, sparelist_333_3);
+    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6, sparelist_333_6);
+    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333, sparelist_333_333);
+    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3, sparelist_666_3);
+    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6, sparelist_666_6);
+    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333, sparelist_666_333);
+    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666, sparelist_666_666);
     //**TODO*** cont. roll.
 }
 
@@ -119,48 +123,34 @@ void ChContactContainerSMC::BeginAddContact() {
     // n_added_roll = 0;
 }
 
-void ChContactContainerSMC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
+// Remove the contacts beyond the last contact acquired in the current pass. If reuse is requested, the contact
+// objects (and their list nodes) are moved to the list of spare contacts instead of being deleted.
+template <class Tcont, class Titer>
+void _ReleaseContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, std::list<Tcont*>& sparelist, bool reuse) {
+    if (reuse) {
+        sparelist.splice(sparelist.end(), contactlist, lastcontact, contactlist.end());
+        lastcontact = contactlist.end();
+        return;
     }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
+    while (lastcontact != contactlist.end()) {
+        delete (*lastcontact);
+        lastcontact = contactlist.erase(lastcontact);
     }
+}
+
+void ChContactContainerSMC::EndAddContact() {
+    // remove contacts that are beyond last contact (keep them for reuse if the system reuses per-step buffers)
+    bool reuse = GetSystem() && GetSystem()->IsBufferReuseEnabled();
+    _ReleaseContacts(contactlist_3_3, lastcontact_3_3, sparelist_3_3, reuse);
+    _ReleaseContacts(contactlist_6_3, lastcontact_6_3, sparelist_6_3, reuse);
+    _ReleaseContacts(contactlist_6_6, lastcontact_6_6, sparelist_6_6, reuse);
+    _ReleaseContacts(contactlist_333_3, lastcontact_333_3, sparelist_333_3, reuse);
+    _ReleaseContacts(contactlist_333_6, lastcontact_333_6, sparelist_333_6, reuse);
+    _ReleaseContacts(contactlist_333_333, lastcontact_333_333, sparelist_333_333, reuse);
+    _ReleaseContacts(contactlist_666_3, lastcontact_666_3, sparelist_666_3, reuse);
+    _ReleaseContacts(contactlist_666_6, lastcontact_666_6, sparelist_666_6, reuse);
+    _ReleaseContacts(contactlist_666_333, lastcontact_666_333, sparelist_666_333, reuse);
+    _ReleaseContacts(contactlist_666_666, lastcontact_666_666, sparelist_666_666, reuse);
 
     // while (lastcontact_roll != contactlist_roll.end()) {
     //    delete (*lastcontact_roll);
@@ -172,6 +162,7 @@ template <class Tcont, class Titer, class Ta, class Tb>
 void _OptimalContactInsert(std::list<Tcont*>& contactlist,           // contact list
                            Titer& lastcontact,                       // last contact acquired
                            int& n_added,                             // number of contacts inserted
+                           std::list<Tcont*>& sparelist,             // contacts available for reuse
                            ChContactContainer* container,            // contact container
                            Ta* objA,                                 // collidable object A
                            Tb* objB,                                 // collidable object B
@@ -182,6 +173,11 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,           // contact
         // reuse old contacts
         (*lastcontact)->Reset(objA, objB, cinfo, cmat);
         lastcontact++;
+    } else if (!sparelist.empty()) {
+        // reuse a previously released contact
+        sparelist.front()->Reset(objA, objB, cinfo, cmat);
+        contactlist.splice(contactlist.end(), sparelist, sparelist.begin());
+        lastcontact = contactlist.end();
     } else {
         // add new contact
         Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
@@ -276,22 +272,22 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, sparelist_3_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, sparelist_6_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, sparelist_333_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, sparelist_666_3, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -300,21 +296,21 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, sparelist_6_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, sparelist_6_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, sparelist_333_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, sparelist_666_6, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -323,20 +319,20 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, sparelist_333_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, sparelist_333_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, sparelist_333_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, sparelist_666_333, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -345,19 +341,19 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, sparelist_666_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, sparelist_666_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, sparelist_666_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, sparelist_666_666, this, objA, objB, cinfo, cmat);
             }
         } break;
 
@@ -369,7 +365,7 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
 }
 
 void ChContactContainerSMC::ComputeContactForces() {
-    contact_forces.clear();
+    ResetContactForces(contact_forces);
     SumAllContactForces(contactlist_3_3, contact_forces);
     SumAllContactForces(contactlist_6_3, contact_forces);
     SumAllContactForces(contactlist_6_6, contact_forces);
@@ -451,8 +447,8 @@ void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDy
 }
 
 template <class Tcont>
-void _KRMmatricesLoad(std::list<Tcont*> contactlist, double Kfactor, double Rfactor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _KRMmatricesLoad(const std::list<Tcont*>& contactlist, double Kfactor, double Rfactor) {
+    typename std::list<Tcont*>::const_iterator itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContKRMmatricesLoad(Kfactor, Rfactor);
         ++itercontact;
@@ -473,8 +469,8 @@ void ChContactContainerSMC::KRMmatricesLoad(double Kfactor, double Rfactor, doub
 }
 
 template <class Tcont>
-void _InjectKRMmatrices(std::list<Tcont*> contactlist, ChSystemDescriptor& mdescriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectKRMmatrices(const std::list<Tcont*>& contactlist, ChSystemDescriptor& mdescriptor) {
+    typename std::list<Tcont*>::const_iterator itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContInjectKRMmatrices(mdescriptor);
         ++itercontact;
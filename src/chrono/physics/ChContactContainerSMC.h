@@ -74,6 +74,18 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     std::list<ChContactSMC_666_333*>::iterator lastcontact_666_333;
     std::list<ChContactSMC_666_666*>::iterator lastcontact_666_666;
 
+    // Contact objects released in the current step, kept for later reuse if the system reuses per-step buffers
+    std::list<ChContactSMC_3_3*> sparelist_3_3;
+    std::list<ChContactSMC_6_3*> sparelist_6_3;
+    std::list<ChContactSMC_6_6*> sparelist_6_6;
+    std::list<ChContactSMC_333_3*> sparelist_333_3;
+    std::list<ChContactSMC_333_6*> sparelist_333_6;
+    std::list<ChContactSMC_333_333*> sparelist_333_333;
+    std::list<ChContactSMC_666_3*> sparelist_666_3;
+    std::list<ChContactSMC_666_6*> sparelist_666_6;
+    std::list<ChContactSMC_666_333*> sparelist_666_333;
+    std::list<ChContactSMC_666_666*> sparelist_666_666;
+
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
   public:
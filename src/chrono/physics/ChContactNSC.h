@@ -122,6 +122,17 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector<> GetContactForce() const override { return react_force; }
 
+    /// Set the contact force, in contact coordinate system (e.g. to warm start the solver).
+    /// The force is also stored in the reaction cache of the collision system, if any.
+    void SetContactForce(const ChVector<>& force) {
+        react_force = force;
+        if (reactions_cache) {
+            reactions_cache[0] = (float)force.x();
+            reactions_cache[1] = (float)force.y();
+            reactions_cache[2] = (float)force.z();
+        }
+    }
+
     /// Get the contact friction coefficient
     virtual double GetFriction() { return Nx.GetFrictionCoefficient(); }
 
@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "chrono/core/ChAlignedAllocator.h"
+
+namespace chrono {
+
+/// Pooled storage for contact objects of a single type.
+/// Contacts are constructed in place inside large blocks of contiguous memory, so that loops over all contacts of a
+/// given type walk consecutive addresses instead of chasing linked-list nodes scattered on the heap. Blocks are never
+/// relocated (contact objects hold pointers to their own constraints), and objects constructed in a previous step are
+/// kept alive and handed back for reuse by the collision detection of the following step. Memory is only released in
+/// Clear().
+///
+/// Iterating over the pool visits the active objects in insertion order; dereferencing an iterator returns a pointer
+/// to the contact, so that loops written for a std::list<Tcont*> work unchanged.
+template <class Tcont, size_t block_size = 128>
+class ChContactPool {
+  public:
+    class const_iterator {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Tcont* value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Tcont* const* pointer;
+        typedef Tcont* reference;
+
+        const_iterator(const ChContactPool* pool, size_t index) : m_pool(pool), m_index(index) {}
+
+        Tcont* operator*() const { return m_pool->at(m_index); }
+        const_iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator tmp(*this);
+            ++m_index;
+            return tmp;
+        }
+        bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        const ChContactPool* m_pool;
+        size_t m_index;
+    };
+
+    typedef const_iterator iterator;
+
+    ChContactPool() : m_active(0), m_constructed(0) {}
+    ~ChContactPool() { Clear(); }
+
+    // Contacts hold pointers into their own storage: the pool cannot be copied.
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+
+    /// Return the number of active contacts.
+    size_t size() const { return m_active; }
+
+    /// Return true if there are no active contacts.
+    bool empty() const { return m_active == 0; }
+
+    /// Return the number of contact objects currently constructed (active and available for reuse).
+    size_t GetNumConstructed() const { return m_constructed; }
+
+    /// Return the number of contacts that can be stored without allocating a new block.
+    size_t GetCapacity() const { return m_blocks.size() * block_size; }
+
+    /// Access the i-th active contact.
+    Tcont* at(size_t i) const {
+        assert(i < m_constructed);
+        return reinterpret_cast<Tcont*>(m_blocks[i / block_size]) + (i % block_size);
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_active); }
+
+    /// Mark all contacts as inactive, while keeping the objects (and their memory) for reuse.
+    void Rewind() { m_active = 0; }
+
+    /// Return the next contact object available for reuse (constructed in a previous pass) and mark it as active.
+    /// Return nullptr if all constructed objects are already active; use Emplace() in that case.
+    Tcont* ReuseNext() {
+        if (m_active < m_constructed)
+            return at(m_active++);
+        return nullptr;
+    }
+
+    /// Construct a new contact object at the end of the pool and mark it as active.
+    /// Must only be called once all previously constructed objects are active.
+    template <typename... Args>
+    Tcont* Emplace(Args&&... args) {
+        assert(m_active == m_constructed);
+        if (m_constructed == GetCapacity()) {
+            void* block = aligned_malloc(block_size * sizeof(Tcont), 64);
+            if (!block)
+                throw std::bad_alloc();
+            m_blocks.push_back(block);
+        }
+        Tcont* mc = reinterpret_cast<Tcont*>(m_blocks[m_constructed / block_size]) + (m_constructed % block_size);
+        new (mc) Tcont(std::forward<Args>(args)...);
+        m_constructed++;
+        m_active++;
+        return mc;
+    }
+
+    /// Destroy all contact objects and release all memory blocks.
+    void Clear() {
+        for (size_t i = 0; i < m_constructed; i++)
+            at(i)->~Tcont();
+        for (auto block : m_blocks)
+            aligned_free(block);
+        m_blocks.clear();
+        m_active = 0;
+        m_constructed = 0;
+    }
+
+  private:
+    std::vector<void*> m_blocks;  ///< memory blocks, each with room for 'block_size' contacts
+    size_t m_active;              ///< number of contacts added since the last Rewind()
+    size_t m_constructed;         ///< number of contact objects constructed in the blocks
+};
+
+}  // end namespace chrono
+
+#endif
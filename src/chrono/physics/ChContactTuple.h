@@ -38,6 +38,9 @@ class ChContactTuple {
     Ta* objA;  ///< first ChContactable object in the pair
     Tb* objB;  ///< second ChContactable object in the pair
 
+    collision::ChCollisionModel* modelA;  ///< collision model of the first object
+    collision::ChCollisionModel* modelB;  ///< collision model of the second object
+
     ChVector<> p1;      ///< max penetration point on geo1, after refining, in abs space
     ChVector<> p2;      ///< max penetration point on geo2, after refining, in abs space
     ChVector<> normal;  ///< normal, on surface of master reference (geo1)
@@ -83,6 +86,9 @@ class ChContactTuple {
         this->objA = mobjA;
         this->objB = mobjB;
 
+        this->modelA = cinfo.modelA;
+        this->modelB = cinfo.modelB;
+
         this->p1 = cinfo.vpA;
         this->p2 = cinfo.vpB;
         this->normal = cinfo.vN;
@@ -101,6 +107,12 @@ class ChContactTuple {
     /// Get the colliding object B, with point P2
     Tb* GetObjB() { return this->objB; }
 
+    /// Get the collision model of object A
+    collision::ChCollisionModel* GetModelA() const { return this->modelA; }
+
+    /// Get the collision model of object B
+    collision::ChCollisionModel* GetModelB() const { return this->modelB; }
+
     /// Get the contact coordinate system, expressed in absolute frame.
     /// This represents the 'main' reference of the link: reaction forces
     /// are expressed in this coordinate system. Its origin is point P2.
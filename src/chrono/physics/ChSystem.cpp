@@ -29,6 +29,7 @@
 #include "chrono/solver/ChSolverPSSOR.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/core/ChAllocationCounter.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/utils/ChProfiler.h"
 
@@ -72,6 +73,9 @@ ChSystem::ChSystem()
       nthreads_chrono(ChOMP::GetNumProcs()),
       nthreads_eigen(1),
       nthreads_collision(1),
+      parallel_assembly(false),
+      reuse_buffers(false),
+      nallocs_step(0),
       last_err(false),
       applied_forces_current(false) {
     assembly.system = this;
@@ -85,11 +89,14 @@ ChSystem::ChSystem()
     timestepper = chrono_types::make_shared<ChTimestepperEulerImplicitLinearized>(this);
 }
 
-ChSystem::ChSystem(const ChSystem& other) {
+ChSystem::ChSystem(const ChSystem& other) : composition_strategy(new ChMaterialCompositionStrategy) {
     // Required by ChAssembly
     assembly = other.assembly;
     assembly.system = this;
 
+    // Physics items are not copied: reset the item counters inherited from the other assembly
+    assembly.Clear();
+
     G_acc = other.G_acc;
     ncoords = other.ncoords;
     ncoords_w = other.ncoords_w;
@@ -109,11 +116,15 @@ ChSystem::ChSystem(const ChSystem& other) {
     setupcount = other.setupcount;
     write_matrix = other.write_matrix;
     output_dir = other.output_dir;
+    timestepper = chrono_types::make_shared<ChTimestepperEulerImplicitLinearized>(this);
     SetTimestepperType(other.GetTimestepperType());
     tol_force = other.tol_force;
     nthreads_chrono = other.nthreads_chrono;
     nthreads_eigen = other.nthreads_eigen;
     nthreads_collision = other.nthreads_collision;
+    parallel_assembly = other.parallel_assembly;
+    reuse_buffers = other.reuse_buffers;
+    nallocs_step = 0;
     is_initialized = false;
     is_updated = false;
     applied_forces_current = false;
@@ -125,6 +136,7 @@ ChSystem::ChSystem(const ChSystem& other) {
 
     min_bounce_speed = other.min_bounce_speed;
     max_penetration_recovery_speed = other.max_penetration_recovery_speed;
+    descriptor = chrono_types::make_shared<ChSystemDescriptor>();
     SetSolverType(other.GetSolverType());
     use_sleeping = other.use_sleeping;
 
@@ -1083,9 +1095,14 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // R and Qc vectors  --> solver sparse solver structures  (also sets L and Dv to warmstart)
     IntToDescriptor(0, Dv, R, 0, L, Qc);
 
+    // Let the descriptor assemble the K blocks in the system matrix (if needed by the solver) and perform the
+    // constraint operations of the VI solvers in parallel
+    descriptor->SetNumThreads(nthreads_chrono);
+
     // If the solver's Setup() must be called or if the solver's Solve() requires it,
     // fill the sparse system structures with information in G and Cq.
     if (force_setup || GetSolver()->SolveRequiresMatrix()) {
+        CH_PROFILE_ZONE("LoadJacobians");
         timer_jacobian.start();
 
         // Cq  matrix
@@ -1127,6 +1144,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // If indicated, first perform a solver setup.
     // Return 'false' if the setup phase fails.
     if (force_setup) {
+        CH_PROFILE_ZONE("SolverSetup");
         timer_ls_setup.start();
         bool success = GetSolver()->Setup(*descriptor);
         timer_ls_setup.stop();
@@ -1137,9 +1155,12 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
 
     // Solve the problem
     // The solution is scattered in the provided system descriptor
-    timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
-    timer_ls_solve.stop();
+    {
+        CH_PROFILE_ZONE("SolverSolve");
+        timer_ls_solve.start();
+        GetSolver()->Solve(*descriptor);
+        timer_ls_solve.stop();
+    }
 
     // Dv and L vectors  <-- sparse solver structures
     IntFromDescriptor(0, Dv, 0, L);
@@ -1424,6 +1445,8 @@ void ChSystem::DumpSystemMatrices(bool save_M, bool save_K, bool save_R, bool sa
 // -----------------------------------------------------------------------------
 
 int ChSystem::DoStepDynamics(double step_size) {
+    CH_PROFILE_ZONE("DoStepDynamics");
+
     if (!is_initialized)
         SetupInitial();
 
@@ -1442,6 +1465,7 @@ bool ChSystem::Integrate_Y() {
     ResetTimers();
 
     timer_step.start();
+    unsigned long long nallocs_start = ChAllocationCounter::GetCount();
 
     stepcount++;
     solvecount = 0;
@@ -1500,8 +1524,9 @@ bool ChSystem::Integrate_Y() {
     // Call method to gather contact forces/torques in rigid bodies
     contact_container->ComputeContactForces();
 
-    // Time elapsed for step
+    // Time elapsed and number of allocations for step
     timer_step.stop();
+    nallocs_step = ChAllocationCounter::GetCount() - nallocs_start;
 
     // Update the run-time visualization system, if present
     if (visual_system)
@@ -84,6 +84,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// "Virtual" copy constructor.
     /// Concrete derived classes must implement this.
+    /// The clone has the same settings (gravity, solver and timestepper types, collision system type, number of
+    /// threads, etc.) but does not contain any physics items. Solver and timestepper objects are created with their
+    /// default parameters and custom collision systems, contact containers, or material composition strategies are not
+    /// copied.
     virtual ChSystem* Clone() const = 0;
 
     /// Sets the time step used for integration (dynamical simulation).
@@ -237,7 +241,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in the constraint operations of the VI solvers (APGD, BB, ADMM), and
     ///                           in SCM deformable terrain calculations.
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
@@ -257,6 +262,28 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int GetNumthreadsCollision() const { return nthreads_collision; }
     int GetNumthreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable/disable parallel assembly of the system-level quantities (default: false).
+    /// If enabled, the loops over bodies, shafts, and links in Update(), IntLoadResidual_F(), IntLoadResidual_Mv(),
+    /// IntLoadConstraint_C(), IntLoadConstraint_Ct(), and ConstraintsLoadJacobians() are executed with
+    /// num_threads_chrono OpenMP threads (see SetNumThreads). Only the loops where each item writes exclusively in its
+    /// own state or constraint offsets are parallelized; link forces applied to bodies are still accumulated serially.
+    /// Do not enable this option if user-provided callbacks (e.g., ChFunction objects shared between links, custom
+    /// force functors) are not thread safe.
+    void EnableParallelAssembly(bool val) { parallel_assembly = val; }
+
+    /// Return true if parallel assembly of system-level quantities is enabled.
+    bool IsParallelAssemblyEnabled() const { return parallel_assembly; }
+
+    /// Enable/disable reuse of per-step buffers (default: false).
+    /// If enabled, buffers that are rebuilt at each step (e.g., the cache of contact forces on contactable objects)
+    /// are retained and only grown, so that steady-state stepping of a model with a constant number of contacts
+    /// performs no dynamic memory allocations. Entries for objects no longer in contact are kept (with zero values).
+    /// See GetNumAllocationsStep.
+    void EnableBufferReuse(bool val) { reuse_buffers = val; }
+
+    /// Return true if reuse of per-step buffers is enabled.
+    bool IsBufferReuseEnabled() const { return reuse_buffers; }
+
     //
     // DATABASE HANDLING
     //
@@ -471,6 +498,11 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Return the time (in seconds) for narrowphase collision detection, within the time step.
     double GetTimerCollisionNarrow() const { return collision_system->GetTimerCollisionNarrow(); }
 
+    /// Return the number of dynamic memory allocations performed during the last time step.
+    /// Allocations are counted only if the counting allocation functions were installed in the executable (see
+    /// CH_INSTALL_ALLOCATION_COUNTER in ChAllocationCounter.h); otherwise, this function always returns 0.
+    unsigned long long GetNumAllocationsStep() const { return nallocs_step; }
+
     /// Resets the timers.
     void ResetTimers() {
         timer_step.reset();
@@ -481,6 +513,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
         timer_collision.reset();
         timer_setup.reset();
         timer_update.reset();
+        nallocs_step = 0;
         collision_system->ResetTimers();
     }
 
@@ -973,6 +1006,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int nthreads_chrono;
     int nthreads_eigen;
     int nthreads_collision;
+    bool parallel_assembly;  ///< evaluate per-item loops in ChAssembly in parallel
+    bool reuse_buffers;      ///< retain (and only grow) per-step buffers
 
     // timers for profiling execution speed
     ChTimer<double> timer_step;       ///< timer for integration step
@@ -984,6 +1019,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     ChTimer<double> timer_setup;      ///< timer for system setup
     ChTimer<double> timer_update;     ///< timer for system update
 
+    unsigned long long nallocs_step;  ///< number of dynamic memory allocations during the last step
+
     std::shared_ptr<ChTimestepper> timestepper;  ///< time-stepper object
 
     bool last_err;  ///< indicates error over the last kinematic/dynamics/statics
@@ -55,7 +55,13 @@ ChSystemNSC::ChSystemNSC(bool init_sys)
     collision::ChCollisionModel::SetDefaultSuggestedMargin(0.01);
 }
 
-ChSystemNSC::ChSystemNSC(const ChSystemNSC& other) : ChSystem(other) {}
+ChSystemNSC::ChSystemNSC(const ChSystemNSC& other) : ChSystem(other) {
+    // Create a contact container and a collision system of the same type
+    contact_container = chrono_types::make_shared<ChContactContainerNSC>();
+    contact_container->SetSystem(this);
+
+    SetCollisionSystemType(other.collision_system_type);
+}
 
 void ChSystemNSC::SetContactContainer(std::shared_ptr<ChContactContainer> container) {
     if (std::dynamic_pointer_cast<ChContactContainerNSC>(container))
@@ -60,7 +60,22 @@ ChSystemSMC::ChSystemSMC(bool use_material_properties)
     m_characteristicVelocity = 1;
 }
 
-ChSystemSMC::ChSystemSMC(const ChSystemSMC& other) : ChSystem(other) {}
+ChSystemSMC::ChSystemSMC(const ChSystemSMC& other)
+    : ChSystem(other),
+      m_use_mat_props(other.m_use_mat_props),
+      m_contact_model(other.m_contact_model),
+      m_adhesion_model(other.m_adhesion_model),
+      m_tdispl_model(other.m_tdispl_model),
+      m_stiff_contact(other.m_stiff_contact),
+      m_minSlipVelocity(other.m_minSlipVelocity),
+      m_characteristicVelocity(other.m_characteristicVelocity),
+      m_force_algo(new ChDefaultContactForceSMC) {
+    // Create a contact container and a collision system of the same type
+    contact_container = chrono_types::make_shared<ChContactContainerSMC>();
+    contact_container->SetSystem(this);
+
+    SetCollisionSystemType(other.collision_system_type);
+}
 
 void ChSystemSMC::SetContactContainer(std::shared_ptr<ChContactContainer> container) {
     if (std::dynamic_pointer_cast<ChContactContainerSMC>(container))
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/utils/ChTraceProfiler.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
@@ -30,7 +31,35 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_reuse(false),
+      m_reuse_max(20),
+      m_refinement_max(3),
+      m_reuse_tol(1e-6),
+      m_reuse_rate(0.5),
+      m_force_factorization(false),
+      m_factorize_call(0),
+      m_refactorize_call(0),
+      m_reuse_call(0),
+      m_refresh_call(0),
+      m_refinement_steps(0),
+      m_factor_dim(0),
+      m_factor_nnz(0),
+      m_pattern_changed(true),
+      m_factor_outofdate(false),
+      m_factor_reuse_count(0) {}
+
+void ChDirectSolverLS::EnableFactorizationReuse(bool val,
+                                                int max_reuse,
+                                                int max_refinement,
+                                                double residual_tol,
+                                                double max_rate) {
+    m_reuse = val;
+    m_reuse_max = max_reuse;
+    m_refinement_max = max_refinement;
+    m_reuse_tol = residual_tol;
+    m_reuse_rate = max_rate;
+}
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
@@ -40,6 +69,8 @@ void ChDirectSolverLS::ResetTimers() {
 }
 
 bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("DirectSolverLS::Setup");
+
     m_timer_setup_assembly.start();
 
     // Calculate problem size.
@@ -71,10 +102,12 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         sysd.ConvertToMatrixForm(&sparsity_pattern, nullptr);
         sparsity_pattern.Apply(m_mat);
         m_force_update = false;
+        m_pattern_changed = true;
     } else if (call_reserve) {
         double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
         m_mat.resize(m_dim, m_dim);
         m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
+        m_pattern_changed = true;
     }
 
     // Let the system descriptor load the current matrix
@@ -88,10 +121,22 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     if (write_matrix)
         WriteMatrix("LS_" + frame_id + "_A.dat", m_mat);
 
-    // Let the concrete solver perform the facorization
-    m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
-    m_timer_setup_solvercall.stop();
+    // If factorization reuse is enabled, keep the existing factorization if it is still compatible with the current
+    // matrix and if it was not reused too many times already. Its accuracy is monitored in the Solve phase.
+    bool reuse = m_reuse && !m_force_factorization && m_factor_dim > 0 && m_factor_dim == m_dim &&
+                 m_factor_nnz == (int)m_mat.nonZeros() && m_factor_reuse_count < m_reuse_max;
+
+    bool result = true;
+    if (reuse) {
+        m_factor_outofdate = true;
+        m_factor_reuse_count++;
+        m_reuse_call++;
+    } else {
+        // Let the concrete solver perform the facorization
+        m_timer_setup_solvercall.start();
+        result = Factorize();
+        m_timer_setup_solvercall.stop();
+    }
 
     if (write_matrix)
         WriteMatrix("LS_" + frame_id + "_F.dat", m_mat);
@@ -99,6 +144,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     if (verbose) {
         GetLog() << " Solver setup [" << m_setup_call << "] n = " << m_dim << "  nnz = " << (int)m_mat.nonZeros()
                  << "\n";
+        GetLog() << "  reuse factorization? " << reuse << "\n";
         GetLog() << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSecondsIntermediate() << "s\n"
                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSecondsIntermediate() << "s\n";
     }
@@ -115,6 +161,8 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 }
 
 double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("DirectSolverLS::Solve");
+
     // Assemble the problem right-hand side vector
     m_timer_solve_assembly.start();
     sysd.ConvertToMatrixForm(nullptr, &m_rhs);
@@ -129,6 +177,10 @@ double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
     bool result = SolveSystem();
     m_timer_solve_solvercall.stop();
 
+    // If the factorization does not correspond to the current matrix, improve the solution
+    if (result && m_factor_outofdate)
+        result = RefineSolution();
+
     if (write_matrix)
         WriteVector("LS_" + frame_id + "_x.dat", m_sol);
 
@@ -158,12 +210,13 @@ bool ChDirectSolverLS::SetupCurrent() {
 
     // Allow the matrix to be compressed, if not yet compressed
     m_mat.makeCompressed();
+    m_dim = (int)m_mat.rows();
 
     m_timer_setup_assembly.stop();
 
     // Let the concrete solver perform the factorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = Factorize();
     m_timer_setup_solvercall.stop();
 
     if (verbose) {
@@ -212,6 +265,92 @@ double ChDirectSolverLS::SolveCurrent() {
 
 // ---------------------------------------------------------------------------
 
+bool ChDirectSolverLS::Factorize() {
+    int nnz = (int)m_mat.nonZeros();
+
+    // The symbolic analysis can be reused only if the sparsity pattern is locked and did not change
+    bool refactorize = m_lock && !m_pattern_changed && m_factor_dim > 0 && m_factor_dim == m_dim && m_factor_nnz == nnz;
+
+    bool result;
+    if (refactorize) {
+        result = RefactorizeMatrix();
+        m_refactorize_call++;
+    } else {
+        result = FactorizeMatrix();
+        m_factorize_call++;
+    }
+
+    m_factor_dim = result ? m_dim : 0;
+    m_factor_nnz = nnz;
+    m_pattern_changed = false;
+    m_force_factorization = false;
+    m_factor_outofdate = false;
+    m_factor_reuse_count = 0;
+
+    return result;
+}
+
+bool ChDirectSolverLS::RefineSolution() {
+    double rhs_norm = m_rhs.norm();
+    if (rhs_norm == 0)
+        return true;
+
+    ChVectorDynamic<double> rhs = m_rhs;
+    ChVectorDynamic<double> sol = m_sol;
+
+    // Iterative refinement with the out-of-date factorization:  x += F^{-1} (b - A x)
+    m_timer_solve_solvercall.start();
+    bool converged = false;
+    double res_norm_old = 0;
+    for (int k = 0; k <= m_refinement_max; k++) {
+        m_rhs = rhs - m_mat * sol;
+        double res_norm = m_rhs.norm() / rhs_norm;
+
+        if (verbose)
+            GetLog() << "  refinement [" << k << "]  |residual| / |rhs| = " << res_norm << "\n";
+
+        if (res_norm <= m_reuse_tol) {
+            converged = true;
+            break;
+        }
+        if (k == m_refinement_max || (k > 0 && res_norm > m_reuse_rate * res_norm_old))
+            break;
+        if (!SolveSystem())
+            break;
+
+        sol += m_sol;
+        res_norm_old = res_norm;
+        m_refinement_steps++;
+    }
+    m_timer_solve_solvercall.stop();
+
+    m_rhs = rhs;
+
+    if (converged) {
+        m_sol = sol;
+        return true;
+    }
+
+    // The out-of-date factorization is not accurate enough: factorize the current matrix and solve again
+    if (verbose)
+        GetLog() << "  refactorize current matrix\n";
+
+    m_refresh_call++;
+    m_timer_setup_solvercall.start();
+    bool result = Factorize();
+    m_timer_setup_solvercall.stop();
+    if (!result)
+        return false;
+
+    m_timer_solve_solvercall.start();
+    result = SolveSystem();
+    m_timer_solve_solvercall.stop();
+
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
     ChStreamOutAsciiFile file(filename.c_str());
     file.SetNumFormat("%.12g");
@@ -269,6 +408,11 @@ bool ChSolverSparseLU::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseLU::RefactorizeMatrix() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseLU::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
@@ -298,6 +442,11 @@ bool ChSolverSparseQR::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseQR::RefactorizeMatrix() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseQR::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
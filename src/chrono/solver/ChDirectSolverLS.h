@@ -56,6 +56,17 @@ to a fully dense matrix). This value is used if the sparsity pattern learner is
 space for matrix indices and nonzeros.
 See #SetSparsityEstimate();
 
+If the sparsity pattern is locked and unchanged since the last factorization, the matrix is refactorized numerically,
+reusing the symbolic analysis (ordering) of the previous factorization (if supported by the concrete solver).
+
+Optionally, the matrix factorization can be \e reused across calls to Setup. The current matrix is still assembled, but
+it is only factorized when the problem size or number of nonzeros change, after a prescribed number of reuses, or when
+requested by the accuracy monitor: in the Solve phase, the solution obtained with an out-of-date factorization is
+improved with iterative refinement against the current matrix, and the matrix is refactorized if the relative residual
+does not drop below a tolerance or decreases too slowly. This is intended for problems where the system matrix changes
+little from call to call (e.g., implicit integrators using a modified Newton method).\n
+See #EnableFactorizationReuse();
+
 <br>
 
 <div class="ce-warning">
@@ -111,6 +122,21 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// A concrete direct sparse solver may or may not support this feature.
     virtual void EnableNullPivotDetection(bool val, double threshold = 0) { m_null_pivot_detection = val; }
 
+    /// Enable/disable reuse of the matrix factorization across calls to Setup (default: false).\n
+    /// If enabled, a factorization is reused for at most 'max_reuse' subsequent calls to Setup (as long as the problem
+    /// size and number of nonzeros do not change). A solution obtained with an out-of-date factorization is corrected
+    /// with at most 'max_refinement' steps of iterative refinement against the current matrix; the current matrix is
+    /// refactorized if the relative residual does not drop below 'residual_tol' or if a refinement step fails to
+    /// reduce the residual by a factor of at least 'max_rate'.
+    void EnableFactorizationReuse(bool val,
+                                  int max_reuse = 20,
+                                  int max_refinement = 3,
+                                  double residual_tol = 1e-6,
+                                  double max_rate = 0.5);
+
+    /// Force a matrix factorization at the next call to Setup, even if factorization reuse is enabled.
+    void ForceRefactorization() { m_force_factorization = true; }
+
     /// Reset timers for internal phases in Solve and Setup.
     void ResetTimers();
 
@@ -123,6 +149,17 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Get cumulative time for Pardiso calls in Setup phase.
     double GetTimeSetup_SolverCall() const { return m_timer_setup_solvercall(); }
 
+    /// Return the number of matrix factorizations (including numerical refactorizations).
+    int GetNumFactorizations() const { return m_factorize_call + m_refactorize_call; }
+    /// Return the number of numerical refactorizations (reusing the symbolic analysis of a previous factorization).
+    int GetNumRefactorizations() const { return m_refactorize_call; }
+    /// Return the number of calls to Setup which reused the existing factorization.
+    int GetNumFactorizationReuses() const { return m_reuse_call; }
+    /// Return the number of factorizations triggered in the Solve phase by the accuracy monitor.
+    int GetNumFactorizationRefreshes() const { return m_refresh_call; }
+    /// Return the number of iterative refinement steps performed with an out-of-date factorization.
+    int GetNumRefinementSteps() const { return m_refinement_steps; }
+
     /// Return the number of calls to the solver's Setup function.
     int GetNumSetupCalls() const { return m_setup_call; }
     /// Return the number of calls to the solver's Setup function.
@@ -175,6 +212,11 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() = 0;
 
+    /// Numerically refactorize the current sparse matrix and return true if successful.
+    /// This function is only called if the sparsity pattern did not change since the last factorization, so that the
+    /// symbolic analysis can be reused. The default implementation performs a full factorization.
+    virtual bool RefactorizeMatrix() { return FactorizeMatrix(); }
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() = 0;
@@ -205,12 +247,38 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
 
+    bool m_reuse;                ///< reuse factorization across calls to Setup?
+    int m_reuse_max;             ///< maximum number of consecutive reuses of a factorization
+    int m_refinement_max;        ///< maximum number of refinement steps with an out-of-date factorization
+    double m_reuse_tol;          ///< relative residual tolerance for an out-of-date factorization
+    double m_reuse_rate;         ///< maximum residual reduction ratio for an out-of-date factorization
+    bool m_force_factorization;  ///< force a factorization at the next call to Setup?
+
+    int m_factorize_call;    ///< counter for full factorizations
+    int m_refactorize_call;  ///< counter for numerical refactorizations
+    int m_reuse_call;        ///< counter for calls to Setup which reused the factorization
+    int m_refresh_call;      ///< counter for factorizations triggered in Solve
+    int m_refinement_steps;  ///< counter for iterative refinement steps
+
     ChTimer<> m_timer_setup_assembly;    ///< timer for matrix assembly
     ChTimer<> m_timer_setup_solvercall;  ///< timer for factorization
     ChTimer<> m_timer_solve_assembly;    ///< timer for RHS assembly
     ChTimer<> m_timer_solve_solvercall;  ///< timer for solution
 
   private:
+    /// Factorize the current matrix, reusing the symbolic analysis if the sparsity pattern is unchanged.
+    bool Factorize();
+
+    /// Improve the current solution (obtained with an out-of-date factorization) through iterative refinement,
+    /// refactorizing the current matrix if necessary.
+    bool RefineSolution();
+
+    int m_factor_dim;          ///< problem size at last factorization (0 if no valid factorization)
+    int m_factor_nnz;          ///< number of nonzeros at last factorization
+    bool m_pattern_changed;    ///< sparsity pattern (possibly) changed since last factorization?
+    bool m_factor_outofdate;   ///< current factorization does not correspond to the current matrix?
+    int m_factor_reuse_count;  ///< number of consecutive reuses of the current factorization
+
     void WriteMatrix(const std::string& filename, const ChSparseMatrix& M);
     void WriteVector(const std::string& filename, const ChVectorDynamic<double>& v);
 };
@@ -231,6 +299,9 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Numerically refactorize the current sparse matrix, reusing the symbolic analysis of the last factorization.
+    virtual bool RefactorizeMatrix() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -256,6 +327,9 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Numerically refactorize the current sparse matrix, reusing the symbolic analysis of the last factorization.
+    virtual bool RefactorizeMatrix() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -25,6 +25,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 // =============================================================================
 
@@ -178,6 +179,8 @@ ChIterativeSolverLS::~ChIterativeSolverLS() {
 }
 
 bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("IterativeSolverLS::Setup");
+
     // Calculate problem size
     int dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
 
@@ -213,6 +216,8 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
 }
 
 double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("IterativeSolverLS::Solve");
+
     // Assemble the problem right-hand side vector
     sysd.ConvertToMatrixForm(nullptr, &m_rhs);
 
@@ -0,0 +1,96 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/solver/ChKblockMatrixFree.h"
+
+namespace chrono {
+
+void ChKblockMatrixFree::SetVariables(const std::vector<ChVariables*>& mvariables) {
+    assert(mvariables.size() > 0);
+
+    m_variables = mvariables;
+
+    m_size = 0;
+    for (unsigned int iv = 0; iv < m_variables.size(); iv++)
+        m_size += m_variables[iv]->Get_ndof();
+}
+
+void ChKblockMatrixFree::MultiplyAndAdd(ChVectorRef result, ChVectorConstRef vect) const {
+    // Scratch vectors, reused across blocks (products may be evaluated concurrently by different threads)
+    static thread_local ChVectorDynamic<> v;
+    static thread_local ChVectorDynamic<> Hv;
+    v.resize(m_size);
+    Hv.resize(m_size);
+
+    // Gather the block vector (zero for inactive variables)
+    int kio = 0;
+    for (auto var : m_variables) {
+        int in = var->Get_ndof();
+        if (var->IsActive())
+            v.segment(kio, in) = vect.segment(var->GetOffset(), in);
+        else
+            v.segment(kio, in).setZero();
+        kio += in;
+    }
+
+    ComputeProduct(Hv, v);
+
+    // Scatter the block product (only for active variables)
+    kio = 0;
+    for (auto var : m_variables) {
+        int in = var->Get_ndof();
+        if (var->IsActive())
+            result.segment(var->GetOffset(), in) += Hv.segment(kio, in);
+        kio += in;
+    }
+}
+
+void ChKblockMatrixFree::DiagonalAdd(ChVectorRef result) {
+    ChVectorDynamic<> Hd(m_size);
+    ComputeDiagonal(Hd);
+
+    int kio = 0;
+    for (auto var : m_variables) {
+        int in = var->Get_ndof();
+        if (var->IsActive())
+            result.segment(var->GetOffset(), in) += Hd.segment(kio, in);
+        kio += in;
+    }
+}
+
+void ChKblockMatrixFree::Build_K(ChSparseMatrix& storage, bool add) {
+    if (m_size == 0)
+        return;
+
+    ChMatrixDynamic<> H(m_size, m_size);
+    H.setZero();
+    ComputeMatrix(H);
+
+    int kio = 0;
+    for (auto vari : m_variables) {
+        int io = vari->GetOffset();
+        int in = vari->Get_ndof();
+        if (vari->IsActive()) {
+            int kjo = 0;
+            for (auto varj : m_variables) {
+                int jo = varj->GetOffset();
+                int jn = varj->Get_ndof();
+                if (varj->IsActive())
+                    PasteMatrix(storage, H.block(kio, kjo, in, jn), io, jo, !add);
+                kjo += jn;
+            }
+        }
+        kio += in;
+    }
+}
+
+}  // end namespace chrono
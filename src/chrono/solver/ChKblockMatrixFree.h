@@ -0,0 +1,82 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHKBLOCKMATRIXFREE_H
+#define CHKBLOCKMATRIXFREE_H
+
+#include <vector>
+
+#include "chrono/solver/ChKblock.h"
+#include "chrono/solver/ChVariables.h"
+
+namespace chrono {
+
+/// Base class for K blocks that do not store their matrix. The block connects N 'variables' like ChKblockGeneric, but
+/// products with the block matrix (and its diagonal) are evaluated on the fly, in the local ordering of the block
+/// variables, by the derived class. The block matrix is only formed (one block at a time, in a temporary matrix) if
+/// the system matrix must be assembled.
+///
+/// Such blocks are meant to be used with the iterative solvers that only need the system matrix through products
+/// (e.g., ChIterativeSolverLS with ChSystemDescriptor::SystemProduct) and, optionally, its diagonal (for the Jacobi
+/// preconditioner). The memory used by matrix-free blocks does not depend on the block size.
+class ChApi ChKblockMatrixFree : public ChKblock {
+  public:
+    ChKblockMatrixFree() : m_size(0) {}
+    virtual ~ChKblockMatrixFree() {}
+
+    /// Set references to the connected objects, each of ChVariables type.
+    void SetVariables(const std::vector<ChVariables*>& mvariables);
+
+    /// Get the list of referenced ChVariables items.
+    const std::vector<ChVariables*>& GetVariables() const { return m_variables; }
+
+    /// Returns the number of referenced ChVariables items.
+    virtual size_t GetNvars() const override { return m_variables.size(); }
+
+    /// Access the m-th vector variable object.
+    ChVariables* GetVariableN(unsigned int m_var) const { return m_variables[m_var]; }
+
+    /// Matrix-free blocks do not store their matrix; this function returns an empty matrix.
+    virtual ChMatrixRef Get_K() override { return m_empty; }
+
+    /// Computes the product of the block matrix by 'vect', and add to 'result'.
+    /// Inactive variables are excluded (their entries in 'vect' are ignored and their entries in 'result' unchanged).
+    /// NOTE: the 'vect' and 'result' vectors must already have the size of the total variables & constraints in the
+    /// system; the procedure will use the ChVariable offsets (that must be already updated).
+    virtual void MultiplyAndAdd(ChVectorRef result, ChVectorConstRef vect) const override;
+
+    /// Add the diagonal of the block matrix as a column vector to 'result'.
+    /// NOTE: the 'result' vector must already have the size of the total variables & constraints in the system.
+    virtual void DiagonalAdd(ChVectorRef result) override;
+
+    /// Form the block matrix and write (or add) it into a global 'storage' matrix, at the offsets of variables.
+    virtual void Build_K(ChSparseMatrix& storage, bool add) override;
+
+  protected:
+    /// Compute the product Hv = H * v of the block matrix with a vector v, in the local ordering of the variables.
+    virtual void ComputeProduct(ChVectorRef Hv, ChVectorConstRef v) const = 0;
+
+    /// Compute the diagonal Hd of the block matrix, in the local ordering of the variables.
+    virtual void ComputeDiagonal(ChVectorRef Hd) const = 0;
+
+    /// Compute the block matrix H, in the local ordering of the variables.
+    virtual void ComputeMatrix(ChMatrixRef H) const = 0;
+
+  private:
+    std::vector<ChVariables*> m_variables;
+    int m_size;
+    ChMatrixDynamic<double> m_empty;
+};
+
+}  // end namespace chrono
+
+#endif
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverADMM.h"
+#include "chrono/utils/ChTraceProfiler.h"
 #include "chrono/core/ChMathematics.h"
 
 #include "chrono/solver/ChIterativeSolverLS.h"
@@ -28,6 +29,7 @@ namespace chrono {
         r_dual(0),
         precond(false),
         rho(0.1),
+        rho_last(0),
         rho_b(1e-9),
         sigma(1e-6),
         stepadjust_each(5),
@@ -49,6 +51,8 @@ ChSolverADMM::ChSolverADMM(std::shared_ptr<ChDirectSolverLS> my_LS_engine) :
 
 
 double ChSolverADMM::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("SolverADMM");
+
 
     switch (this->acceleration) {
     case AdmmAcceleration::BASIC:
@@ -69,7 +73,8 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     ChTimer<> m_timer_factorize;
     ChTimer<> m_timer_solve;
 
-    double rho_i = this->rho;
+    // With warm start, continue from the step adapted in the last solve
+    double rho_i = (this->m_warm_start && rho_last > 0) ? rho_last : this->rho;
 
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
 
@@ -170,8 +175,7 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     if (this->precond == true) {
         // Compute diagonal values of N , only mass effect, neglecting stiffness for the moment, TODO
         //  g_i=[Cq_i]*[invM_i]*[Cq_i]' 
-        for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
-            mconstraints[ic]->Update_auxiliary();
+        sysd.UpdateConstraintsAuxiliary();
 
         // Average all g_i for the triplet of contact constraints n,u,v.
         int j_friction_comp = 0;
@@ -291,7 +295,10 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     res_story.r_violation=zeros(1,1);
     */
 
+    m_iterations = 0;
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        m_iterations++;
+
         // diagnostic
         l_old = l;
         z_old = z;
@@ -461,6 +468,8 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     sysd.FromVectorToConstraints(l);
     sysd.FromVectorToVariables(v);
 
+    rho_last = rho_i;
+
     return r_dual;
 }
 
@@ -479,7 +488,8 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     ChTimer<> m_timer_factorize;
     ChTimer<> m_timer_solve;
 
-    double rho_i = this->rho;
+    // With warm start, continue from the step adapted in the last solve
+    double rho_i = (this->m_warm_start && rho_last > 0) ? rho_last : this->rho;
 
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
 
@@ -577,8 +587,7 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     if (this->precond == true) {
         // Compute diagonal values of N , only mass effect, neglecting stiffness for the moment, TODO
         //  g_i=[Cq_i]*[invM_i]*[Cq_i]' 
-        for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
-            mconstraints[ic]->Update_auxiliary();
+        sysd.UpdateConstraintsAuxiliary();
 
         // Average all g_i for the triplet of contact constraints n,u,v.
         int j_friction_comp = 0;
@@ -696,7 +705,9 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     res_story.r_violation=zeros(1,1);
     */
 
+    m_iterations = 0;
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        m_iterations++;
 
         // diagnostic
         l_old = l;
@@ -885,6 +896,8 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     sysd.FromVectorToConstraints(l);
     sysd.FromVectorToVariables(v);
 
+    rho_last = rho_i;
+
     return r_dual;
 }
 
@@ -53,7 +53,11 @@ class ChApi ChSolverADMM : public ChIterativeSolverVI {
     bool GetDiagonalPreconditioner() { return precond; }
 
     /// Set the initial ADMM step. Could change later if adaptive step is used.
-    void SetRho(double mr) { rho = mr; }
+    /// If warm starting is enabled, each solve (but the first) starts from the step adapted during the last solve.
+    void SetRho(double mr) {
+        rho = mr;
+        rho_last = 0;
+    }
     double GetRho() { return rho; }
 
     /// Set the ADMM step for bilateral constraints only.
@@ -133,6 +137,7 @@ class ChApi ChSolverADMM : public ChIterativeSolverVI {
     double r_dual;
     bool precond;
     double rho;
+    double rho_last;  ///< ADMM step at the end of the last solve (reused if warm starting)
     double rho_b;
     double sigma;
     int stepadjust_each;
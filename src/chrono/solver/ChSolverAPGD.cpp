@@ -13,9 +13,11 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono/core/ChStream.h"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -27,37 +29,7 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverAPGD)
 
-ChSolverAPGD::ChSolverAPGD() : nc(0), residual(0.0) {}
-
-void ChSolverAPGD::ShurBvectorCompute(ChSystemDescriptor& sysd) {
-    // ***TO DO*** move the following thirty lines in a short function ChSystemDescriptor::ShurBvectorCompute() ?
-
-    // Compute the b_shur vector in the Shur complement equation N*l = b_shur
-    // with
-    //   N_shur  = D'* (M^-1) * D
-    //   b_shur  = - c + D'*(M^-1)*k = b_i + D'*(M^-1)*k
-    // but flipping the sign of lambdas,  b_shur = - b_i - D'*(M^-1)*k
-    // Do this in three steps:
-
-    // Put (M^-1)*k    in  q  sparse vector of each variable..
-    for (unsigned int iv = 0; iv < sysd.GetVariablesList().size(); iv++)
-        if (sysd.GetVariablesList()[iv]->IsActive())
-            sysd.GetVariablesList()[iv]->Compute_invMb_v(sysd.GetVariablesList()[iv]->Get_qb(),
-                                                         sysd.GetVariablesList()[iv]->Get_fb());  // q = [M]'*fb
-
-    // ...and now do  b_shur = - D'*q = - D'*(M^-1)*k ..
-    r.setZero();
-    int s_i = 0;
-    for (unsigned int ic = 0; ic < sysd.GetConstraintsList().size(); ic++)
-        if (sysd.GetConstraintsList()[ic]->IsActive()) {
-            r(s_i, 0) = sysd.GetConstraintsList()[ic]->Compute_Cq_q();
-            ++s_i;
-        }
-
-    // ..and finally do   b_shur = b_shur - c
-    sysd.BuildBiVector(tmp);  // b_i   =   -c   = phi/h
-    r += tmp;
-}
+ChSolverAPGD::ChSolverAPGD() : nc(0), residual(0.0), L_last(0.0) {}
 
 double ChSolverAPGD::Res4(ChSystemDescriptor& sysd) {
     // Project the gradient (for rollback strategy)
@@ -72,6 +44,8 @@ double ChSolverAPGD::Res4(ChSystemDescriptor& sysd) {
 }
 
 double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("SolverAPGD");
+
     bool verbose = false;
     const std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     const std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
@@ -81,8 +55,7 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
 
     // Update auxiliary data in all constraints before starting,
     // that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
-    for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
-        mconstraints[ic]->Update_auxiliary();
+    sysd.UpdateConstraintsAuxiliary();
 
     double L, t;
     double theta;
@@ -106,8 +79,9 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     obj1 = 0.0;
     obj2 = 0.0;
 
-    // Compute the b_shur vector in the Shur complement equation N*l = b_shur
-    ShurBvectorCompute(sysd);
+    // Compute the b_shur vector in the Shur complement equation N*l = b_shur (with r = -b_shur)
+    sysd.ShurBvectorCompute(r);
+    r = -r;
 
     // If no constraints, return now. Variables contain M^-1 * f after call to ShurBvectorCompute.
     // This early exit is needed, else we get division by zero and a potential infinite loop.
@@ -141,11 +115,15 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     theta = 1.0;
 
     // (5) L_k = norm(N * (gamma_0 - gamma_hat_0)) / norm(gamma_0 - gamma_hat_0)
+    //     With warm start, reuse the final estimate from the last solve, bounded by a multiple of the
+    //     new estimate so that a step size that collapsed during a hard solve is not carried over
     tmp = gamma - gamma_hat;
     L = tmp.norm();
     sysd.ShurComplementProduct(yNew, tmp, nullptr);  // yNew = N * tmp = N * (gamma - gamma_hat)
     L = yNew.norm() / L;
     yNew.setZero();  //// RADU  is this really necessary here?
+    if (m_warm_start && L_last > 0)
+        L = std::min(L_last, 10 * L);
 
     // (6) t_k = 1 / L_k
     t = 1.0 / L;
@@ -156,7 +134,7 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     // (7) for k := 0 to N_max
     for (m_iterations = 0; m_iterations < m_max_iterations; m_iterations++) {
         // (8) g = N * y_k - r
-        // (9) gamma_(k+1) = ProjectionOperator(y_k - t_k * g)
+        // (9) gamma_(k+1) = ProjectionOperator(y_k - t_k * (g + r))
         sysd.ShurComplementProduct(g, y);  // g = N * y
         gammaNew = y - t * (g + r);
         sysd.ConstraintsProject(gammaNew);
@@ -167,7 +145,7 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
         obj1 = gammaNew.dot(0.5 * tmp + r);
 
         sysd.ShurComplementProduct(tmp, y);  // tmp = N * y;
-        obj2 = y.dot(0.5 * tmp + r) + (gammaNew - y).dot(g + 0.5 * L * (gammaNew - y));
+        obj2 = y.dot(0.5 * tmp + r) + (gammaNew - y).dot(g + r + 0.5 * L * (gammaNew - y));
 
         while (obj1 >= obj2) {
             // (11) L_k = 2 * L_k
@@ -176,8 +154,8 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
             // (12) t_k = 1 / L_k
             t = 1.0 / L;
 
-            // (13) gamma_(k+1) = ProjectionOperator(y_k - t_k * g)
-            gammaNew = y - t * g;
+            // (13) gamma_(k+1) = ProjectionOperator(y_k - t_k * (g + r))
+            gammaNew = y - t * (g + r);
             sysd.ConstraintsProject(gammaNew);
 
             // Update obj1 and obj2
@@ -185,7 +163,7 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
             obj1 = gammaNew.dot(0.5 * tmp + r);
 
             sysd.ShurComplementProduct(tmp, y);  // tmp = N * y;
-            obj2 = y.dot(0.5 * tmp + r) + (gammaNew - y).dot(g + 0.5 * L * (gammaNew - y));
+            obj2 = y.dot(0.5 * tmp + r) + (gammaNew - y).dot(g + r + 0.5 * L * (gammaNew - y));
         }  // (14) endwhile
 
         // (15) theta_(k+1) = (-theta_k^2 + theta_k * sqrt(theta_k^2 + 4)) / 2
@@ -209,10 +187,10 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
             break;                         // (24) break
         }                                  // (25) endif
 
-        if (g.dot(gammaNew - gamma) > 0) {  // (26) if g' * (gamma_(k+1) - gamma_k) > 0
-            yNew = gammaNew;                // (27) y_(k+1) = gamma_(k+1)
-            thetaNew = 1.0;                 // (28) theta_(k+1) = 1
-        }                                   // (29) endif
+        if ((g + r).dot(gammaNew - gamma) > 0) {  // (26) if (g + r)' * (gamma_(k+1) - gamma_k) > 0
+            yNew = gammaNew;                      // (27) y_(k+1) = gamma_(k+1)
+            thetaNew = 1.0;                       // (28) theta_(k+1) = 1
+        }                                         // (29) endif
 
         // (30) L_k = 0.9 * L_k
         L = 0.9 * L;
@@ -234,6 +212,9 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     if (verbose)
         std::cout << "Residual: " << residual << ", Iter: " << m_iterations << std::endl;
 
+    // Keep the final Lipschitz estimate for a warm-started solve at the next step (see step (5)).
+    L_last = L;
+
     // (33) return Value at time step t_(l+1), gamma_(l+1) := gamma_hat
     sysd.FromVectorToConstraints(gamma_hat);
 
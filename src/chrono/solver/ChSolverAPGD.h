@@ -24,6 +24,9 @@ namespace chrono {
 
 /// An iterative solver based on Nesterov's Projected Gradient Descent.
 ///
+/// If warm starting is enabled, the estimate of the Lipschitz constant of the Shur complement is also carried over
+/// from one solve to the next.
+///
 /// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
 /// solver.
 class ChApi ChSolverAPGD : public ChIterativeSolverVI {
@@ -45,11 +48,11 @@ class ChApi ChSolverAPGD : public ChIterativeSolverVI {
     void Dump_Lambda(std::vector<double>& temp);
 
   private:
-    void ShurBvectorCompute(ChSystemDescriptor& sysd);
     double Res4(ChSystemDescriptor& sysd);
 
     double residual;
     int nc;
+    double L_last;  ///< final Lipschitz estimate of the last solve (reused if warm starting)
     ChVectorDynamic<> gamma_hat, gammaNew, g, y, gamma, yNew, r, tmp;
 };
 
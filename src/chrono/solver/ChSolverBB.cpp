@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverBB.h"
+#include "chrono/utils/ChTraceProfiler.h"
 #include "chrono/core/ChMathematics.h"
 
 namespace chrono {
@@ -20,11 +21,12 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverBB)
 
-ChSolverBB::ChSolverBB() : n_armijo(10), max_armijo_backtrace(3), lastgoodres(1e30) {}
+ChSolverBB::ChSolverBB() : n_armijo(10), max_armijo_backtrace(3), lastgoodres(1e30), alpha_last(0.0) {}
 
 double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("SolverBB");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
-    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
     if (sysd.GetKblocksList().size() > 0) {
         std::cerr << "\n\nChSolverBB: Can NOT use Barzilai-Borwein solver if there are stiffness matrices.\n" << std::endl;
@@ -36,7 +38,7 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
     double a_max = 1e13;
     double sigma_min = 0.1;
     double sigma_max = 0.9;
-    double alpha = 0.0001;
+    double alpha = (m_warm_start && alpha_last > 0) ? alpha_last : 0.0001;
     double gamma = 1e-4;
     double gdiff = 0.000001;
 
@@ -68,8 +70,7 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
 
     // Update auxiliary data in all constraints before starting,
     // that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
-    for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
-        mconstraints[ic]->Update_auxiliary();
+    sysd.UpdateConstraintsAuxiliary();
 
     // Average all g_i for the triplet of contact constraints n,u,v.
     //  Can be used for the fixed point phase and/or by preconditioner.
@@ -97,32 +98,9 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
             ++d_i;
         }
 
-    // ***TO DO*** move the following thirty lines in a short function ChSystemDescriptor::ShurBvectorCompute() ?
-
     // Compute the b_shur vector in the Shur complement equation N*l = b_shur
-    // with
-    //   N_shur  = D'* (M^-1) * D
-    //   b_shur  = - c + D'*(M^-1)*k = b_i + D'*(M^-1)*k
-    // but flipping the sign of lambdas,  b_shur = - b_i - D'*(M^-1)*k
-    // Do this in three steps:
-
-    // Put (M^-1)*k    in  q  sparse vector of each variable..
-    for (unsigned int iv = 0; iv < mvariables.size(); iv++)
-        if (mvariables[iv]->IsActive())
-            mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
-
-    // ...and now do  b_shur = - D'*q = - D'*(M^-1)*k ..
-    mb.setZero();
-    int s_i = 0;
-    for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
-        if (mconstraints[ic]->IsActive()) {
-            mb(s_i, 0) = -mconstraints[ic]->Compute_Cq_q();
-            ++s_i;
-        }
-
-    // ..and finally do   b_shur = b_shur - c
-    sysd.BuildBiVector(mb_tmp);  // b_i   =   -c   = phi/h
-    mb -= mb_tmp;
+    // (this also puts (M^-1)*k in the q sparse vector of each variable)
+    sysd.ShurBvectorCompute(mb);
 
     // Optimization: backup the  q  sparse data computed above,
     // because   (M^-1)*k   will be needed at the end when computing primals.
@@ -321,6 +299,9 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
         */
     }
 
+    // Keep the spectral step for a warm-started solve at the next step
+    alpha_last = alpha;
+
     // Fallback to best found solution (might be useful because of nonmonotonicity)
     ml = ml_candidate;
 
@@ -25,6 +25,7 @@ namespace chrono {
 /// An iterative solver based on modified Krylov iteration of spectral projected gradients with Barzilai-Borwein.
 ///
 /// The Barzilai-Borwein solver can use diagonal preconditioning (enabled by default).
+/// If warm starting is enabled, the spectral step is also carried over from one solve to the next.
 ///
 /// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
 /// solver.
@@ -63,6 +64,7 @@ class ChApi ChSolverBB : public ChIterativeSolverVI {
     int n_armijo;
     int max_armijo_backtrace;
     double lastgoodres;
+    double alpha_last;  ///< spectral step at the end of the last solve (reused if warm starting)
 };
 
 /// @} chrono_solver
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPJacobi.h"
+#include "chrono/utils/ChTraceProfiler.h"
 #include "chrono/core/ChMathematics.h"
 
 namespace chrono {
@@ -25,6 +26,8 @@ ChSolverPJacobi::ChSolverPJacobi() : maxviolation(0) {
 }
 
 double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("SolverPJacobi");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPMINRES.h"
+#include "chrono/utils/ChTraceProfiler.h"
 #include "chrono/core/ChMathematics.h"
 
 namespace chrono {
@@ -26,6 +27,8 @@ ChSolverPMINRES::ChSolverPMINRES()
       r_proj_resid(1e30) {}
 
 double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("SolverPMINRES");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -12,7 +12,12 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChTraceProfiler.h"
+#include "chrono/solver/ChConstraintTwoTuplesContactN.h"
+#include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 #include "chrono/core/ChMathematics.h"
 
 namespace chrono {
@@ -20,9 +25,23 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverPSOR)
 
-ChSolverPSOR::ChSolverPSOR() : maxviolation(0) {}
+// Constraint types for frictional contacts between two rigid bodies (each with 6 coordinates).
+typedef ChVariableTupleCarrier_1vars<6> BodyCarrier;
+typedef ChConstraintTwoTuplesContactN<BodyCarrier, BodyCarrier> BodyContactN;
+typedef ChConstraintTwoTuplesFrictionT<BodyCarrier, BodyCarrier> BodyFrictionT;
+
+// Fixed-size views of the packed contact data.
+typedef Eigen::Matrix<double, 3, 6, Eigen::RowMajor> PackedJacobian;
+typedef Eigen::Matrix<double, 6, 3, Eigen::ColMajor> PackedEq;
+typedef ChVectorN<double, 3> PackedVector;
+
+ChSolverPSOR::ChSolverPSOR() : maxviolation(0), m_packing(false) {
+    std::fill(m_pk_inactive_q, m_pk_inactive_q + 6, 0.0);
+}
 
 double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("SolverPSOR");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -75,6 +94,12 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
             mconstraints[ic]->Set_l_i(0.);
     }
 
+    // If requested, pack the rigid-body contacts (this also builds the update schedule)
+    if (m_packing)
+        PackContacts(mconstraints);
+    else
+        m_pk_con.clear();
+
     // 4)  Perform the iteration loops
     //
 
@@ -86,91 +111,26 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
         maxdeltalambda = 0;
         i_friction_comp = 0;
 
-        for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
-            // skip computations if constraint not active.
-            if (mconstraints[ic]->IsActive()) {
-                // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->Compute_Cq_q() + mconstraints[ic]->Get_b_i() +
-                                   mconstraints[ic]->Get_cfm_i() * mconstraints[ic]->Get_l_i();
-
-                // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
-                double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
-
-                // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
-                double deltal = (m_omega / mconstraints[ic]->Get_g_i()) * (-mresidual);
-
-                if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
-                    candidate_violation = 0;
-
-                    // update:   lambda += delta_lambda;
-                    old_lambda_friction[i_friction_comp] = mconstraints[ic]->Get_l_i();
-                    mconstraints[ic]->Set_l_i(old_lambda_friction[i_friction_comp] + deltal);
-                    i_friction_comp++;
-
-                    if (i_friction_comp == 1)
-                        candidate_violation = fabs(ChMin(0.0, mresidual));
-
-                    if (i_friction_comp == 3) {
-                        mconstraints[ic - 2]->Project();  // the N normal component will take care of N,U,V
-                        double new_lambda_0 = mconstraints[ic - 2]->Get_l_i();
-                        double new_lambda_1 = mconstraints[ic - 1]->Get_l_i();
-                        double new_lambda_2 = mconstraints[ic - 0]->Get_l_i();
-                        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
-                        if (m_shlambda != 1.0) {
-                            new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
-                            new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
-                            new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
-                            mconstraints[ic - 2]->Set_l_i(new_lambda_0);
-                            mconstraints[ic - 1]->Set_l_i(new_lambda_1);
-                            mconstraints[ic - 0]->Set_l_i(new_lambda_2);
-                        }
-                        double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
-                        double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
-                        double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                        mconstraints[ic - 2]->Increment_q(true_delta_0);
-                        mconstraints[ic - 1]->Increment_q(true_delta_1);
-                        mconstraints[ic - 0]->Increment_q(true_delta_2);
-
-                        if (this->record_violation_history) {
-                            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
-                            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_1));
-                            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_2));
-                        }
-                        i_friction_comp = 0;
-                    }
-                } else {
-                    // update:   lambda += delta_lambda;
-                    double old_lambda = mconstraints[ic]->Get_l_i();
-                    mconstraints[ic]->Set_l_i(old_lambda + deltal);
-
-                    // If new lagrangian multiplier does not satisfy inequalities, project
-                    // it into an admissible orthant (or, in general, onto an admissible set)
-                    mconstraints[ic]->Project();
-
-                    // After projection, the lambda may have changed a bit..
-                    double new_lambda = mconstraints[ic]->Get_l_i();
-
-                    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
-                    if (m_shlambda != 1.0) {
-                        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
-                        mconstraints[ic]->Set_l_i(new_lambda);
-                    }
-
-                    double true_delta = new_lambda - old_lambda;
-
-                    // For all items with variables, add the effect of incremented
-                    // (and projected) lagrangian reactions:
-                    mconstraints[ic]->Increment_q(true_delta);
-
-                    if (this->record_violation_history)
-                        maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+        if (m_packing) {
+            for (auto item : m_schedule) {
+                double candidate_violation;
+                if (item >= 0)
+                    candidate_violation =
+                        UpdateConstraint(mconstraints, item, i_friction_comp, old_lambda_friction, maxdeltalambda);
+                else
+                    candidate_violation = UpdatePackedContact(-item - 1, maxdeltalambda);
+                maxviolation = ChMax(maxviolation, candidate_violation);
+            }
+        } else {
+            for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
+                // skip computations if constraint not active.
+                if (mconstraints[ic]->IsActive()) {
+                    double candidate_violation =
+                        UpdateConstraint(mconstraints, ic, i_friction_comp, old_lambda_friction, maxdeltalambda);
+                    maxviolation = ChMax(maxviolation, candidate_violation);
                 }
-
-                maxviolation = ChMax(maxviolation, fabs(candidate_violation));
-
-            }  // end IsActive()
-
-        }  // end loop on constraints
+            }
+        }
 
         // For recording into violation history, if debugging
         if (this->record_violation_history)
@@ -184,7 +144,268 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
 
     }  // end iteration loop
 
+    if (m_packing)
+        UnpackContacts();
+
     return maxviolation;
 }
 
+double ChSolverPSOR::UpdateConstraint(std::vector<ChConstraint*>& mconstraints,
+                                      unsigned int ic,
+                                      int& i_friction_comp,
+                                      double* old_lambda_friction,
+                                      double& maxdeltalambda) {
+    // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+    double mresidual = mconstraints[ic]->Compute_Cq_q() + mconstraints[ic]->Get_b_i() +
+                       mconstraints[ic]->Get_cfm_i() * mconstraints[ic]->Get_l_i();
+
+    // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+    double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
+
+    // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+    double deltal = (m_omega / mconstraints[ic]->Get_g_i()) * (-mresidual);
+
+    if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+        candidate_violation = 0;
+
+        // update:   lambda += delta_lambda;
+        old_lambda_friction[i_friction_comp] = mconstraints[ic]->Get_l_i();
+        mconstraints[ic]->Set_l_i(old_lambda_friction[i_friction_comp] + deltal);
+        i_friction_comp++;
+
+        if (i_friction_comp == 1)
+            candidate_violation = fabs(ChMin(0.0, mresidual));
+
+        if (i_friction_comp == 3) {
+            mconstraints[ic - 2]->Project();  // the N normal component will take care of N,U,V
+            double new_lambda_0 = mconstraints[ic - 2]->Get_l_i();
+            double new_lambda_1 = mconstraints[ic - 1]->Get_l_i();
+            double new_lambda_2 = mconstraints[ic - 0]->Get_l_i();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0) {
+                new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
+                new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
+                new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
+                mconstraints[ic - 2]->Set_l_i(new_lambda_0);
+                mconstraints[ic - 1]->Set_l_i(new_lambda_1);
+                mconstraints[ic - 0]->Set_l_i(new_lambda_2);
+            }
+            double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
+            double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
+            double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
+            mconstraints[ic - 2]->Increment_q(true_delta_0);
+            mconstraints[ic - 1]->Increment_q(true_delta_1);
+            mconstraints[ic - 0]->Increment_q(true_delta_2);
+
+            if (this->record_violation_history) {
+                maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
+                maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_1));
+                maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_2));
+            }
+            i_friction_comp = 0;
+        }
+    } else {
+        // update:   lambda += delta_lambda;
+        double old_lambda = mconstraints[ic]->Get_l_i();
+        mconstraints[ic]->Set_l_i(old_lambda + deltal);
+
+        // If new lagrangian multiplier does not satisfy inequalities, project
+        // it into an admissible orthant (or, in general, onto an admissible set)
+        mconstraints[ic]->Project();
+
+        // After projection, the lambda may have changed a bit..
+        double new_lambda = mconstraints[ic]->Get_l_i();
+
+        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+        if (m_shlambda != 1.0) {
+            new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+            mconstraints[ic]->Set_l_i(new_lambda);
+        }
+
+        double true_delta = new_lambda - old_lambda;
+
+        // For all items with variables, add the effect of incremented
+        // (and projected) lagrangian reactions:
+        mconstraints[ic]->Increment_q(true_delta);
+
+        if (this->record_violation_history)
+            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+    }
+
+    return fabs(candidate_violation);
+}
+
+// -----------------------------------------------------------------------------
+
+// Project the reactions of a frictional contact onto the friction cone.
+// Same as ChConstraintTwoTuplesContactN::Project, operating on the packed reactions (normal, u, v).
+static inline void ProjectOnFrictionCone(double* l, double friction, double cohesion) {
+    double f_n = l[0] + cohesion;
+
+    // no friction? project to axis of upper cone
+    if (friction == 0) {
+        l[1] = 0;
+        l[2] = 0;
+        if (f_n < 0)
+            l[0] = 0;
+        return;
+    }
+
+    double f_u = l[1];
+    double f_v = l[2];
+
+    double mu2 = friction * friction;
+    double f_n2 = f_n * f_n;
+    double f_t2 = (f_v * f_v + f_u * f_u);
+
+    // inside lower cone or close to origin? reset normal, u, v to zero!
+    if ((f_n <= 0 && f_t2 < f_n2 / mu2) || (f_n < 1e-14 && f_n > -1e-14)) {
+        l[0] = 0;
+        l[1] = 0;
+        l[2] = 0;
+        return;
+    }
+
+    // inside upper cone? keep untouched!
+    if (f_t2 < f_n2 * mu2)
+        return;
+
+    // project orthogonally to generator segment of upper cone
+    double f_t = sqrt(f_t2);
+    double f_n_proj = (f_t * friction + f_n) / (mu2 + 1);
+    double f_t_proj = f_n_proj * friction;
+    double tproj_div_t = f_t_proj / f_t;
+
+    l[0] = f_n_proj - cohesion;
+    l[1] = tproj_div_t * f_u;
+    l[2] = tproj_div_t * f_v;
+}
+
+double ChSolverPSOR::UpdatePackedContact(int k, double& maxdeltalambda) {
+    Eigen::Map<const PackedJacobian> Cq_a(&m_pk_Cq_a[18 * k]);
+    Eigen::Map<const PackedJacobian> Cq_b(&m_pk_Cq_b[18 * k]);
+    Eigen::Map<const PackedEq> Eq_a(&m_pk_Eq_a[18 * k]);
+    Eigen::Map<const PackedEq> Eq_b(&m_pk_Eq_b[18 * k]);
+    Eigen::Map<const PackedVector> b(&m_pk_b[3 * k]);
+    Eigen::Map<const PackedVector> cfm(&m_pk_cfm[3 * k]);
+    Eigen::Map<PackedVector> l(&m_pk_l[3 * k]);
+    Eigen::Map<ChVectorN<double, 6>> qa(m_pk_qa[k]);
+    Eigen::Map<ChVectorN<double, 6>> qb(m_pk_qb[k]);
+
+    // residuals  c = [Cq]*q + b + cfm*l  (for the normal and the two tangential components)
+    PackedVector residual = Cq_a * qa + Cq_b * qb + b + cfm.cwiseProduct(l);
+
+    // update:  lambda += -(omega/g) * c   and project onto the friction cone
+    PackedVector old_lambda = l;
+    l += (-m_omega / m_pk_g[k]) * residual;
+    ProjectOnFrictionCone(l.data(), m_pk_mu[k], m_pk_coh[k]);
+
+    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+    if (m_shlambda != 1.0)
+        l = m_shlambda * l + (1.0 - m_shlambda) * old_lambda;
+
+    // add the effect of the incremented (and projected) reactions
+    PackedVector true_delta = l - old_lambda;
+    qa += Eq_a * true_delta;
+    qb += Eq_b * true_delta;
+
+    if (this->record_violation_history)
+        maxdeltalambda = ChMax(maxdeltalambda, true_delta.cwiseAbs().maxCoeff());
+
+    return fabs(ChMin(0.0, residual[0]));
+}
+
+void ChSolverPSOR::PackContacts(std::vector<ChConstraint*>& mconstraints) {
+    m_schedule.clear();
+    m_pk_con.clear();
+    m_pk_qa.clear();
+    m_pk_qb.clear();
+    m_pk_Cq_a.clear();
+    m_pk_Cq_b.clear();
+    m_pk_Eq_a.clear();
+    m_pk_Eq_b.clear();
+    m_pk_b.clear();
+    m_pk_cfm.clear();
+    m_pk_l.clear();
+    m_pk_g.clear();
+    m_pk_mu.clear();
+    m_pk_coh.clear();
+
+    // Traverse the constraints in the same order as the sweeps, tracking the grouping of active friction constraints
+    // in triplets. A rigid-body contact is packed only if it starts a triplet, all its constraints are active, and at
+    // least one of its bodies has active variables; all other active constraints are scheduled for individual updates.
+    int i_friction_comp = 0;
+    unsigned int nc = (unsigned int)mconstraints.size();
+    for (unsigned int ic = 0; ic < nc; ic++) {
+        if (!mconstraints[ic]->IsActive())
+            continue;
+
+        BodyContactN* cn = nullptr;
+        if (i_friction_comp == 0 && ic + 2 < nc)
+            cn = dynamic_cast<BodyContactN*>(mconstraints[ic]);
+
+        if (cn && cn->GetTangentialConstraintU() == mconstraints[ic + 1] &&
+            cn->GetTangentialConstraintV() == mconstraints[ic + 2] && mconstraints[ic + 1]->IsActive() &&
+            mconstraints[ic + 2]->IsActive() &&
+            (cn->Get_tuple_a().GetVariables()->IsActive() || cn->Get_tuple_b().GetVariables()->IsActive())) {
+            BodyFrictionT* cu = cn->GetTangentialConstraintU();
+            BodyFrictionT* cv = cn->GetTangentialConstraintV();
+            int k = (int)m_pk_con.size();
+
+            m_pk_con.push_back(cn);
+            for (ChConstraint* c : {(ChConstraint*)cn, (ChConstraint*)cu, (ChConstraint*)cv}) {
+                m_pk_b.push_back(c->Get_b_i());
+                m_pk_cfm.push_back(c->Get_cfm_i());
+                m_pk_l.push_back(c->Get_l_i());
+            }
+
+            // As in ChVariableTupleCarrier, a body with inactive variables (e.g., fixed ground) does not contribute to
+            // the residual and its variables are not updated. Its Jacobian and Eq blocks are zeroed and its variables
+            // are redirected to a scratch vector, so that the packed update needs no branching.
+            if (cn->Get_tuple_a().GetVariables()->IsActive()) {
+                m_pk_qa.push_back(cn->Get_tuple_a().GetVariables()->Get_qb().data());
+                for (auto& t : {&cn->Get_tuple_a(), &cu->Get_tuple_a(), &cv->Get_tuple_a()}) {
+                    m_pk_Cq_a.insert(m_pk_Cq_a.end(), t->Get_Cq().data(), t->Get_Cq().data() + 6);
+                    m_pk_Eq_a.insert(m_pk_Eq_a.end(), t->Get_Eq().data(), t->Get_Eq().data() + 6);
+                }
+            } else {
+                m_pk_qa.push_back(m_pk_inactive_q);
+                m_pk_Cq_a.insert(m_pk_Cq_a.end(), 18, 0.0);
+                m_pk_Eq_a.insert(m_pk_Eq_a.end(), 18, 0.0);
+            }
+            if (cn->Get_tuple_b().GetVariables()->IsActive()) {
+                m_pk_qb.push_back(cn->Get_tuple_b().GetVariables()->Get_qb().data());
+                for (auto& t : {&cn->Get_tuple_b(), &cu->Get_tuple_b(), &cv->Get_tuple_b()}) {
+                    m_pk_Cq_b.insert(m_pk_Cq_b.end(), t->Get_Cq().data(), t->Get_Cq().data() + 6);
+                    m_pk_Eq_b.insert(m_pk_Eq_b.end(), t->Get_Eq().data(), t->Get_Eq().data() + 6);
+                }
+            } else {
+                m_pk_qb.push_back(m_pk_inactive_q);
+                m_pk_Cq_b.insert(m_pk_Cq_b.end(), 18, 0.0);
+                m_pk_Eq_b.insert(m_pk_Eq_b.end(), 18, 0.0);
+            }
+            m_pk_g.push_back(cn->Get_g_i());
+            m_pk_mu.push_back(cn->GetFrictionCoefficient());
+            m_pk_coh.push_back(cn->GetCohesion());
+
+            m_schedule.push_back(-k - 1);
+            ic += 2;
+            continue;
+        }
+
+        if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC)
+            i_friction_comp = (i_friction_comp + 1) % 3;
+        m_schedule.push_back((int)ic);
+    }
+}
+
+void ChSolverPSOR::UnpackContacts() {
+    for (size_t k = 0; k < m_pk_con.size(); k++) {
+        auto cn = static_cast<BodyContactN*>(m_pk_con[k]);
+        cn->Set_l_i(m_pk_l[3 * k + 0]);
+        cn->GetTangentialConstraintU()->Set_l_i(m_pk_l[3 * k + 1]);
+        cn->GetTangentialConstraintV()->Set_l_i(m_pk_l[3 * k + 2]);
+    }
+}
+
 }  // end namespace chrono
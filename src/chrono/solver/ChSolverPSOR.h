@@ -15,6 +15,8 @@
 #ifndef CHSOLVER_PSOR_H
 #define CHSOLVER_PSOR_H
 
+#include <vector>
+
 #include "chrono/solver/ChIterativeSolverVI.h"
 
 namespace chrono {
@@ -24,6 +26,11 @@ namespace chrono {
 
 /// An iterative solver based on projective fixed point method, with overrelaxation and immediate variable update as in
 /// SOR methods.\n
+/// Optionally, frictional contacts between pairs of rigid bodies can be processed in packed form: at the beginning of
+/// each Solve, the Jacobian blocks of such contacts are copied into contiguous per-contact arrays and the sweeps over
+/// these contacts use fixed-size (vectorizable) kernels instead of virtual calls on each constraint. All other
+/// constraints are processed as usual, in the same order, so that the results match those of the default
+/// implementation (up to round-off). See EnableContactPacking().\n
 /// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
 /// solver.
 
@@ -44,8 +51,56 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
     /// For the PSOR solver, this is the maximum constraint violation.
     virtual double GetError() const override { return maxviolation; }
 
+    /// Enable/disable packed processing of frictional contacts between pairs of rigid bodies (default: false).
+    /// This is beneficial for problems dominated by rigid-body contacts.
+    void EnableContactPacking(bool val) { m_packing = val; }
+
+    /// Return true if packed processing of rigid-body contacts is enabled.
+    bool IsContactPackingEnabled() const { return m_packing; }
+
+    /// Return the number of contacts processed in packed form during the last solve.
+    int GetNumPackedContacts() const { return (int)m_pk_con.size(); }
+
   private:
+    /// Perform one projected SOR update of the constraint with given index (if not part of a packed contact).
+    /// Return the corresponding constraint violation.
+    double UpdateConstraint(std::vector<ChConstraint*>& mconstraints,
+                            unsigned int ic,
+                            int& i_friction_comp,
+                            double* old_lambda_friction,
+                            double& maxdeltalambda);
+
+    /// Perform one projected SOR update of the packed contact with given index.
+    /// Return the corresponding constraint violation.
+    double UpdatePackedContact(int k, double& maxdeltalambda);
+
+    /// Copy the data of all rigid-body contacts into the packed arrays and build the update schedule.
+    void PackContacts(std::vector<ChConstraint*>& mconstraints);
+
+    /// Load the final reactions of packed contacts back into the corresponding constraints.
+    void UnpackContacts();
+
     double maxviolation;
+    bool m_packing;
+
+    // Update schedule: constraint index (if >= 0) or packed contact index k encoded as -(k+1)
+    std::vector<int> m_schedule;
+
+    // Packed rigid-body contact data (one entry per contact, i.e. per triplet of constraints N, U, V)
+    std::vector<ChConstraint*> m_pk_con;  ///< normal constraint (followed by the U and V constraints)
+    std::vector<double*> m_pk_qa;         ///< variables of first body
+    std::vector<double*> m_pk_qb;         ///< variables of second body
+    std::vector<double> m_pk_Cq_a;        ///< Jacobian rows for first body (3x6, row major)
+    std::vector<double> m_pk_Cq_b;        ///< Jacobian rows for second body (3x6, row major)
+    std::vector<double> m_pk_Eq_a;        ///< invM*Cq' for first body (6x3, column major)
+    std::vector<double> m_pk_Eq_b;        ///< invM*Cq' for second body (6x3, column major)
+    std::vector<double> m_pk_b;           ///< constraint right-hand sides (3)
+    std::vector<double> m_pk_cfm;         ///< constraint force mixing terms (3)
+    std::vector<double> m_pk_l;           ///< reactions (3)
+    std::vector<double> m_pk_g;           ///< averaged g_i
+    std::vector<double> m_pk_mu;          ///< friction coefficient
+    std::vector<double> m_pk_coh;         ///< cohesion
+    double m_pk_inactive_q[6];            ///< zero variables used for bodies with inactive variables
 };
 
 /// @} chrono_solver
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/utils/ChTraceProfiler.h"
 #include "chrono/core/ChMathematics.h"
 
 namespace chrono {
@@ -23,6 +24,8 @@ CH_FACTORY_REGISTER(ChSolverPSSOR)
 ChSolverPSSOR::ChSolverPSSOR() : maxviolation(0) {}
 
 double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("SolverPSSOR");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -12,10 +12,17 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <cstring>
+
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
+#include "chrono/solver/ChConstraintTwoTuplesRollingN.h"
+#include "chrono/solver/ChConstraintTwoTuplesRollingT.h"
+#include "chrono/solver/ChKblockGeneric.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
@@ -25,7 +32,8 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false), nthreads(1) {
+    kmap.valid = false;
     vconstraints.clear();
     vvariables.clear();
     vstiffness.clear();
@@ -226,8 +234,11 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
         }
 
         // If present, add stiffness matrix K to upper-left block of Z.
-        for (size_t ik = 0; ik < vs_size; ik++) {
-            vstiffness[ik]->Build_K(*Z, true);
+        // If possible, use the K block map to add all blocks in parallel; otherwise, add blocks one at a time.
+        if (!AddKblocksMapped(*Z)) {
+            for (size_t ik = 0; ik < vs_size; ik++) {
+                vstiffness[ik]->Build_K(*Z, true);
+            }
         }
 
         // Fill Z by looping over constraints.
@@ -270,6 +281,127 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
     }
 }
 
+bool ChSystemDescriptor::AddKblocksMapped(ChSparseMatrix& Z) {
+    // The map can only be used with a compressed matrix (and not with a sparsity pattern learner)
+    if (vstiffness.empty() || !Z.isCompressed() || dynamic_cast<ChSparsityPatternLearner*>(&Z))
+        return false;
+
+    // Collect the current K block signature: sizes and offsets of all referenced variables (-1 if inactive)
+    auto& signature = kmap.scratch;
+    signature.clear();
+    for (auto block : vstiffness) {
+        auto kblock = dynamic_cast<ChKblockGeneric*>(block);
+        if (!kblock)
+            return false;
+        signature.push_back((int)kblock->GetNvars());
+        for (unsigned int iv = 0; iv < kblock->GetNvars(); iv++) {
+            auto var = kblock->GetVariableN(iv);
+            signature.push_back(var->Get_ndof());
+            signature.push_back(var->IsActive() ? var->GetOffset() : -1);
+        }
+    }
+
+    // Reconstruct the map if the K blocks, their variables, or the matrix sparsity pattern changed
+    bool up_to_date = kmap.blocks == vstiffness && kmap.signature == signature &&
+                      kmap.outer.size() == (size_t)Z.outerSize() + 1 && kmap.inner.size() == (size_t)Z.nonZeros() &&
+                      std::memcmp(kmap.outer.data(), Z.outerIndexPtr(), kmap.outer.size() * sizeof(int)) == 0 &&
+                      std::memcmp(kmap.inner.data(), Z.innerIndexPtr(), kmap.inner.size() * sizeof(int)) == 0;
+    if (!up_to_date) {
+        kmap.blocks = vstiffness;
+        kmap.signature.swap(signature);
+        kmap.outer.assign(Z.outerIndexPtr(), Z.outerIndexPtr() + Z.outerSize() + 1);
+        kmap.inner.assign(Z.innerIndexPtr(), Z.innerIndexPtr() + Z.nonZeros());
+        kmap.valid = BuildKblockMap(Z);
+    }
+
+    if (!kmap.valid)
+        return false;
+
+    // Add the contributions of all K blocks to each nonzero of Z.
+    // Contributions are added in the order of the K blocks, as done when adding one K block at a time.
+    kmap.kdata.resize(vstiffness.size());
+    for (size_t ik = 0; ik < vstiffness.size(); ik++)
+        kmap.kdata[ik] = vstiffness[ik]->Get_K().data();
+
+    double* values = Z.valuePtr();
+    int nnz = (int)kmap.start.size() - 1;
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int k = 0; k < nnz; k++) {
+        double val = values[k];
+        for (int j = kmap.start[k]; j < kmap.start[k + 1]; j++)
+            val += kmap.kdata[kmap.src_block[j]][kmap.src_index[j]];
+        values[k] = val;
+    }
+
+    return true;
+}
+
+bool ChSystemDescriptor::BuildKblockMap(const ChSparseMatrix& Z) {
+    const int* outer = Z.outerIndexPtr();
+    const int* inner = Z.innerIndexPtr();
+
+    // Locate the nonzero of Z for each entry of all K blocks
+    std::vector<int> slot;
+    std::vector<int> count(Z.nonZeros() + 1, 0);
+    kmap.src_block.clear();
+    kmap.src_index.clear();
+
+    for (int ik = 0; ik < (int)vstiffness.size(); ik++) {
+        auto kblock = static_cast<ChKblockGeneric*>(vstiffness[ik]);
+        auto K = kblock->Get_K();
+        if (K.rows() == 0)
+            continue;
+
+        int kio = 0;
+        for (unsigned int iv = 0; iv < kblock->GetNvars(); iv++) {
+            int io = kblock->GetVariableN(iv)->GetOffset();
+            int in = kblock->GetVariableN(iv)->Get_ndof();
+            if (kblock->GetVariableN(iv)->IsActive()) {
+                int kjo = 0;
+                for (unsigned int jv = 0; jv < kblock->GetNvars(); jv++) {
+                    int jo = kblock->GetVariableN(jv)->GetOffset();
+                    int jn = kblock->GetVariableN(jv)->Get_ndof();
+                    if (kblock->GetVariableN(jv)->IsActive()) {
+                        for (int r = 0; r < in; r++) {
+                            const int* first = inner + outer[io + r];
+                            const int* last = inner + outer[io + r + 1];
+                            for (int c = 0; c < jn; c++) {
+                                const int* pos = std::lower_bound(first, last, jo + c);
+                                if (pos == last || *pos != jo + c)
+                                    return false;
+                                int k = (int)(pos - inner);
+                                slot.push_back(k);
+                                count[k + 1]++;
+                                kmap.src_block.push_back(ik);
+                                kmap.src_index.push_back((int)(&K(kio + r, kjo + c) - K.data()));
+                            }
+                        }
+                    }
+                    kjo += jn;
+                }
+            }
+            kio += in;
+        }
+    }
+
+    // Group the contributions by nonzero (stable, so that contributions are in the order of the K blocks)
+    for (size_t k = 1; k < count.size(); k++)
+        count[k] += count[k - 1];
+    kmap.start = count;
+
+    std::vector<int> src_block(slot.size());
+    std::vector<int> src_index(slot.size());
+    for (size_t j = 0; j < slot.size(); j++) {
+        int pos = count[slot[j]]++;
+        src_block[pos] = kmap.src_block[j];
+        src_index[pos] = kmap.src_index[j];
+    }
+    kmap.src_block.swap(src_block);
+    kmap.src_index.swap(src_index);
+
+    return true;
+}
+
 int ChSystemDescriptor::BuildFbVector(ChVectorDynamic<>& Fvector) {
     n_q = CountActiveVariables();
     Fvector.setZero(n_q);
@@ -496,6 +628,56 @@ void ChSystemDescriptor::ShurComplementProduct(ChVectorDynamic<>& result,
     auto vv_size = vvariables.size();
     auto vc_size = vconstraints.size();
 
+    if (nthreads > 1) {
+        n_q = CountActiveVariables();
+        int nv = (int)vv_size;
+        int nc = (int)vc_size;
+
+        // 1 - accumulate [Cq']*l in one buffer per thread (constraints processed by different threads
+        //     may act on the same variables)
+        qbuffers.resize(nthreads);
+        for (auto& buffer : qbuffers)
+            buffer.setZero(n_q);
+
+#pragma omp parallel num_threads(nthreads)
+        {
+            auto& buffer = qbuffers[ChOMP::GetThreadNum()];
+#pragma omp for schedule(static)
+            for (int ic = 0; ic < nc; ic++) {
+                if (vconstraints[ic]->IsActive()) {
+                    int s_c = vconstraints[ic]->GetOffset();
+                    if ((!enabled) || (*enabled)[s_c])
+                        vconstraints[ic]->MultiplyTandAdd(buffer, lvector(s_c));
+                }
+            }
+        }
+
+        // 2 - reduce the buffers and set qb=[M^(-1)][Cq']*l, in parallel over variables
+        auto& w = qbuffers[0];
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+        for (int iv = 0; iv < nv; iv++) {
+            if (vvariables[iv]->IsActive()) {
+                int offset = vvariables[iv]->GetOffset();
+                int ndof = vvariables[iv]->Get_ndof();
+                for (int it = 1; it < nthreads; it++)
+                    w.segment(offset, ndof) += qbuffers[it].segment(offset, ndof);
+                vvariables[iv]->Compute_invMb_v(vvariables[iv]->Get_qb(), w.segment(offset, ndof));
+            }
+        }
+
+        // 3 - set result=[Cq]*qb + [E]*l, in parallel over constraints
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+        for (int ic = 0; ic < nc; ic++) {
+            if (vconstraints[ic]->IsActive()) {
+                int s_c = vconstraints[ic]->GetOffset();
+                if ((!enabled) || (*enabled)[s_c])
+                    result(s_c) = vconstraints[ic]->Get_cfm_i() * lvector(s_c) + vconstraints[ic]->Compute_Cq_q();
+            }
+        }
+
+        return;
+    }
+
     // 1 - set the qb vector (aka speeds, in each ChVariable sparse data) as zero
 
     for (size_t iv = 0; iv < vv_size; iv++) {
@@ -584,7 +766,82 @@ void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVector
     }
 }
 
+void ChSystemDescriptor::ShurBvectorCompute(ChVectorDynamic<>& Bvector) {
+    // Start from the 'b' vector (b_i = -c = phi/h)
+    BuildBiVector(Bvector);
+
+    int nv = (int)vvariables.size();
+    int nc = (int)vconstraints.size();
+
+    // Put (M^-1)*k in the q sparse vector of each variable...
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int iv = 0; iv < nv; iv++) {
+        if (vvariables[iv]->IsActive())
+            vvariables[iv]->Compute_invMb_v(vvariables[iv]->Get_qb(), vvariables[iv]->Get_fb());  // q = [M]'*fb
+    }
+
+    // ...and then do b_shur = - b_i - D'*q = - b_i - D'*(M^-1)*k
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ic = 0; ic < nc; ic++) {
+        if (vconstraints[ic]->IsActive()) {
+            int s_c = vconstraints[ic]->GetOffset();
+            Bvector(s_c) = -Bvector(s_c) - vconstraints[ic]->Compute_Cq_q();
+        }
+    }
+}
+
+void ChSystemDescriptor::UpdateConstraintsAuxiliary() {
+    int nc = (int)vconstraints.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ic = 0; ic < nc; ic++)
+        vconstraints[ic]->Update_auxiliary();
+}
+
+// Check if a constraint is projected by a preceding contact constraint (tangential and rolling components of a contact
+// are inserted right after the normal component, which projects all of them).
+static bool IsProjectedWithContact(ChConstraint* constraint) {
+    return dynamic_cast<ChConstraintTwoTuplesFrictionTall*>(constraint) ||
+           dynamic_cast<ChConstraintTwoTuplesRollingNall*>(constraint) ||
+           dynamic_cast<ChConstraintTwoTuplesRollingTall*>(constraint);
+}
+
 void ChSystemDescriptor::ConstraintsProject(ChVectorDynamic<>& multipliers) {
+    if (nthreads > 1) {
+        n_c = CountActiveConstraints();
+        assert(n_c == multipliers.size());
+
+        // Split the constraints in contiguous ranges, one per thread, without separating the components of a contact
+        int nc = (int)vconstraints.size();
+        std::vector<int> start(nthreads + 1);
+        start[0] = 0;
+        start[nthreads] = nc;
+        for (int it = 1; it < nthreads; it++) {
+            int ic = std::max(start[it - 1], (int)((long long)nc * it / nthreads));
+            while (ic < nc && IsProjectedWithContact(vconstraints[ic]))
+                ic++;
+            start[it] = ic;
+        }
+
+#pragma omp parallel for schedule(static, 1) num_threads(nthreads)
+        for (int it = 0; it < nthreads; it++) {
+            for (int ic = start[it]; ic < start[it + 1]; ic++) {
+                if (vconstraints[ic]->IsActive())
+                    vconstraints[ic]->Set_l_i(multipliers(vconstraints[ic]->GetOffset()));
+            }
+            for (int ic = start[it]; ic < start[it + 1]; ic++) {
+                if (vconstraints[ic]->IsActive())
+                    vconstraints[ic]->Project();
+            }
+            for (int ic = start[it]; ic < start[it + 1]; ic++) {
+                if (vconstraints[ic]->IsActive())
+                    multipliers(vconstraints[ic]->GetOffset()) = vconstraints[ic]->Get_l_i();
+            }
+        }
+
+        return;
+    }
+
     FromVectorToConstraints(multipliers);
 
     auto vc_size = vconstraints.size();
@@ -15,6 +15,7 @@
 #ifndef CHSYSTEMDESCRIPTOR_H
 #define CHSYSTEMDESCRIPTOR_H
 
+#include <algorithm>
 #include <vector>
 
 #include "chrono/solver/ChConstraint.h"
@@ -82,6 +83,27 @@ class ChApi ChSystemDescriptor {
     int n_c;            ///< number of active constraints
     bool freeze_count;  ///< for optimization: avoid to re-count the number of active variables and constraints
 
+    int nthreads;  ///< number of OpenMP threads used for K block assembly and for matrix-free operations on constraints
+
+    std::vector<ChVectorDynamic<>> qbuffers;  ///< per-thread accumulation buffers for ShurComplementProduct()
+
+    /// Cached map for adding the K blocks to a compressed system matrix with a given sparsity pattern.
+    /// Each nonzero of the system matrix gathers its contributions from the K blocks, so that the nonzeros can be
+    /// processed in parallel, without race conditions.
+    struct KblockMap {
+        bool valid;                         ///< true if the map can be used for the current topology and pattern
+        std::vector<ChKblock*> blocks;      ///< K blocks at map construction
+        std::vector<int> signature;         ///< K block sizes and variable offsets at map construction
+        std::vector<int> outer;             ///< matrix outer indices at map construction
+        std::vector<int> inner;             ///< matrix inner indices at map construction
+        std::vector<int> start;             ///< start of the contributions to each nonzero
+        std::vector<int> src_block;         ///< source K block of each contribution
+        std::vector<int> src_index;         ///< index in the K block data of each contribution
+        std::vector<const double*> kdata;   ///< scratch vector with the data of all K blocks
+        std::vector<int> scratch;           ///< scratch vector for the current K block signature
+    };
+    KblockMap kmap;
+
   public:
     /// Constructor
     ChSystemDescriptor();
@@ -146,6 +168,19 @@ class ChApi ChSystemDescriptor {
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual double GetMassFactor() { return c_a; }
 
+    /// Set the number of OpenMP threads used when assembling the system matrix (default: 1).
+    /// When ConvertToMatrixForm() is called with a compressed system matrix whose sparsity pattern includes all
+    /// entries of the K blocks (e.g., with a locked sparsity pattern in a direct solver), the K blocks are added to the
+    /// matrix in parallel, using a map from K block entries to matrix nonzeros. This map is constructed at the first
+    /// such call and is reused as long as the K blocks, their variable offsets, and the matrix sparsity pattern do not
+    /// change. Otherwise, the K blocks are added to the matrix sequentially.
+    /// The same number of threads is used by the operations on constraints required by the VI solvers (see
+    /// ShurComplementProduct(), ShurBvectorCompute(), ConstraintsProject(), and UpdateConstraintsAuxiliary()).
+    void SetNumThreads(int num_threads) { nthreads = std::max(1, num_threads); }
+
+    /// Get the number of OpenMP threads used when assembling the system matrix and operating on constraints.
+    int GetNumThreads() const { return nthreads; }
+
     // DATA <-> MATH.VECTORS FUNCTIONS
 
     /// Get a vector with all the 'fb' known terms ('forces'etc.) associated to all variables,
@@ -255,12 +290,26 @@ class ChApi ChSystemDescriptor {
     /// NOTE! currently this function does NOT support the cases that use also ChKblock
     /// objects, because it would need to invert the global M+K, that is not diagonal,
     /// for doing = [N]*l = [ [Cq][(M+K)^(-1)][Cq'] - [E] ] * l
+    /// With more than one thread (see SetNumThreads), the product is evaluated in parallel over constraints, using
+    /// one accumulation buffer per thread for [Cq']*l.
     virtual void ShurComplementProduct(
         ChVectorDynamic<>& result,            ///< result of  N * l_i
         const ChVectorDynamic<>& lvector,     ///< vector to be multiplied
         std::vector<bool>* enabled = nullptr  ///< optional: vector of "enabled" flags, one per scalar constraint.
     );
 
+    /// Compute the right-hand side of the Shur complement equation N*l = b_shur, with flipped sign of multipliers:
+    /// <pre>
+    ///    b_shur = - b - [Cq][M^(-1)]*k
+    /// </pre>
+    /// NOTE! the 'q' data in the ChVariables of the system descriptor is set to [M^(-1)]*k by this operation.
+    virtual void ShurBvectorCompute(ChVectorDynamic<>& Bvector  ///< system-level vector 'b_shur'
+    );
+
+    /// Update the auxiliary data in all constraints, i.e. g_i=[Cq_i]*[invM_i]*[Cq_i]' and [Eq_i]=[invM_i]*[Cq_i]'.
+    /// This is done in parallel over constraints if more than one thread is used (see SetNumThreads).
+    virtual void UpdateConstraintsAuxiliary();
+
     /// Performs the product of the entire system matrix (KKT matrix), by a vector x ={q,l}.
     /// Note that the 'q' data in the ChVariables of the system descriptor is changed by this
     /// operation, so thay may need to be backed up via FromVariablesToVector()
@@ -274,6 +323,8 @@ class ChApi ChSystemDescriptor {
     /// Note! the 'l_i' data in the ChConstraints of the system descriptor are changed
     /// by this operation (they get the value of 'multipliers' after the projection), so
     /// it may happen that you need to backup them via FromConstraintToVector().
+    /// With more than one thread (see SetNumThreads), the constraints are projected in parallel, over contiguous ranges
+    /// that do not separate the normal, tangential, and rolling constraints of a contact.
     virtual void ConstraintsProject(
         ChVectorDynamic<>& multipliers  ///< system-level vector of 'l_i' multipliers to be projected
     );
@@ -364,6 +415,15 @@ class ChApi ChSystemDescriptor {
         // deserialize parent class
         // stream in all member data:
     }
+
+  private:
+    /// Add the K blocks to the compressed matrix Z in parallel, using the K block map (reconstructed if needed).
+    /// Return false if the map cannot be used for Z, in which case Z is not modified.
+    bool AddKblocksMapped(ChSparseMatrix& Z);
+
+    /// Construct the K block map for the current K blocks and the sparsity pattern of Z.
+    /// Return false if some K block entries are not in the sparsity pattern of Z.
+    bool BuildKblockMap(const ChSparseMatrix& Z);
 };
 
 CH_CLASS_VERSION(ChSystemDescriptor, 0)
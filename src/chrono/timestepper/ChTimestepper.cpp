@@ -446,10 +446,16 @@ void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
 
     L *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
 
-    mintegrable->StateScatterAcceleration(
-        (V - Vold) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+    // Acceleration as measure (fits DVI/MDI), evaluated in place in Vold to avoid temporaries
+    Vold.ChVectorDynamic<>::operator-=(V);
+    Vold.ChVectorDynamic<>::operator*=(-1 / dt);
+    mintegrable->StateScatterAcceleration(Vold);  // -> system auxiliary data
 
-    X += V * dt;
+    // Position update X += V * dt, recycling Vold as the position increment
+    Vold = V;
+    Vold.ChVectorDynamic<>::operator*=(dt);
+    Xold = X;
+    mintegrable->StateIncrementX(X, Xold, Vold);
 
     T += dt;
 
@@ -509,10 +515,16 @@ void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
 
     L *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
 
-    mintegrable->StateScatterAcceleration(
-        (V - Vold) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+    // Acceleration as measure (fits DVI/MDI), evaluated in place in Vold to avoid temporaries
+    Vold.ChVectorDynamic<>::operator-=(V);
+    Vold.ChVectorDynamic<>::operator*=(-1 / dt);
+    mintegrable->StateScatterAcceleration(Vold);  // -> system auxiliary data
 
-    X += V * dt;
+    // Position update X += V * dt, recycling Vold as the position increment
+    Vold = V;
+    Vold.ChVectorDynamic<>::operator*=(dt);
+    Xold = X;
+    mintegrable->StateIncrementX(X, Xold, Vold);
 
     T += dt;
 
@@ -545,7 +557,9 @@ void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
         true                            // force a call to the solver's Setup() function
     );
 
-    X += Vold;  // here we used 'Vold' as 'dpos' to recycle Vold and avoid allocating a new vector dpos
+    // here we used 'Vold' as 'dpos' to recycle Vold and avoid allocating a new vector dpos
+    Xold = X;
+    mintegrable->StateIncrementX(X, Xold, Vold);
 
     mintegrable->StateScatter(X, V, T, true);  // state -> system
 }
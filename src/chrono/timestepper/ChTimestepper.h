@@ -386,6 +386,7 @@ class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChI
 class ChApi ChTimestepperEulerImplicitLinearized : public ChTimestepperIIorder, public ChImplicitTimestepper {
   protected:
     ChStateDelta Vold;
+    ChState Xold;  ///< copy of the state before the position update (avoids temporaries)
     ChVectorDynamic<> Dl;
     ChVectorDynamic<> R;
     ChVectorDynamic<> Qc;
@@ -410,6 +411,7 @@ class ChApi ChTimestepperEulerImplicitLinearized : public ChTimestepperIIorder,
 class ChApi ChTimestepperEulerImplicitProjected : public ChTimestepperIIorder, public ChImplicitTimestepper {
   protected:
     ChStateDelta Vold;
+    ChState Xold;  ///< copy of the state before the position update (avoids temporaries)
     ChVectorDynamic<> Dl;
     ChVectorDynamic<> R;
     ChVectorDynamic<> Qc;
@@ -36,6 +36,8 @@ CODE MODIFIED FROM:
 //To disable built-in profiling, please comment out next line
 //#define CH_NO_PROFILE 1
 
+#include "chrono/utils/ChTraceProfiler.h"
+
 #ifndef CH_NO_PROFILE
 
 #include <cstdio>
@@ -171,17 +173,37 @@ public:
 	}
 };
 
+///Profile sample that is also recorded as a zone of the trace profiler (see ChTraceProfiler).
+///Used by the CH_PROFILE macro, so that a single object is declared in the profiled scope.
+class  ChApi  CProfileTraceSample {
+public:
+	CProfileTraceSample( const char * name ) : m_sample( name )
+#ifdef CHRONO_TRACE_PROFILER
+		, m_zone( name )
+#endif
+	{
+	}
+
+private:
+	CProfileSample m_sample;
+#ifdef CHRONO_TRACE_PROFILER
+	ChTraceZone m_zone;
+#endif
+};
+
 
 
 }  // end namespace utils
 }  // end namespace chrono
 
 
-#define	CH_PROFILE( name )			chrono::utils::CProfileSample __ch_profile( name )
+// Legacy profile samples are also recorded as zones of the trace profiler (see ChTraceProfiler).
+// Note that CH_PROFILE must only be used on the main thread; use CH_PROFILE_ZONE in multithreaded code.
+#define	CH_PROFILE( name )			chrono::utils::CProfileTraceSample __ch_profile( name )
 
 #else
 
-#define	CH_PROFILE( name )
+#define	CH_PROFILE( name )			CH_PROFILE_ZONE( name )
 
 #endif //#ifndef CH_NO_PROFILE
 
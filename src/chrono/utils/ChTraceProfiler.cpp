@@ -0,0 +1,153 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Scoped-zone trace profiler with per-thread event buffers and export to the
+// Chrome trace event format.
+//
+// =============================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "chrono/utils/ChTraceProfiler.h"
+
+namespace chrono {
+namespace utils {
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    int64_t start;
+    int64_t end;
+};
+
+// Event ring buffer of a single thread.
+// Only the owner thread writes to the buffer; the number of recorded events is atomic so that it can be safely read
+// (e.g., during export) after the owner thread stopped recording.
+struct ThreadBuffer {
+    ThreadBuffer(int id, size_t capacity) : id(id), events(capacity), count(0) {}
+    int id;
+    std::vector<TraceEvent> events;
+    std::atomic<uint64_t> count;
+};
+
+// Global profiler state.
+// The registry owns the buffers of all threads that recorded events, including threads that were terminated.
+struct TraceRegistry {
+    TraceRegistry() : epoch(std::chrono::steady_clock::now()), buffer_size(65536) {}
+    std::chrono::steady_clock::time_point epoch;
+    size_t buffer_size;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+TraceRegistry& GetRegistry() {
+    static TraceRegistry registry;
+    return registry;
+}
+
+ThreadBuffer* GetThreadBuffer() {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.buffers.emplace_back(new ThreadBuffer((int)registry.buffers.size(), registry.buffer_size));
+        buffer = registry.buffers.back().get();
+    }
+    return buffer;
+}
+
+// Write a zone name as a JSON string (names are expected to be plain identifiers).
+void WriteJSONString(FILE* file, const char* str) {
+    fputc('"', file);
+    for (const char* c = str; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            fputc('\\', file);
+        if ((unsigned char)*c >= 0x20)
+            fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+}  // end namespace
+
+std::atomic<bool> ChTraceProfiler::m_enabled(false);
+
+void ChTraceProfiler::Enable(bool val) {
+    // Make sure the time origin is set before any events are recorded
+    GetRegistry();
+    m_enabled.store(val);
+}
+
+void ChTraceProfiler::SetBufferSize(size_t num_events) {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.buffer_size = num_events > 0 ? num_events : 1;
+}
+
+void ChTraceProfiler::Reset() {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& buffer : registry.buffers)
+        buffer->count.store(0);
+}
+
+int64_t ChTraceProfiler::Now() {
+    auto elapsed = std::chrono::steady_clock::now() - GetRegistry().epoch;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+void ChTraceProfiler::Record(const char* name, int64_t start, int64_t end) {
+    auto buffer = GetThreadBuffer();
+    auto count = buffer->count.load(std::memory_order_relaxed);
+    buffer->events[count % buffer->events.size()] = {name, start, end};
+    buffer->count.store(count + 1, std::memory_order_release);
+}
+
+bool ChTraceProfiler::ExportChromeTrace(const std::string& filename) {
+    FILE* file = fopen(filename.c_str(), "w");
+    if (!file)
+        return false;
+
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // Complete ("X") events, with times in microseconds.
+    // Events are written in the order in which they were recorded (i.e., in order of zone end times, per thread).
+    fprintf(file, "{\"traceEvents\":[\n");
+    bool first = true;
+    for (const auto& buffer : registry.buffers) {
+        uint64_t count = buffer->count.load(std::memory_order_acquire);
+        uint64_t capacity = buffer->events.size();
+        uint64_t begin = count > capacity ? count - capacity : 0;
+        for (uint64_t i = begin; i < count; i++) {
+            const auto& event = buffer->events[i % capacity];
+            fprintf(file, first ? "{\"name\":" : ",\n{\"name\":");
+            WriteJSONString(file, event.name);
+            fprintf(file, ",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", buffer->id,
+                    event.start * 1e-3, (event.end - event.start) * 1e-3);
+            first = false;
+        }
+    }
+    fprintf(file, "\n],\n\"displayTimeUnit\":\"ns\"}\n");
+
+    bool success = !ferror(file);
+    fclose(file);
+    return success;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,112 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Scoped-zone trace profiler with per-thread event buffers and export to the
+// Chrome trace event format.
+//
+// =============================================================================
+
+#ifndef CH_TRACE_PROFILER_H
+#define CH_TRACE_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "chrono/ChConfig.h"
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Scoped-zone trace profiler.
+/// A zone is a named code region, marked with the CH_PROFILE_ZONE macro, which records its start and end times (in
+/// nanoseconds) when the zone scope is exited. Each thread records its zones in its own fixed-size ring buffer (no
+/// locking), so that zones can be used in multithreaded code; once a buffer is full, the oldest events are
+/// overwritten. Recording is disabled by default; when disabled, the cost of a zone is a single flag test.
+/// The zone instrumentation is only compiled if the CMake option ENABLE_TRACE_PROFILER is enabled (default: OFF);
+/// otherwise, CH_PROFILE_ZONE expands to nothing.
+///
+/// The recorded events can be exported to a JSON file in the Chrome trace event format, which can be loaded in
+/// chrome://tracing or https://ui.perfetto.dev to display a per-thread timeline of all zones.
+class ChApi ChTraceProfiler {
+  public:
+    /// Enable or disable recording of zone events (default: disabled).
+    static void Enable(bool val);
+
+    /// Return true if recording of zone events is enabled.
+    static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Set the capacity (number of events) of the per-thread ring buffers (default: 65536).
+    /// This function should be called before recording is enabled; it only affects buffers of threads that did not
+    /// record any events yet.
+    static void SetBufferSize(size_t num_events);
+
+    /// Discard all recorded events.
+    /// This function must not be called while other threads are recording events.
+    static void Reset();
+
+    /// Export all recorded events to the specified file, in the Chrome trace event format.
+    /// This function must not be called while other threads are recording events.
+    /// Return false if the file could not be written.
+    static bool ExportChromeTrace(const std::string& filename);
+
+    /// Return the current time, in nanoseconds since the profiler start.
+    static int64_t Now();
+
+    /// Record a zone event for the calling thread.
+    /// The zone name is not copied and must remain valid until the events are exported (e.g., a string literal).
+    static void Record(const char* name, int64_t start, int64_t end);
+
+  private:
+    static std::atomic<bool> m_enabled;
+};
+
+/// Scoped profiler zone.
+/// Records a zone event with the lifetime of this object, if recording is enabled at construction.
+class ChApi ChTraceZone {
+  public:
+    ChTraceZone(const char* name) : m_name(nullptr), m_start(0) {
+        if (ChTraceProfiler::IsEnabled()) {
+            m_name = name;
+            m_start = ChTraceProfiler::Now();
+        }
+    }
+
+    ~ChTraceZone() {
+        if (m_name)
+            ChTraceProfiler::Record(m_name, m_start, ChTraceProfiler::Now());
+    }
+
+  private:
+    const char* m_name;
+    int64_t m_start;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#define CH_TRACE_CONCAT_IMPL(a, b) a##b
+#define CH_TRACE_CONCAT(a, b) CH_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef CHRONO_TRACE_PROFILER
+    #define CH_PROFILE_ZONE(name) chrono::utils::ChTraceZone CH_TRACE_CONCAT(ch_trace_zone_, __LINE__)(name)
+#else
+    #define CH_PROFILE_ZONE(name)
+#endif
+
+#endif
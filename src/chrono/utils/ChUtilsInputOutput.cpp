@@ -14,6 +14,24 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/assets/ChCapsuleShape.h"
 #include "chrono/assets/ChConeShape.h"
@@ -26,6 +44,7 @@
 #include "chrono/assets/ChSphereShape.h"
 #include "chrono/assets/ChTriangleMeshShape.h"
 #include "chrono/geometry/ChLineBezier.h"
+#include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
 
 namespace chrono {
@@ -294,6 +313,307 @@ void ReadCheckpoint(ChSystem* system, const std::string& filename) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// WriteBinaryCheckpoint and ReadBinaryCheckpoint
+//
+// A binary checkpoint file consists of a fixed-size header followed by the
+// arrays x, v, a, and L (as double values, in native byte order), by the
+// rotation derivatives of all bodies (4+4 double values per body), and by the
+// reactions of the NSC contacts between bodies.
+//
+// The rotation derivatives are needed for an exact restart: a body stores the
+// derivatives of its rotation quaternion, while the state includes its angular
+// velocity and acceleration, and the conversion between the two is not exact
+// in floating point arithmetic.
+//
+// The contact reactions are used to warm start the solver at the first step
+// after a restart. Contacts are regenerated at that step; the saved reactions
+// are matched to them by pair of bodies (identified by their index in the
+// system), in the order in which contacts are generated.
+// -----------------------------------------------------------------------------
+
+static const char checkpoint_magic[8] = {'C', 'H', 'C', 'K', 'P', 'T', '\0', '\0'};
+static const uint32_t checkpoint_version = 2;
+static const uint32_t checkpoint_byte_order = 0x01020304;
+
+struct CheckpointHeader {
+    char magic[8];          // file type identifier
+    uint32_t version;       // format version
+    uint32_t byte_order;    // byte order marker, as written
+    int32_t num_bodies;     // number of bodies (including fixed and sleeping)
+    int32_t num_links;      // number of links
+    int32_t num_shafts;     // number of shafts (including fixed and sleeping)
+    int32_t num_meshes;     // number of FEA meshes
+    int32_t num_items;      // number of other physics items
+    int32_t num_contacts;   // number of saved contact reactions
+    int64_t nx;             // size of position-level state
+    int64_t nv;             // size of velocity-level state
+    int64_t nL;             // total number of Lagrange multipliers
+    int64_t nL_contacts;    // number of contact multipliers (last block of L)
+    double time;            // simulation time
+};
+
+struct CheckpointContact {
+    int32_t bodyA;        // index of the first body in contact
+    int32_t bodyB;        // index of the second body in contact
+    float reactions[3];   // contact reactions, in contact coordinates
+    float padding;        // unused
+};
+
+static_assert(sizeof(CheckpointHeader) % sizeof(double) == 0, "CheckpointHeader size must be a multiple of 8");
+static_assert(sizeof(CheckpointContact) % sizeof(double) == 0, "CheckpointContact size must be a multiple of 8");
+
+// Fill in the header fields that characterize the given system.
+static void CheckpointSystemInfo(ChSystem* system, CheckpointHeader& header) {
+    header.num_bodies = system->GetNbodiesTotal();
+    header.num_links = system->GetNlinks();
+    header.num_shafts = system->GetNshaftsTotal();
+    header.num_meshes = system->GetNmeshes();
+    header.num_items = system->GetNphysicsItems();
+    header.nx = system->GetNcoords_x();
+    header.nv = system->GetNcoords_w();
+    header.nL = system->GetNconstr();
+    header.nL_contacts = system->GetContactContainer()->GetDOC();
+}
+
+// Read-only memory mapping of an entire file.
+class MappedFile {
+  public:
+    MappedFile(const std::string& filename) : m_data(nullptr), m_size(0) {
+#ifdef _WIN32
+        m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL, NULL);
+        m_mapping = NULL;
+        if (m_file == INVALID_HANDLE_VALUE)
+            return;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+            return;
+        m_mapping = CreateFileMappingA(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (m_mapping == NULL)
+            return;
+        void* data = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == NULL)
+            return;
+        m_data = static_cast<const char*>(data);
+        m_size = (size_t)size.QuadPart;
+#else
+        m_fd = open(filename.c_str(), O_RDONLY);
+        if (m_fd < 0)
+            return;
+        struct stat st;
+        if (fstat(m_fd, &st) != 0 || st.st_size == 0)
+            return;
+        void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+        if (data == MAP_FAILED)
+            return;
+        m_data = static_cast<const char*>(data);
+        m_size = (size_t)st.st_size;
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping != NULL)
+            CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE)
+            CloseHandle(m_file);
+#else
+        if (m_data)
+            munmap(const_cast<char*>(m_data), m_size);
+        if (m_fd >= 0)
+            close(m_fd);
+#endif
+    }
+
+    const char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+  private:
+    const char* m_data;
+    size_t m_size;
+#ifdef _WIN32
+    HANDLE m_file;
+    HANDLE m_mapping;
+#else
+    int m_fd;
+#endif
+};
+
+bool WriteBinaryCheckpoint(ChSystem* system, const std::string& filename) {
+    // Make sure all counts and offsets are up to date
+    system->Setup();
+
+    CheckpointHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+    header.version = checkpoint_version;
+    header.byte_order = checkpoint_byte_order;
+    CheckpointSystemInfo(system, header);
+
+    // Gather the system states and multipliers
+    ChState x((Eigen::Index)header.nx, system);
+    ChStateDelta v((Eigen::Index)header.nv, system);
+    ChStateDelta a((Eigen::Index)header.nv, system);
+    ChVectorDynamic<> L((Eigen::Index)header.nL);
+    system->StateGather(x, v, header.time);
+    system->StateGatherAcceleration(a);
+    system->StateGatherReactions(L);
+
+    // Collect the reactions of contacts between bodies
+    std::vector<CheckpointContact> contacts;
+    if (auto container = std::dynamic_pointer_cast<ChContactContainerNSC>(system->GetContactContainer())) {
+        std::unordered_map<collision::ChCollisionModel*, int32_t> body_index;
+        int32_t index = 0;
+        for (const auto& body : system->Get_bodylist())
+            body_index[body->GetCollisionModel().get()] = index++;
+
+        std::vector<ChContactContainerNSC::ContactReactions> reactions;
+        container->GetContactReactions(reactions);
+        for (const auto& r : reactions) {
+            auto bodyA = body_index.find(r.modelA);
+            auto bodyB = body_index.find(r.modelB);
+            if (bodyA == body_index.end() || bodyB == body_index.end())
+                continue;
+            CheckpointContact contact;
+            contact.bodyA = bodyA->second;
+            contact.bodyB = bodyB->second;
+            std::copy(r.reactions, r.reactions + 3, contact.reactions);
+            contact.padding = 0;
+            contacts.push_back(contact);
+        }
+    }
+    header.num_contacts = (int32_t)contacts.size();
+
+    std::ofstream ofile(filename, std::ios::binary);
+    if (!ofile) {
+        std::cout << "utils::WriteBinaryCheckpoint ERROR: cannot open file " << filename << "\n";
+        return false;
+    }
+
+    ofile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofile.write(reinterpret_cast<const char*>(x.data()), x.size() * sizeof(double));
+    ofile.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(double));
+    ofile.write(reinterpret_cast<const char*>(a.data()), a.size() * sizeof(double));
+    ofile.write(reinterpret_cast<const char*>(L.data()), L.size() * sizeof(double));
+    for (const auto& body : system->Get_bodylist()) {
+        ofile.write(reinterpret_cast<const char*>(body->GetRot_dt().data()), 4 * sizeof(double));
+        ofile.write(reinterpret_cast<const char*>(body->GetRot_dtdt().data()), 4 * sizeof(double));
+    }
+    for (const auto& contact : contacts)
+        ofile.write(reinterpret_cast<const char*>(&contact), sizeof(contact));
+
+    if (!ofile) {
+        std::cout << "utils::WriteBinaryCheckpoint ERROR: failed writing file " << filename << "\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool ReadBinaryCheckpoint(ChSystem* system, const std::string& filename) {
+    MappedFile file(filename);
+    if (!file.data() || file.size() < sizeof(CheckpointHeader)) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: cannot read file " << filename << "\n";
+        return false;
+    }
+
+    // The header is at the start of the mapping (page-aligned)
+    CheckpointHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) != 0 ||
+        header.byte_order != checkpoint_byte_order) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: " << filename << " is not a binary checkpoint file\n";
+        return false;
+    }
+    if (header.version != checkpoint_version) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: unsupported checkpoint version " << header.version << "\n";
+        return false;
+    }
+    size_t num_values = (size_t)(header.nx + 2 * header.nv + header.nL + 8 * header.num_bodies);
+    if (header.num_contacts < 0 ||
+        file.size() != sizeof(CheckpointHeader) + num_values * sizeof(double) +
+                           (size_t)header.num_contacts * sizeof(CheckpointContact)) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: checkpoint file " << filename << " is truncated\n";
+        return false;
+    }
+
+    // Check consistency with the current system.
+    // Contacts are not part of the system configuration and are not restored.
+    system->Setup();
+    CheckpointHeader current;
+    CheckpointSystemInfo(system, current);
+    if (header.num_bodies != current.num_bodies || header.num_links != current.num_links ||
+        header.num_shafts != current.num_shafts || header.num_meshes != current.num_meshes ||
+        header.num_items != current.num_items || header.nx != current.nx || header.nv != current.nv ||
+        header.nL - header.nL_contacts != current.nL - current.nL_contacts) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: checkpoint data file inconsistent with the Chrono system\n";
+        std::cout << "    Bodies: " << header.num_bodies << " / " << current.num_bodies << "\n";
+        std::cout << "    Links:  " << header.num_links << " / " << current.num_links << "\n";
+        std::cout << "    Shafts: " << header.num_shafts << " / " << current.num_shafts << "\n";
+        std::cout << "    Meshes: " << header.num_meshes << " / " << current.num_meshes << "\n";
+        std::cout << "    Items:  " << header.num_items << " / " << current.num_items << "\n";
+        std::cout << "    States: " << header.nx << ", " << header.nv << " / " << current.nx << ", " << current.nv
+                  << "\n";
+        return false;
+    }
+
+    // Load the state arrays from the mapped file
+    const double* values = reinterpret_cast<const double*>(file.data() + sizeof(CheckpointHeader));
+    ChState x((Eigen::Index)header.nx, system);
+    ChStateDelta v((Eigen::Index)header.nv, system);
+    ChStateDelta a((Eigen::Index)header.nv, system);
+    ChVectorDynamic<> L((Eigen::Index)current.nL);
+    std::memcpy(x.data(), values, header.nx * sizeof(double));
+    values += header.nx;
+    std::memcpy(v.data(), values, header.nv * sizeof(double));
+    values += header.nv;
+    std::memcpy(a.data(), values, header.nv * sizeof(double));
+    values += header.nv;
+    L.setZero();
+    std::memcpy(L.data(), values, (header.nL - header.nL_contacts) * sizeof(double));
+    values += header.nL;
+
+    // Scatter to the system
+    system->StateScatter(x, v, header.time, false);
+    system->StateScatterAcceleration(a);
+    system->StateScatterReactions(L);
+
+    // Overwrite the body rotation derivatives and perform a full update of all physics items
+    for (const auto& body : system->Get_bodylist()) {
+        body->SetRot_dt(ChQuaternion<>(values[0], values[1], values[2], values[3]));
+        body->SetRot_dtdt(ChQuaternion<>(values[4], values[5], values[6], values[7]));
+        values += 8;
+    }
+    system->Update(true);
+
+    // Set the contact reactions used to warm start the contacts generated at the next step
+    if (auto container = std::dynamic_pointer_cast<ChContactContainerNSC>(system->GetContactContainer())) {
+        const auto& bodies = system->Get_bodylist();
+        std::vector<ChContactContainerNSC::ContactReactions> reactions;
+        for (int32_t i = 0; i < header.num_contacts; i++) {
+            CheckpointContact contact;
+            std::memcpy(&contact, reinterpret_cast<const char*>(values) + i * sizeof(CheckpointContact),
+                        sizeof(contact));
+            if (contact.bodyA < 0 || contact.bodyA >= header.num_bodies || contact.bodyB < 0 ||
+                contact.bodyB >= header.num_bodies) {
+                std::cout << "utils::ReadBinaryCheckpoint ERROR: invalid contact data in " << filename << "\n";
+                return false;
+            }
+            ChContactContainerNSC::ContactReactions r;
+            r.modelA = bodies[contact.bodyA]->GetCollisionModel().get();
+            r.modelB = bodies[contact.bodyB]->GetCollisionModel().get();
+            std::copy(contact.reactions, contact.reactions + 3, r.reactions);
+            reactions.push_back(r);
+        }
+        container->SetContactReactions(reactions);
+    }
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Write CSV output file with current camera information
 // -----------------------------------------------------------------------------
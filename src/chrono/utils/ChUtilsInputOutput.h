@@ -25,6 +25,10 @@
 //      contact geometry.
 //    - only a subset of contact shapes are currently supported
 //
+// WriteBinaryCheckpoint and ReadBinaryCheckpoint
+//  these functions save and restore, respectively, the full state of a system
+//  (bodies, links, shafts, FEA meshes, etc.) to/from a binary file.
+//
 // WriteVisualizationAssets
 //  this function writes a CSV file appropriate for processing with a POV-Ray
 //  script.
@@ -143,6 +147,29 @@ ChApi bool WriteCheckpoint(ChSystem* system, const std::string& filename);
 /// Read a CSV file with a checkpoint.
 ChApi void ReadCheckpoint(ChSystem* system, const std::string& filename);
 
+/// Write a binary checkpoint file with the full state of the given system.
+/// The checkpoint contains the system time, the state (positions and velocities), the accelerations, and the Lagrange
+/// multipliers of all physics items in the system (bodies, links, shafts, FEA meshes, etc.), as obtained with
+/// ChSystem::StateGather, StateGatherAcceleration, and StateGatherReactions, as well as the derivatives of the rotation
+/// quaternions of all bodies (which cannot be recovered exactly from the angular velocities and accelerations). For an
+/// NSC system, the reactions of all contacts between bodies are also saved; they are used to warm start the solver at
+/// the first step after a restart. Unlike WriteCheckpoint, this function does not save the system configuration: a
+/// binary checkpoint can only be loaded in an identical system (same physics items, created in the same order).
+/// Return false if the file could not be written.
+ChApi bool WriteBinaryCheckpoint(ChSystem* system, const std::string& filename);
+
+/// Restore the state of the given system from a binary checkpoint file (see WriteBinaryCheckpoint).
+/// The file is memory-mapped and checked for consistency with the system (format version, number of physics items, and
+/// state sizes). A resumed simulation reproduces the uninterrupted one exactly if the collision system does not keep
+/// contact data between steps (e.g. ChCollisionSystemChrono; the contact manifolds of the Bullet collision system are
+/// not saved) and if the timestepper does not keep data from previous steps (e.g. the Euler implicit timesteppers).
+/// Contacts are regenerated at the next step; the saved contact reactions are passed to the contact container (see
+/// ChContactContainerNSC::SetContactReactions) and warm start the new contacts between the same pairs of bodies.
+/// With a collision system that does not keep contact data, the saved reactions are only used if the reaction cache
+/// of the contact container is enabled (see ChContactContainerNSC::EnableReactionCache), as in the uninterrupted run.
+/// Return false if the file could not be read or is inconsistent with the system.
+ChApi bool ReadBinaryCheckpoint(ChSystem* system, const std::string& filename);
+
 /// Write CSV output file with camera information for off-line visualization.
 /// The output file includes three vectors, one per line, for camera position, camera target (look-at point), and camera
 /// up vector, respectively.
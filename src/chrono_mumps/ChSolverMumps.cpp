@@ -52,6 +52,12 @@ bool ChSolverMumps::FactorizeMatrix() {
     return (mumps_err == 0);
 }
 
+bool ChSolverMumps::RefactorizeMatrix() {
+    m_engine.SetMatrix(m_mat);
+    auto mumps_err = m_engine.MumpsCall(ChMumpsEngine::mumps_JOB::FACTORIZE);
+    return (mumps_err == 0);
+}
+
 bool ChSolverMumps::SolveSystem() {
     m_sol = m_rhs;
     m_engine.SetRhsVector(m_sol);
@@ -69,6 +69,9 @@ class ChApiPardisoMKL ChSolverPardisoMKL : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Numerically refactorize the current sparse matrix, reusing the symbolic analysis of the last factorization.
+    virtual bool RefactorizeMatrix() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -33,5 +33,22 @@ float ChTerrain::GetCoefficientFriction(const ChVector<>& loc) const {
     return 0.8f;
 }
 
+void ChTerrain::GetProperties(const ChVector<>& loc, double& height, ChVector<>& normal, float& friction) const {
+    height = GetHeight(loc);
+    normal = GetNormal(loc);
+    friction = GetCoefficientFriction(loc);
+}
+
+void ChTerrain::GetProperties(const std::vector<ChVector<>>& loc,
+                              std::vector<double>& height,
+                              std::vector<ChVector<>>& normal,
+                              std::vector<float>& friction) const {
+    height.resize(loc.size());
+    normal.resize(loc.size());
+    friction.resize(loc.size());
+    for (size_t i = 0; i < loc.size(); i++)
+        GetProperties(loc[i], height[i], normal[i], friction[i]);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
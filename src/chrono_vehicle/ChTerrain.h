@@ -19,6 +19,8 @@
 #ifndef CH_TERRAIN_H
 #define CH_TERRAIN_H
 
+#include <vector>
+
 #include "chrono/core/ChVector.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -54,6 +56,24 @@ class CH_VEHICLE_API ChTerrain {
     /// with other objects (including tire models that do not explicitly use it).
     virtual float GetCoefficientFriction(const ChVector<>& loc) const;
 
+    /// Get the terrain height, normal, and coefficient of friction at the point below the specified location.
+    /// The default implementation calls GetHeight, GetNormal, and GetCoefficientFriction. Derived classes should
+    /// override this function if all three quantities can be obtained from a single query.
+    virtual void GetProperties(const ChVector<>& loc, double& height, ChVector<>& normal, float& friction) const;
+
+    /// Get the terrain heights, normals, and coefficients of friction at the points below the specified locations.
+    /// The output vectors are resized as needed. The default implementation processes one location at a time.
+    /// Derived classes may override this function to answer all queries in a single pass.
+    virtual void GetProperties(const std::vector<ChVector<>>& loc,
+                               std::vector<double>& height,
+                               std::vector<ChVector<>>& normal,
+                               std::vector<float>& friction) const;
+
+    /// Return true if the terrain query functions (GetHeight, GetNormal, GetCoefficientFriction, GetProperties) can
+    /// be called concurrently from multiple threads. If a friction functor is registered, it must then also be thread
+    /// safe. The default implementation returns false.
+    virtual bool SupportsConcurrentQueries() const { return false; }
+
     /// Class to be used as a functor interface for location-dependent coefficient of friction.
     class CH_VEHICLE_API FrictionFunctor {
       public:
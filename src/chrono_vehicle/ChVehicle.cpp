@@ -22,6 +22,7 @@
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_vehicle/ChWorldFrame.h"
 #include "chrono_vehicle/ChVehicle.h"
@@ -29,6 +30,7 @@
 #include "chrono_vehicle/ChVehicleVisualSystem.h"
 
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
+#include "chrono_vehicle/output/ChVehicleOutputColumnar.h"
 #ifdef CHRONO_HAS_HDF5
     #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 #endif
@@ -112,25 +114,34 @@ void ChVehicle::SetCollisionSystemType(collision::ChCollisionSystemType collsys_
 void ChVehicle::SetOutput(ChVehicleOutput::Type type,
                           const std::string& out_dir,
                           const std::string& out_name,
-                          double output_step) {
+                          double output_step,
+                          bool async) {
     m_output = true;
     m_output_step = output_step;
 
     switch (type) {
         case ChVehicleOutput::ASCII:
-            m_output_db = new ChVehicleOutputASCII(out_dir + "/" + out_name + ".txt");
+            m_output_db = new ChVehicleOutputASCII(out_dir + "/" + out_name + ".txt", async);
             break;
         case ChVehicleOutput::JSON:
             //// TODO
             break;
         case ChVehicleOutput::HDF5:
 #ifdef CHRONO_HAS_HDF5
-            m_output_db = new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5");
+            m_output_db = new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5", async);
 #endif
             break;
+        case ChVehicleOutput::COLUMNAR:
+            m_output_db = new ChVehicleOutputColumnar(out_dir + "/" + out_name + ".chcol", 1024, async);
+            break;
     }
 }
 
+void ChVehicle::FlushOutput() {
+    if (m_output_db)
+        m_output_db->Flush();
+}
+
 // -----------------------------------------------------------------------------
 void ChVehicle::Initialize(const ChCoordsys<>& chassisPos, double chassisFwdVel) {
     // Calculate total vehicle mass and inertia properties at initial configuration
@@ -149,6 +160,7 @@ void ChVehicle::Advance(double step) {
     }
 
     if (m_output && m_system->GetChTime() >= m_next_output_time) {
+        CH_PROFILE_ZONE("Vehicle::Output");
         Output(m_output_frame, *m_output_db);
         m_next_output_time += m_output_step;
         m_output_frame++;
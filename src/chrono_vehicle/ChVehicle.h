@@ -145,12 +145,18 @@ class CH_VEHICLE_API ChVehicle {
     void SetCollisionSystemType(collision::ChCollisionSystemType collsys_type);
 
     /// Enable output for this vehicle system.
+    /// If 'async' is true, output data is buffered and written to the output file on a background thread.
     void SetOutput(ChVehicleOutput::Type type,   ///< [int] type of output DB
                    const std::string& out_dir,   ///< [in] output directory name
                    const std::string& out_name,  ///< [in] rootname of output file
-                   double output_step            ///< [in] interval between output times
+                   double output_step,           ///< [in] interval between output times
+                   bool async = false            ///< [in] write output on a background thread
     );
 
+    /// Write all buffered output data to the output file.
+    /// This function blocks until all pending output frames were written.
+    void FlushOutput();
+
     /// Initialize this vehicle at the specified global location and orientation.
     /// Derived classes must invoke this base class implementation after they initialize all their subsystem.
     virtual void Initialize(const ChCoordsys<>& chassisPos,  ///< [in] initial global position and orientation
@@ -44,9 +44,10 @@ namespace vehicle {
 class CH_VEHICLE_API ChVehicleOutput {
   public:
     enum Type {
-        ASCII,  ///< ASCII text
-        JSON,   ///< JSON
-        HDF5    ///< HDF-5
+        ASCII,    ///< ASCII text
+        JSON,     ///< JSON
+        HDF5,     ///< HDF-5
+        COLUMNAR  ///< columnar time series (see ChVehicleOutputColumnar)
     };
 
     ChVehicleOutput() {}
@@ -65,6 +66,9 @@ class CH_VEHICLE_API ChVehicleOutput {
     virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) = 0;
     virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) = 0;
     virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) = 0;
+
+    /// Write any buffered output data to the output file.
+    virtual void Flush() {}
 };
 
 /// @} vehicle
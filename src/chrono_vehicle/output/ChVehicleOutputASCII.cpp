@@ -18,135 +18,101 @@
 
 #include <iostream>
 
-#include "chrono/physics/ChLinkLock.h"
-#include "chrono/physics/ChLinkUniversal.h"
-#include "chrono/physics/ChLinkDistance.h"
-
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
 
 namespace chrono {
 namespace vehicle {
 
-ChVehicleOutputASCII::ChVehicleOutputASCII(const std::string& filename) {
+ChVehicleOutputASCII::ChVehicleOutputASCII(const std::string& filename, bool async, int num_buffers)
+    : ChVehicleOutputBuffered(async, num_buffers) {
     m_stream.open(filename, std::ios_base::out);
 }
 
 ChVehicleOutputASCII::~ChVehicleOutputASCII() {
+    Close();
     m_stream.close();
 }
 
-void ChVehicleOutputASCII::WriteTime(int frame, double time) {
-    m_stream << "=====================================\n";
-    m_stream << "Time: " << time << std::endl;
-}
-
-void ChVehicleOutputASCII::WriteSection(const std::string& name) {
-    m_stream << "  \"" << name << "\"" << std::endl;
+void ChVehicleOutputASCII::FlushFile() {
+    m_stream.flush();
 }
 
-void ChVehicleOutputASCII::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
-    for (auto body : bodies) {
-        m_stream << "    body: " << body->GetIdentifier() << " \"" << body->GetNameString() << "\" ";
-        m_stream << body->GetPos() << " " << body->GetRot() << " ";
-        m_stream << body->GetPos_dt() << " " << body->GetWvel_par() << " ";
-        m_stream << body->GetPos_dtdt() << " " << body->GetWacc_par() << " ";
-        m_stream << std::endl;
-        //// TODO
-    }
-}
+void ChVehicleOutputASCII::WriteFrame(const ChVehicleOutputFrame& frame) {
+    m_stream << "=====================================\n";
+    m_stream << "Time: " << frame.time << std::endl;
+
+    for (int is = 0; is < frame.num_sections; is++) {
+        const auto& section = frame.sections[is];
+        m_stream << "  \"" << section.name << "\"" << std::endl;
+
+        for (const auto& body : section.bodies) {
+            m_stream << "    body: " << body.id << " \"" << body.name << "\" ";
+            m_stream << body.pos << " " << body.rot << " ";
+            m_stream << body.lin_vel << " " << body.ang_vel << " ";
+            m_stream << body.lin_acc << " " << body.ang_acc << " ";
+            m_stream << std::endl;
+        }
 
-void ChVehicleOutputASCII::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
-    for (auto body : bodies) {
-        auto& ref_pos = body->GetFrame_REF_to_abs().GetPos();
-        auto& ref_vel = body->GetFrame_REF_to_abs().GetPos_dt();
-        auto& ref_acc = body->GetFrame_REF_to_abs().GetPos_dtdt();
-
-        m_stream << "    body auxref: " << body->GetIdentifier() << " \"" << body->GetNameString() << "\" ";
-        m_stream << body->GetPos() << " " << body->GetRot() << " ";
-        m_stream << body->GetPos_dt() << " " << body->GetWvel_par() << " ";
-        m_stream << body->GetPos_dtdt() << " " << body->GetWacc_par() << " ";
-        m_stream << ref_pos << " " << ref_vel << " " << ref_acc << " ";
-        m_stream << std::endl;
-        //// TODO
-    }
-}
+        for (const auto& body : section.auxref_bodies) {
+            m_stream << "    body auxref: " << body.id << " \"" << body.name << "\" ";
+            m_stream << body.pos << " " << body.rot << " ";
+            m_stream << body.lin_vel << " " << body.ang_vel << " ";
+            m_stream << body.lin_acc << " " << body.ang_acc << " ";
+            m_stream << body.ref_pos << " " << body.ref_vel << " " << body.ref_acc << " ";
+            m_stream << std::endl;
+        }
 
-void ChVehicleOutputASCII::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
-    for (auto marker : markers) {
-        m_stream << "    marker: " << marker->GetIdentifier() << " \"" << marker->GetNameString() << "\" ";
-        m_stream << marker->GetAbsCoord().pos << " ";
-        m_stream << marker->GetAbsCoord_dt().pos << " ";
-        m_stream << marker->GetAbsCoord_dtdt().pos << " ";
-        m_stream << std::endl;
-        //// TODO
-    }
-}
+        for (const auto& marker : section.markers) {
+            m_stream << "    marker: " << marker.id << " \"" << marker.name << "\" ";
+            m_stream << marker.pos << " ";
+            m_stream << marker.vel << " ";
+            m_stream << marker.acc << " ";
+            m_stream << std::endl;
+        }
 
-void ChVehicleOutputASCII::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
-    for (auto shaft : shafts) {
-        m_stream << "    shaft: " << shaft->GetIdentifier() << " \"" << shaft->GetNameString() << "\" ";
-        m_stream << shaft->GetPos() << " " << shaft->GetPos_dt() << " " << shaft->GetPos_dtdt() << " ";
-        m_stream << shaft->GetAppliedTorque() << " ";
-        m_stream << std::endl;
-        //// TODO
-    }
-}
+        for (const auto& shaft : section.shafts) {
+            m_stream << "    shaft: " << shaft.id << " \"" << shaft.name << "\" ";
+            m_stream << shaft.pos << " " << shaft.vel << " " << shaft.acc << " ";
+            m_stream << shaft.torque << " ";
+            m_stream << std::endl;
+        }
 
-void ChVehicleOutputASCII::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
-    for (const auto& joint : joints) {
-        std::vector<double> violations;
-        auto C = joint->GetConstraintViolation();
-        for (int i = 0; i < C.size(); i++)
-            violations.push_back(C(i));
-
-        m_stream << "    joint: " << joint->GetIdentifier() << " \"" << joint->GetNameString() << "\" ";
-        m_stream << joint->Get_react_force() << " " << joint->Get_react_torque() << " ";
-        for (const auto& val : violations) {
-            m_stream << val << " ";
+        for (const auto& joint : section.joints) {
+            m_stream << "    joint: " << joint.id << " \"" << joint.name << "\" ";
+            m_stream << joint.force << " " << joint.torque << " ";
+            for (const auto& val : joint.violation) {
+                m_stream << val << " ";
+            }
+            m_stream << std::endl;
         }
-        m_stream << std::endl;
-        //// TODO
-    }
-}
 
-void ChVehicleOutputASCII::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
-    for (auto couple : couples) {
-        m_stream << "    couple: " << couple->GetIdentifier() << " \"" << couple->GetNameString() << "\" ";
-        m_stream << couple->GetRelativeRotation() << " " << couple->GetRelativeRotation_dt() << " "
-                 << couple->GetRelativeRotation_dtdt() << " ";
-        m_stream << couple->GetTorqueReactionOn1() << " " << couple->GetTorqueReactionOn2() << " ";
-        m_stream << std::endl;
-        //// TODO
-    }
-}
+        for (const auto& couple : section.couples) {
+            m_stream << "    couple: " << couple.id << " \"" << couple.name << "\" ";
+            m_stream << couple.pos << " " << couple.vel << " " << couple.acc << " ";
+            m_stream << couple.torque1 << " " << couple.torque2 << " ";
+            m_stream << std::endl;
+        }
 
-void ChVehicleOutputASCII::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
-    for (auto spring : springs) {
-        m_stream << "    lin spring: " << spring->GetIdentifier() << " \"" << spring->GetNameString() << "\" ";
-        m_stream << spring->GetPoint1Abs() << " " << spring->GetPoint2Abs() << " ";
-        m_stream << spring->GetLength() << " " << spring->GetVelocity() << " ";
-        m_stream << spring->GetForce() << " ";
-        m_stream << std::endl;
-        //// TODO
-    }
-}
+        for (const auto& spring : section.lin_springs) {
+            m_stream << "    lin spring: " << spring.id << " \"" << spring.name << "\" ";
+            m_stream << spring.point1 << " " << spring.point2 << " ";
+            m_stream << spring.length << " " << spring.vel << " ";
+            m_stream << spring.force << " ";
+            m_stream << std::endl;
+        }
 
-void ChVehicleOutputASCII::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
-    for (auto spring : springs) {
-        m_stream << "    rot spring: " << spring->GetIdentifier() << " \"" << spring->GetNameString() << "\" ";
-        m_stream << spring->GetAngle() << " " << spring->GetVelocity() << " ";
-        m_stream << spring->GetTorque() << " ";
-        m_stream << std::endl;
-        //// TODO
-    }
-}
+        for (const auto& spring : section.rot_springs) {
+            m_stream << "    rot spring: " << spring.id << " \"" << spring.name << "\" ";
+            m_stream << spring.angle << " " << spring.vel << " ";
+            m_stream << spring.torque << " ";
+            m_stream << std::endl;
+        }
 
-void ChVehicleOutputASCII::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
-    for (auto load : loads) {
-        m_stream << "    body-body load: " << load->GetIdentifier() << " \"" << load->GetNameString() << "\" ";
-        m_stream << load->GetForce() << " " << load->GetTorque() << " ";
-        m_stream << std::endl;
-        //// TODO
+        for (const auto& load : section.body_loads) {
+            m_stream << "    body-body load: " << load.id << " \"" << load.name << "\" ";
+            m_stream << load.force << " " << load.torque << " ";
+            m_stream << std::endl;
+        }
     }
 }
 
@@ -22,7 +22,7 @@
 #include <string>
 #include <fstream>
 
-#include "chrono_vehicle/ChVehicleOutput.h"
+#include "chrono_vehicle/output/ChVehicleOutputBuffered.h"
 
 namespace chrono {
 namespace vehicle {
@@ -31,24 +31,16 @@ namespace vehicle {
 /// @{
 
 /// ASCII text vehicle output database.
-class CH_VEHICLE_API ChVehicleOutputASCII : public ChVehicleOutput {
+class CH_VEHICLE_API ChVehicleOutputASCII : public ChVehicleOutputBuffered {
   public:
-    ChVehicleOutputASCII(const std::string& filename);
+    /// Construct an ASCII output database.
+    /// If 'async' is true, output frames are formatted and written on a background thread.
+    ChVehicleOutputASCII(const std::string& filename, bool async = false, int num_buffers = 4);
     ~ChVehicleOutputASCII();
 
   private:
-    virtual void WriteTime(int frame, double time) override;
-    virtual void WriteSection(const std::string& name) override;
-
-    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
-    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
-    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
-    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
-    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
-    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
-    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
-    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
-    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+    virtual void WriteFrame(const ChVehicleOutputFrame& frame) override;
+    virtual void FlushFile() override;
 
     std::ofstream m_stream;
 };
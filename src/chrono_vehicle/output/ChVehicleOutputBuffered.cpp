@@ -0,0 +1,359 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Base class for a buffered vehicle output database, with optional writing on
+// a background thread.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono_vehicle/output/ChVehicleOutputBuffered.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChVehicleOutputBuffered::ChVehicleOutputBuffered(bool async, int num_buffers)
+    : m_async(async), m_current(-1), m_writing(false), m_stop(false), m_closed(false) {
+    num_buffers = std::max(num_buffers, 2);
+    m_frames.resize(num_buffers);
+    for (int i = 0; i < num_buffers; i++) {
+        m_frames[i].num_sections = 0;
+        m_free.push(i);
+    }
+
+    if (m_async)
+        m_writer = std::thread(&ChVehicleOutputBuffered::Process, this);
+}
+
+ChVehicleOutputBuffered::~ChVehicleOutputBuffered() {
+    // Derived classes should have already called Close. At this point, WriteFrame cannot be called anymore.
+    if (m_async && m_writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv_pending.notify_one();
+        m_writer.join();
+    }
+}
+
+void ChVehicleOutputBuffered::Close() {
+    if (m_closed)
+        return;
+
+    Submit();
+    Wait();
+
+    if (m_async) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv_pending.notify_one();
+        m_writer.join();
+    }
+
+    m_closed = true;
+}
+
+void ChVehicleOutputBuffered::Flush() {
+    if (m_closed)
+        return;
+
+    Submit();
+    Wait();
+    FlushFile();
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputBuffered::Submit() {
+    if (m_current < 0)
+        return;
+
+    if (!m_async) {
+        WriteFrame(m_frames[m_current]);
+        m_free.push(m_current);
+        m_current = -1;
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push(m_current);
+    }
+    m_cv_pending.notify_one();
+    m_current = -1;
+}
+
+void ChVehicleOutputBuffered::Wait() {
+    if (!m_async)
+        return;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv_free.wait(lock, [this]() { return m_pending.empty() && !m_writing; });
+}
+
+void ChVehicleOutputBuffered::Process() {
+    while (true) {
+        int index;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv_pending.wait(lock, [this]() { return m_stop || !m_pending.empty(); });
+            if (m_pending.empty())
+                return;
+            index = m_pending.front();
+            m_pending.pop();
+            m_writing = true;
+        }
+
+        WriteFrame(m_frames[index]);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_free.push(index);
+            m_writing = false;
+        }
+        m_cv_free.notify_all();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputBuffered::WriteTime(int frame, double time) {
+    if (m_closed)
+        return;
+
+    // Pass the previous frame to the writer
+    Submit();
+
+    // Acquire a free frame buffer (wait for the writer if necessary)
+    if (m_async) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_free.wait(lock, [this]() { return !m_free.empty(); });
+        m_current = m_free.front();
+        m_free.pop();
+    } else {
+        m_current = m_free.front();
+        m_free.pop();
+    }
+
+    auto& data = m_frames[m_current];
+    data.frame = frame;
+    data.time = time;
+    data.num_sections = 0;
+}
+
+void ChVehicleOutputBuffered::WriteSection(const std::string& name) {
+    if (m_current < 0)
+        return;
+
+    auto& data = m_frames[m_current];
+    if (data.num_sections == (int)data.sections.size())
+        data.sections.emplace_back();
+    auto& section = data.sections[data.num_sections++];
+    section.name = name;
+    section.bodies.clear();
+    section.auxref_bodies.clear();
+    section.markers.clear();
+    section.shafts.clear();
+    section.joints.clear();
+    section.couples.clear();
+    section.lin_springs.clear();
+    section.rot_springs.clear();
+    section.body_loads.clear();
+}
+
+ChVehicleOutputFrame::Section* ChVehicleOutputBuffered::CurrentSection() {
+    if (m_current < 0)
+        return nullptr;
+
+    auto& data = m_frames[m_current];
+    if (data.num_sections == 0)
+        WriteSection("");
+    return &data.sections[data.num_sections - 1];
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputBuffered::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    auto section = CurrentSection();
+    if (!section)
+        return;
+
+    auto n = section->bodies.size();
+    section->bodies.resize(n + bodies.size());
+    for (const auto& body : bodies) {
+        auto& info = section->bodies[n++];
+        info.id = body->GetIdentifier();
+        info.name.assign(body->GetName());
+        info.pos = body->GetPos();
+        info.rot = body->GetRot();
+        info.lin_vel = body->GetPos_dt();
+        info.ang_vel = body->GetWvel_par();
+        info.lin_acc = body->GetPos_dtdt();
+        info.ang_acc = body->GetWacc_par();
+    }
+}
+
+void ChVehicleOutputBuffered::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    auto section = CurrentSection();
+    if (!section)
+        return;
+
+    auto n = section->auxref_bodies.size();
+    section->auxref_bodies.resize(n + bodies.size());
+    for (const auto& body : bodies) {
+        auto& info = section->auxref_bodies[n++];
+        info.id = body->GetIdentifier();
+        info.name.assign(body->GetName());
+        info.pos = body->GetPos();
+        info.rot = body->GetRot();
+        info.lin_vel = body->GetPos_dt();
+        info.ang_vel = body->GetWvel_par();
+        info.lin_acc = body->GetPos_dtdt();
+        info.ang_acc = body->GetWacc_par();
+        info.ref_pos = body->GetFrame_REF_to_abs().GetPos();
+        info.ref_vel = body->GetFrame_REF_to_abs().GetPos_dt();
+        info.ref_acc = body->GetFrame_REF_to_abs().GetPos_dtdt();
+    }
+}
+
+void ChVehicleOutputBuffered::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    auto section = CurrentSection();
+    if (!section)
+        return;
+
+    auto n = section->markers.size();
+    section->markers.resize(n + markers.size());
+    for (const auto& marker : markers) {
+        auto& info = section->markers[n++];
+        info.id = marker->GetIdentifier();
+        info.name.assign(marker->GetName());
+        info.pos = marker->GetAbsCoord().pos;
+        info.vel = marker->GetAbsCoord_dt().pos;
+        info.acc = marker->GetAbsCoord_dtdt().pos;
+    }
+}
+
+void ChVehicleOutputBuffered::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    auto section = CurrentSection();
+    if (!section)
+        return;
+
+    auto n = section->shafts.size();
+    section->shafts.resize(n + shafts.size());
+    for (const auto& shaft : shafts) {
+        auto& info = section->shafts[n++];
+        info.id = shaft->GetIdentifier();
+        info.name.assign(shaft->GetName());
+        info.pos = shaft->GetPos();
+        info.vel = shaft->GetPos_dt();
+        info.acc = shaft->GetPos_dtdt();
+        info.torque = shaft->GetAppliedTorque();
+    }
+}
+
+void ChVehicleOutputBuffered::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    auto section = CurrentSection();
+    if (!section)
+        return;
+
+    auto n = section->joints.size();
+    section->joints.resize(n + joints.size());
+    for (const auto& joint : joints) {
+        auto& info = section->joints[n++];
+        info.id = joint->GetIdentifier();
+        info.name.assign(joint->GetName());
+        info.force = joint->Get_react_force();
+        info.torque = joint->Get_react_torque();
+        auto C = joint->GetConstraintViolation();
+        info.violation.resize(C.size());
+        for (int i = 0; i < C.size(); i++)
+            info.violation[i] = C(i);
+    }
+}
+
+void ChVehicleOutputBuffered::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    auto section = CurrentSection();
+    if (!section)
+        return;
+
+    auto n = section->couples.size();
+    section->couples.resize(n + couples.size());
+    for (const auto& couple : couples) {
+        auto& info = section->couples[n++];
+        info.id = couple->GetIdentifier();
+        info.name.assign(couple->GetName());
+        info.pos = couple->GetRelativeRotation();
+        info.vel = couple->GetRelativeRotation_dt();
+        info.acc = couple->GetRelativeRotation_dtdt();
+        info.torque1 = couple->GetTorqueReactionOn1();
+        info.torque2 = couple->GetTorqueReactionOn2();
+    }
+}
+
+void ChVehicleOutputBuffered::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
+    auto section = CurrentSection();
+    if (!section)
+        return;
+
+    auto n = section->lin_springs.size();
+    section->lin_springs.resize(n + springs.size());
+    for (const auto& spring : springs) {
+        auto& info = section->lin_springs[n++];
+        info.id = spring->GetIdentifier();
+        info.name.assign(spring->GetName());
+        info.point1 = spring->GetPoint1Abs();
+        info.point2 = spring->GetPoint2Abs();
+        info.length = spring->GetLength();
+        info.vel = spring->GetVelocity();
+        info.force = spring->GetForce();
+    }
+}
+
+void ChVehicleOutputBuffered::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
+    auto section = CurrentSection();
+    if (!section)
+        return;
+
+    auto n = section->rot_springs.size();
+    section->rot_springs.resize(n + springs.size());
+    for (const auto& spring : springs) {
+        auto& info = section->rot_springs[n++];
+        info.id = spring->GetIdentifier();
+        info.name.assign(spring->GetName());
+        info.angle = spring->GetAngle();
+        info.vel = spring->GetVelocity();
+        info.torque = spring->GetTorque();
+    }
+}
+
+void ChVehicleOutputBuffered::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    auto section = CurrentSection();
+    if (!section)
+        return;
+
+    auto n = section->body_loads.size();
+    section->body_loads.resize(n + loads.size());
+    for (const auto& load : loads) {
+        auto& info = section->body_loads[n++];
+        info.id = load->GetIdentifier();
+        info.name.assign(load->GetName());
+        info.force = load->GetForce();
+        info.torque = load->GetTorque();
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
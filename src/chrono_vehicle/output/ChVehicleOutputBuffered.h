@@ -0,0 +1,209 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Base class for a buffered vehicle output database, with optional writing on
+// a background thread.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_BUFFERED_H
+#define CH_VEHICLE_OUTPUT_BUFFERED_H
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Snapshot of the output data for one output frame.
+/// Record vectors are resized (not reallocated) when a frame buffer is reused.
+struct CH_VEHICLE_API ChVehicleOutputFrame {
+    struct Body {
+        int id;
+        std::string name;
+        ChVector<> pos;
+        ChQuaternion<> rot;
+        ChVector<> lin_vel;
+        ChVector<> ang_vel;
+        ChVector<> lin_acc;
+        ChVector<> ang_acc;
+    };
+
+    struct AuxRefBody : Body {
+        ChVector<> ref_pos;
+        ChVector<> ref_vel;
+        ChVector<> ref_acc;
+    };
+
+    struct Marker {
+        int id;
+        std::string name;
+        ChVector<> pos;
+        ChVector<> vel;
+        ChVector<> acc;
+    };
+
+    struct Shaft {
+        int id;
+        std::string name;
+        double pos, vel, acc;
+        double torque;
+    };
+
+    struct Joint {
+        int id;
+        std::string name;
+        ChVector<> force;
+        ChVector<> torque;
+        std::vector<double> violation;
+    };
+
+    struct Couple {
+        int id;
+        std::string name;
+        double pos, vel, acc;
+        double torque1, torque2;
+    };
+
+    struct LinSpring {
+        int id;
+        std::string name;
+        ChVector<> point1;
+        ChVector<> point2;
+        double length, vel;
+        double force;
+    };
+
+    struct RotSpring {
+        int id;
+        std::string name;
+        double angle, vel;
+        double torque;
+    };
+
+    struct BodyLoad {
+        int id;
+        std::string name;
+        ChVector<> force;
+        ChVector<> torque;
+    };
+
+    /// Output data for one section (subsystem) in a frame.
+    /// The order of the Write calls within a section is not recorded.
+    struct Section {
+        std::string name;
+        std::vector<Body> bodies;
+        std::vector<AuxRefBody> auxref_bodies;
+        std::vector<Marker> markers;
+        std::vector<Shaft> shafts;
+        std::vector<Joint> joints;
+        std::vector<Couple> couples;
+        std::vector<LinSpring> lin_springs;
+        std::vector<RotSpring> rot_springs;
+        std::vector<BodyLoad> body_loads;
+    };
+
+    int frame;                      ///< output frame number
+    double time;                    ///< simulation time
+    int num_sections;               ///< number of valid entries in 'sections'
+    std::vector<Section> sections;  ///< section data (only the first 'num_sections' are valid)
+};
+
+/// Base class for a buffered vehicle output database.
+/// All output data for a frame (from one WriteTime call to the next) is copied into a frame buffer on the calling
+/// thread. Complete frames are passed to WriteFrame, either directly or, in asynchronous mode, on a background writer
+/// thread. A fixed number of frame buffers is allocated; if all are waiting to be written, the simulation thread
+/// blocks until the writer releases one, so that memory use is bounded. Output data received outside a frame (before
+/// the first WriteTime or after a Flush) is ignored.
+class CH_VEHICLE_API ChVehicleOutputBuffered : public ChVehicleOutput {
+  public:
+    virtual ~ChVehicleOutputBuffered();
+
+    /// Return true if output frames are written on a background thread.
+    bool IsAsync() const { return m_async; }
+
+    /// Write all pending output frames (including the current one) and flush the output file.
+    /// This function blocks until all frames were written.
+    virtual void Flush() override;
+
+  protected:
+    /// Construct a buffered output database with the specified number of frame buffers (at least 2).
+    ChVehicleOutputBuffered(bool async, int num_buffers);
+
+    /// Write all pending output frames and stop the writer thread.
+    /// Derived classes must call this function in their destructor, before releasing any resources used by WriteFrame.
+    void Close();
+
+    /// Write the data for one complete output frame.
+    /// In asynchronous mode, this function is called on the writer thread.
+    virtual void WriteFrame(const ChVehicleOutputFrame& frame) = 0;
+
+    /// Flush the underlying output file.
+    /// Called on the calling thread, after all pending frames were written.
+    virtual void FlushFile() {}
+
+  private:
+    virtual void WriteTime(int frame, double time) override;
+    virtual void WriteSection(const std::string& name) override;
+
+    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
+    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
+    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
+    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
+    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
+    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
+    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
+    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
+    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+
+    /// Return the current section (creating an unnamed one if necessary) or nullptr if there is no current frame.
+    ChVehicleOutputFrame::Section* CurrentSection();
+
+    /// Pass the current frame (if any) to the writer.
+    void Submit();
+
+    /// Wait until all submitted frames were written.
+    void Wait();
+
+    /// Writer thread loop.
+    void Process();
+
+    bool m_async;                                ///< write frames on a background thread
+    std::vector<ChVehicleOutputFrame> m_frames;  ///< frame buffers
+    int m_current;                               ///< index of current frame buffer (-1 if none)
+    std::queue<int> m_free;                      ///< indices of available frame buffers
+    std::queue<int> m_pending;                   ///< indices of frame buffers waiting to be written
+    bool m_writing;                              ///< writer thread currently writing a frame
+    bool m_stop;                                 ///< request writer thread termination
+    bool m_closed;                               ///< writer was stopped
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv_pending;  ///< signaled when a frame is submitted (or on stop)
+    std::condition_variable m_cv_free;     ///< signaled when a frame was written
+    std::thread m_writer;
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
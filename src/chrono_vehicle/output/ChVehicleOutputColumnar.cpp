@@ -0,0 +1,578 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Columnar time-series vehicle output database and corresponding reader.
+//
+// File layout:
+//   header:  magic (8 bytes), version (uint32), block size (uint32)
+//   blocks:  for each block, the compressed time chunk followed by the
+//            compressed chunks of all channels present in that block
+//   index:   channel names, followed by the description of all blocks
+//            (frame range, time interval, location and checksum of all chunks)
+//   trailer: index offset (int64), index checksum (uint32), magic (8 bytes)
+//
+// All values are stored in native byte order.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "chrono/core/ChException.h"
+
+#include "chrono_vehicle/output/ChVehicleOutputColumnar.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+
+static const char columnar_magic[8] = {'C', 'H', 'V', 'C', 'O', 'L', '\0', '\0'};
+static const uint32_t columnar_version = 1;
+
+template <typename T>
+static void WriteValue(std::ofstream& stream, const T& val) {
+    stream.write(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+template <typename T>
+static void ReadValue(std::ifstream& stream, T& val) {
+    stream.read(reinterpret_cast<char*>(&val), sizeof(T));
+}
+
+template <typename T>
+static void AppendValue(std::vector<uint8_t>& buffer, const T& val) {
+    auto bytes = reinterpret_cast<const uint8_t*>(&val);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+// Extract a value from an in-memory buffer. Return false if not enough data is left.
+template <typename T>
+static bool ExtractValue(const uint8_t*& data, const uint8_t* end, T& val) {
+    if (end - data < (std::ptrdiff_t)sizeof(T))
+        return false;
+    std::memcpy(&val, data, sizeof(T));
+    data += sizeof(T);
+    return true;
+}
+
+// Checksum of a byte array (32-bit FNV-1a).
+static uint32_t Checksum(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Compress an array of values.
+// For each value, the XOR with the previous value is encoded as a control byte, followed by its non-zero bytes. The
+// control byte is 0 if the value did not change; otherwise, it stores the number of leading and trailing zero bytes
+// (at most 7 each). Slowly varying signals share sign, exponent, and leading mantissa bits with their previous value,
+// while quantized or constant signals produce many trailing zero bytes.
+static void Compress(const double* values, size_t n, std::vector<uint8_t>& out) {
+    out.clear();
+    uint64_t prev = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t crt;
+        std::memcpy(&crt, &values[i], sizeof(double));
+        uint64_t x = crt ^ prev;
+        prev = crt;
+        if (x == 0) {
+            out.push_back(0);
+            continue;
+        }
+        int lead = 0;
+        while (lead < 7 && (x >> (8 * (7 - lead))) == 0)
+            lead++;
+        int trail = 0;
+        while (trail < 7 && ((x >> (8 * trail)) & 0xFF) == 0)
+            trail++;
+        out.push_back((uint8_t)(0x80 | (lead << 3) | trail));
+        for (int b = 7 - lead; b >= trail; b--)
+            out.push_back((uint8_t)(x >> (8 * b)));
+    }
+}
+
+// Decompress an array of values. Return false if the data is inconsistent.
+static bool Decompress(const uint8_t* data, size_t size, size_t n, double* values) {
+    const uint8_t* end = data + size;
+    uint64_t prev = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (data == end)
+            return false;
+        uint8_t ctrl = *data++;
+        if (ctrl != 0) {
+            int lead = (ctrl >> 3) & 0x7;
+            int trail = ctrl & 0x7;
+            if (lead + trail > 7 || end - data < 8 - lead - trail)
+                return false;
+            uint64_t x = 0;
+            for (int b = 7 - lead; b >= trail; b--)
+                x |= (uint64_t)(*data++) << (8 * b);
+            prev ^= x;
+        }
+        std::memcpy(&values[i], &prev, sizeof(double));
+    }
+    return data == end;
+}
+
+// -----------------------------------------------------------------------------
+
+ChVehicleOutputColumnar::ChVehicleOutputColumnar(const std::string& filename,
+                                                 int block_size,
+                                                 bool async,
+                                                 int num_buffers)
+    : ChVehicleOutputBuffered(async, num_buffers), m_block_size(std::max(block_size, 1)), m_num_frames(0) {
+    m_stream.open(filename, std::ios_base::out | std::ios_base::binary);
+    m_stream.write(columnar_magic, sizeof(columnar_magic));
+    WriteValue(m_stream, columnar_version);
+    WriteValue(m_stream, (uint32_t)m_block_size);
+    m_time.reserve(m_block_size);
+}
+
+ChVehicleOutputColumnar::~ChVehicleOutputColumnar() {
+    Close();
+    WriteBlock();
+    WriteIndex();
+    m_stream.close();
+}
+
+void ChVehicleOutputColumnar::FlushFile() {
+    WriteBlock();
+    m_stream.flush();
+}
+
+// -----------------------------------------------------------------------------
+
+const std::string& ChVehicleOutputColumnar::ObjectPrefix(const std::string& section,
+                                                         const char* type,
+                                                         const std::string& name,
+                                                         int id,
+                                                         const char* first_field) {
+    m_prefix = section;
+    m_prefix += '/';
+    m_prefix += type;
+    m_prefix += '/';
+    if (name.empty())
+        m_prefix += std::to_string(id);
+    else
+        m_prefix += name;
+
+    // If another object with the same name was already recorded in this frame, disambiguate using the identifier
+    m_key = m_prefix + '/' + first_field;
+    auto it = m_channel_index.find(m_key);
+    if (it != m_channel_index.end() && m_channels[it->second].values.size() == m_time.size()) {
+        m_prefix += '#';
+        m_prefix += std::to_string(id);
+    }
+
+    return m_prefix;
+}
+
+void ChVehicleOutputColumnar::AddValue(const std::string& prefix, const char* field, double value) {
+    m_key = prefix;
+    m_key += '/';
+    m_key += field;
+
+    int index;
+    auto it = m_channel_index.find(m_key);
+    if (it == m_channel_index.end()) {
+        index = (int)m_channels.size();
+        m_channel_index.insert({m_key, index});
+        m_channels.push_back({m_key, {}});
+        m_channels.back().values.reserve(m_block_size);
+    } else {
+        index = it->second;
+    }
+
+    // Pad with NaN for the frames (in the current block) in which this channel was not present
+    auto& values = m_channels[index].values;
+    values.resize(m_time.size() - 1, std::numeric_limits<double>::quiet_NaN());
+    values.push_back(value);
+}
+
+void ChVehicleOutputColumnar::WriteFrame(const ChVehicleOutputFrame& frame) {
+    m_time.push_back(frame.time);
+
+    for (int is = 0; is < frame.num_sections; is++) {
+        const auto& section = frame.sections[is];
+
+        for (const auto& b : section.bodies) {
+            const auto& p = ObjectPrefix(section.name, "body", b.name, b.id, "x");
+            AddValue(p, "x", b.pos.x());
+            AddValue(p, "y", b.pos.y());
+            AddValue(p, "z", b.pos.z());
+            AddValue(p, "e0", b.rot.e0());
+            AddValue(p, "e1", b.rot.e1());
+            AddValue(p, "e2", b.rot.e2());
+            AddValue(p, "e3", b.rot.e3());
+            AddValue(p, "vx", b.lin_vel.x());
+            AddValue(p, "vy", b.lin_vel.y());
+            AddValue(p, "vz", b.lin_vel.z());
+            AddValue(p, "wx", b.ang_vel.x());
+            AddValue(p, "wy", b.ang_vel.y());
+            AddValue(p, "wz", b.ang_vel.z());
+            AddValue(p, "ax", b.lin_acc.x());
+            AddValue(p, "ay", b.lin_acc.y());
+            AddValue(p, "az", b.lin_acc.z());
+            AddValue(p, "wdx", b.ang_acc.x());
+            AddValue(p, "wdy", b.ang_acc.y());
+            AddValue(p, "wdz", b.ang_acc.z());
+        }
+
+        for (const auto& b : section.auxref_bodies) {
+            const auto& p = ObjectPrefix(section.name, "auxref", b.name, b.id, "x");
+            AddValue(p, "x", b.pos.x());
+            AddValue(p, "y", b.pos.y());
+            AddValue(p, "z", b.pos.z());
+            AddValue(p, "e0", b.rot.e0());
+            AddValue(p, "e1", b.rot.e1());
+            AddValue(p, "e2", b.rot.e2());
+            AddValue(p, "e3", b.rot.e3());
+            AddValue(p, "vx", b.lin_vel.x());
+            AddValue(p, "vy", b.lin_vel.y());
+            AddValue(p, "vz", b.lin_vel.z());
+            AddValue(p, "wx", b.ang_vel.x());
+            AddValue(p, "wy", b.ang_vel.y());
+            AddValue(p, "wz", b.ang_vel.z());
+            AddValue(p, "ax", b.lin_acc.x());
+            AddValue(p, "ay", b.lin_acc.y());
+            AddValue(p, "az", b.lin_acc.z());
+            AddValue(p, "wdx", b.ang_acc.x());
+            AddValue(p, "wdy", b.ang_acc.y());
+            AddValue(p, "wdz", b.ang_acc.z());
+            AddValue(p, "ref_x", b.ref_pos.x());
+            AddValue(p, "ref_y", b.ref_pos.y());
+            AddValue(p, "ref_z", b.ref_pos.z());
+            AddValue(p, "ref_vx", b.ref_vel.x());
+            AddValue(p, "ref_vy", b.ref_vel.y());
+            AddValue(p, "ref_vz", b.ref_vel.z());
+            AddValue(p, "ref_ax", b.ref_acc.x());
+            AddValue(p, "ref_ay", b.ref_acc.y());
+            AddValue(p, "ref_az", b.ref_acc.z());
+        }
+
+        for (const auto& m : section.markers) {
+            const auto& p = ObjectPrefix(section.name, "marker", m.name, m.id, "x");
+            AddValue(p, "x", m.pos.x());
+            AddValue(p, "y", m.pos.y());
+            AddValue(p, "z", m.pos.z());
+            AddValue(p, "vx", m.vel.x());
+            AddValue(p, "vy", m.vel.y());
+            AddValue(p, "vz", m.vel.z());
+            AddValue(p, "ax", m.acc.x());
+            AddValue(p, "ay", m.acc.y());
+            AddValue(p, "az", m.acc.z());
+        }
+
+        for (const auto& s : section.shafts) {
+            const auto& p = ObjectPrefix(section.name, "shaft", s.name, s.id, "pos");
+            AddValue(p, "pos", s.pos);
+            AddValue(p, "vel", s.vel);
+            AddValue(p, "acc", s.acc);
+            AddValue(p, "torque", s.torque);
+        }
+
+        for (const auto& j : section.joints) {
+            const auto& p = ObjectPrefix(section.name, "joint", j.name, j.id, "Fx");
+            AddValue(p, "Fx", j.force.x());
+            AddValue(p, "Fy", j.force.y());
+            AddValue(p, "Fz", j.force.z());
+            AddValue(p, "Tx", j.torque.x());
+            AddValue(p, "Ty", j.torque.y());
+            AddValue(p, "Tz", j.torque.z());
+        }
+
+        for (const auto& c : section.couples) {
+            const auto& p = ObjectPrefix(section.name, "couple", c.name, c.id, "pos");
+            AddValue(p, "pos", c.pos);
+            AddValue(p, "vel", c.vel);
+            AddValue(p, "acc", c.acc);
+            AddValue(p, "torque1", c.torque1);
+            AddValue(p, "torque2", c.torque2);
+        }
+
+        for (const auto& s : section.lin_springs) {
+            const auto& p = ObjectPrefix(section.name, "linspring", s.name, s.id, "length");
+            AddValue(p, "length", s.length);
+            AddValue(p, "vel", s.vel);
+            AddValue(p, "force", s.force);
+        }
+
+        for (const auto& s : section.rot_springs) {
+            const auto& p = ObjectPrefix(section.name, "rotspring", s.name, s.id, "angle");
+            AddValue(p, "angle", s.angle);
+            AddValue(p, "vel", s.vel);
+            AddValue(p, "torque", s.torque);
+        }
+
+        for (const auto& l : section.body_loads) {
+            const auto& p = ObjectPrefix(section.name, "bodyload", l.name, l.id, "Fx");
+            AddValue(p, "Fx", l.force.x());
+            AddValue(p, "Fy", l.force.y());
+            AddValue(p, "Fz", l.force.z());
+            AddValue(p, "Tx", l.torque.x());
+            AddValue(p, "Ty", l.torque.y());
+            AddValue(p, "Tz", l.torque.z());
+        }
+    }
+
+    if ((int)m_time.size() == m_block_size)
+        WriteBlock();
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputColumnar::WriteBlock() {
+    if (m_time.empty())
+        return;
+
+    Block block;
+    block.first_frame = m_num_frames;
+    block.num_frames = (uint32_t)m_time.size();
+    block.t_start = m_time.front();
+    block.t_end = m_time.back();
+
+    Compress(m_time.data(), m_time.size(), m_buffer);
+    block.time_offset = (int64_t)m_stream.tellp();
+    block.time_size = (uint32_t)m_buffer.size();
+    block.time_checksum = Checksum(m_buffer.data(), m_buffer.size());
+    m_stream.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+
+    for (size_t ic = 0; ic < m_channels.size(); ic++) {
+        auto& values = m_channels[ic].values;
+        if (values.empty())
+            continue;
+        values.resize(m_time.size(), std::numeric_limits<double>::quiet_NaN());
+        Compress(values.data(), values.size(), m_buffer);
+        Chunk chunk;
+        chunk.channel = (uint32_t)ic;
+        chunk.offset = (int64_t)m_stream.tellp();
+        chunk.size = (uint32_t)m_buffer.size();
+        chunk.checksum = Checksum(m_buffer.data(), m_buffer.size());
+        m_stream.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+        block.chunks.push_back(chunk);
+        values.clear();
+    }
+
+    m_blocks.push_back(block);
+    m_num_frames += m_time.size();
+    m_time.clear();
+}
+
+void ChVehicleOutputColumnar::WriteIndex() {
+    int64_t index_offset = (int64_t)m_stream.tellp();
+
+    // Assemble the index in memory, so that its checksum can be recorded in the trailer
+    m_buffer.clear();
+    AppendValue(m_buffer, (uint32_t)m_channels.size());
+    for (const auto& channel : m_channels) {
+        AppendValue(m_buffer, (uint32_t)channel.name.size());
+        m_buffer.insert(m_buffer.end(), channel.name.begin(), channel.name.end());
+    }
+
+    AppendValue(m_buffer, (uint32_t)m_blocks.size());
+    for (const auto& block : m_blocks) {
+        AppendValue(m_buffer, block.first_frame);
+        AppendValue(m_buffer, block.num_frames);
+        AppendValue(m_buffer, block.t_start);
+        AppendValue(m_buffer, block.t_end);
+        AppendValue(m_buffer, block.time_offset);
+        AppendValue(m_buffer, block.time_size);
+        AppendValue(m_buffer, block.time_checksum);
+        AppendValue(m_buffer, (uint32_t)block.chunks.size());
+        for (const auto& chunk : block.chunks) {
+            AppendValue(m_buffer, chunk.channel);
+            AppendValue(m_buffer, chunk.offset);
+            AppendValue(m_buffer, chunk.size);
+            AppendValue(m_buffer, chunk.checksum);
+        }
+    }
+
+    m_stream.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+    WriteValue(m_stream, index_offset);
+    WriteValue(m_stream, Checksum(m_buffer.data(), m_buffer.size()));
+    m_stream.write(columnar_magic, sizeof(columnar_magic));
+}
+
+// -----------------------------------------------------------------------------
+
+ChVehicleOutputColumnarReader::ChVehicleOutputColumnarReader(const std::string& filename) : m_num_frames(0) {
+    m_stream.open(filename, std::ios_base::in | std::ios_base::binary);
+    if (!m_stream)
+        throw ChException("Cannot open columnar output file " + filename);
+
+    char magic[8];
+    uint32_t version;
+    uint32_t block_size;
+    m_stream.read(magic, sizeof(magic));
+    ReadValue(m_stream, version);
+    ReadValue(m_stream, block_size);
+    if (!m_stream || std::memcmp(magic, columnar_magic, sizeof(magic)) != 0)
+        throw ChException(filename + " is not a columnar output file");
+    if (version != columnar_version)
+        throw ChException("Unsupported columnar output file version " + std::to_string(version));
+
+    // Locate the index from the file trailer
+    int64_t header_size = (int64_t)m_stream.tellg();
+    int64_t index_offset;
+    uint32_t index_checksum;
+    m_stream.seekg(0, std::ios_base::end);
+    int64_t trailer_size = (int64_t)(sizeof(index_offset) + sizeof(index_checksum) + sizeof(magic));
+    int64_t trailer_offset = (int64_t)m_stream.tellg() - trailer_size;
+    if (trailer_offset < header_size)
+        throw ChException("Columnar output file " + filename + " is incomplete (missing index)");
+    m_stream.seekg(trailer_offset);
+    ReadValue(m_stream, index_offset);
+    ReadValue(m_stream, index_checksum);
+    m_stream.read(magic, sizeof(magic));
+    if (!m_stream || std::memcmp(magic, columnar_magic, sizeof(magic)) != 0)
+        throw ChException("Columnar output file " + filename + " is incomplete (missing index)");
+    if (index_offset < header_size || index_offset > trailer_offset)
+        throw ChException("Columnar output file " + filename + " has a corrupted index");
+
+    // Load and verify the index
+    m_buffer.resize((size_t)(trailer_offset - index_offset));
+    m_stream.seekg(index_offset);
+    m_stream.read(reinterpret_cast<char*>(m_buffer.data()), m_buffer.size());
+    if (!m_stream || Checksum(m_buffer.data(), m_buffer.size()) != index_checksum || !ParseIndex(index_offset))
+        throw ChException("Columnar output file " + filename + " has a corrupted index");
+}
+
+bool ChVehicleOutputColumnarReader::ParseIndex(int64_t index_offset) {
+    const uint8_t* data = m_buffer.data();
+    const uint8_t* end = data + m_buffer.size();
+
+    uint32_t num_channels;
+    if (!ExtractValue(data, end, num_channels))
+        return false;
+    m_names.resize(num_channels);
+    for (uint32_t ic = 0; ic < num_channels; ic++) {
+        uint32_t len;
+        if (!ExtractValue(data, end, len) || end - data < (std::ptrdiff_t)len)
+            return false;
+        m_names[ic].assign(reinterpret_cast<const char*>(data), len);
+        data += len;
+        m_channel_index.insert({m_names[ic], (int)ic});
+    }
+
+    // All chunks must lie between the file header and the index
+    auto valid = [index_offset](int64_t offset, uint32_t size) {
+        return offset > 0 && offset <= index_offset && size <= index_offset - offset;
+    };
+
+    uint32_t num_blocks;
+    if (!ExtractValue(data, end, num_blocks))
+        return false;
+    m_blocks.resize(num_blocks);
+    for (auto& block : m_blocks) {
+        uint32_t num_chunks;
+        if (!ExtractValue(data, end, block.first_frame) || !ExtractValue(data, end, block.num_frames) ||
+            !ExtractValue(data, end, block.t_start) || !ExtractValue(data, end, block.t_end) ||
+            !ExtractValue(data, end, block.time_offset) || !ExtractValue(data, end, block.time_size) ||
+            !ExtractValue(data, end, block.time_checksum) || !ExtractValue(data, end, num_chunks))
+            return false;
+        if (block.first_frame != m_num_frames || !valid(block.time_offset, block.time_size))
+            return false;
+        for (uint32_t k = 0; k < num_chunks; k++) {
+            uint32_t channel;
+            Chunk chunk;
+            if (!ExtractValue(data, end, channel) || !ExtractValue(data, end, chunk.offset) ||
+                !ExtractValue(data, end, chunk.size) || !ExtractValue(data, end, chunk.checksum))
+                return false;
+            if (channel >= num_channels || !valid(chunk.offset, chunk.size))
+                return false;
+            block.chunks.insert({channel, chunk});
+        }
+        m_num_frames += block.num_frames;
+    }
+
+    return data == end;
+}
+
+int ChVehicleOutputColumnarReader::GetChannelIndex(const std::string& name) const {
+    auto it = m_channel_index.find(name);
+    return it == m_channel_index.end() ? -1 : it->second;
+}
+
+double ChVehicleOutputColumnarReader::GetStartTime() const {
+    return m_blocks.empty() ? 0 : m_blocks.front().t_start;
+}
+
+double ChVehicleOutputColumnarReader::GetEndTime() const {
+    return m_blocks.empty() ? 0 : m_blocks.back().t_end;
+}
+
+void ChVehicleOutputColumnarReader::ReadChunk(int64_t offset,
+                                              uint32_t size,
+                                              uint32_t checksum,
+                                              uint32_t num_values,
+                                              std::vector<double>& values) {
+    m_buffer.resize(size);
+    m_stream.seekg(offset);
+    m_stream.read(reinterpret_cast<char*>(m_buffer.data()), size);
+    values.resize(num_values);
+    if (!m_stream || Checksum(m_buffer.data(), size) != checksum ||
+        !Decompress(m_buffer.data(), size, num_values, values.data()))
+        throw ChException("Corrupted chunk in columnar output file");
+}
+
+bool ChVehicleOutputColumnarReader::Read(const std::string& channel,
+                                         double t_start,
+                                         double t_end,
+                                         std::vector<double>& time,
+                                         std::vector<double>& values) {
+    return Read(GetChannelIndex(channel), t_start, t_end, time, values);
+}
+
+bool ChVehicleOutputColumnarReader::Read(int channel,
+                                         double t_start,
+                                         double t_end,
+                                         std::vector<double>& time,
+                                         std::vector<double>& values) {
+    time.clear();
+    values.clear();
+    if (channel < 0 || channel >= (int)m_names.size())
+        return false;
+
+    // First block that may contain frames with time >= t_start (blocks are ordered in time)
+    auto first = std::lower_bound(m_blocks.begin(), m_blocks.end(), t_start,
+                                  [](const Block& block, double t) { return block.t_end < t; });
+
+    for (auto block = first; block != m_blocks.end() && block->t_start <= t_end; ++block) {
+        ReadChunk(block->time_offset, block->time_size, block->time_checksum, block->num_frames, m_time_chunk);
+
+        // A channel with no chunk in this block was not present in any of its frames
+        auto chunk = block->chunks.find((uint32_t)channel);
+        if (chunk != block->chunks.end())
+            ReadChunk(chunk->second.offset, chunk->second.size, chunk->second.checksum, block->num_frames,
+                      m_value_chunk);
+        else
+            m_value_chunk.assign(block->num_frames, std::numeric_limits<double>::quiet_NaN());
+
+        for (uint32_t i = 0; i < block->num_frames; i++) {
+            if (m_time_chunk[i] >= t_start && m_time_chunk[i] <= t_end) {
+                time.push_back(m_time_chunk[i]);
+                values.push_back(m_value_chunk[i]);
+            }
+        }
+    }
+
+    return true;
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
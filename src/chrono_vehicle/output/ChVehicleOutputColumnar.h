@@ -0,0 +1,190 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Columnar time-series vehicle output database and corresponding reader.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_COLUMNAR_H
+#define CH_VEHICLE_OUTPUT_COLUMNAR_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono_vehicle/output/ChVehicleOutputBuffered.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Columnar time-series vehicle output database.
+/// Every scalar output quantity is stored as a separate channel (column), named "section/type/object/field", where
+/// type is one of body, auxref, marker, shaft, joint, couple, linspring, rotspring, or bodyload, and object is the name
+/// of the output object (or its identifier, if the object has no name). For example, the position of the chassis body
+/// is stored in the channels "Chassis/body/<chassis name>/x", "Chassis/body/<chassis name>/y", etc.
+///
+/// Output frames are grouped in blocks of a fixed number of frames. For each block, the file contains a compressed
+/// chunk with the output times and one compressed chunk per channel. An index (written when the database is closed)
+/// records the time interval and the location of all chunks in each block, so that the values of a channel over a
+/// given time window can be retrieved by reading only the corresponding chunks (see ChVehicleOutputColumnarReader).
+/// Channel values are compressed losslessly by encoding the non-zero bytes of the XOR of consecutive values. If a
+/// channel is not present in a frame, its value is recorded as NaN. All chunks and the index carry a checksum.
+class CH_VEHICLE_API ChVehicleOutputColumnar : public ChVehicleOutputBuffered {
+  public:
+    /// Construct a columnar output database with the specified number of frames per block.
+    /// If 'async' is true, output frames are compressed and written on a background thread.
+    ChVehicleOutputColumnar(const std::string& filename,
+                            int block_size = 1024,
+                            bool async = false,
+                            int num_buffers = 4);
+    ~ChVehicleOutputColumnar();
+
+  private:
+    struct Channel {
+        std::string name;            ///< channel name
+        std::vector<double> values;  ///< channel values in the current block
+    };
+
+    struct Chunk {
+        uint32_t channel;   ///< channel index
+        uint32_t size;      ///< size of compressed data (bytes)
+        uint32_t checksum;  ///< checksum of compressed data
+        int64_t offset;     ///< file offset of compressed data
+    };
+
+    struct Block {
+        int64_t first_frame;        ///< index of first frame in block (in order of output)
+        uint32_t num_frames;        ///< number of frames in block
+        uint32_t time_size;         ///< size of compressed time data (bytes)
+        uint32_t time_checksum;     ///< checksum of compressed time data
+        int64_t time_offset;        ///< file offset of compressed time data
+        double t_start;             ///< first output time in block
+        double t_end;               ///< last output time in block
+        std::vector<Chunk> chunks;  ///< channel chunks in this block
+    };
+
+    virtual void WriteFrame(const ChVehicleOutputFrame& frame) override;
+
+    /// Write the current (possibly incomplete) block and flush the output file.
+    /// Note that the file index is only written when the database is destroyed.
+    virtual void FlushFile() override;
+
+    /// Return the prefix for the channel names of the specified object ("section/type/object").
+    const std::string& ObjectPrefix(const std::string& section,
+                                    const char* type,
+                                    const std::string& name,
+                                    int id,
+                                    const char* first_field);
+
+    /// Record the value of the specified channel (prefix/field) for the current frame.
+    void AddValue(const std::string& prefix, const char* field, double value);
+
+    void WriteBlock();
+    void WriteIndex();
+
+    std::ofstream m_stream;
+    int m_block_size;
+    int64_t m_num_frames;  ///< number of frames in previous blocks
+
+    std::vector<double> m_time;                            ///< output times in the current block
+    std::vector<Channel> m_channels;                       ///< all channels (in order of creation)
+    std::unordered_map<std::string, int> m_channel_index;  ///< channel name -> index
+    std::vector<Block> m_blocks;                           ///< index of written blocks
+
+    std::vector<uint8_t> m_buffer;  ///< scratch buffer for compressed data
+    std::string m_prefix;           ///< scratch object prefix
+    std::string m_key;              ///< scratch channel name
+};
+
+/// Reader for a columnar vehicle output file (see ChVehicleOutputColumnar).
+/// Only the file index is loaded at construction; channel values are read on demand, by loading only the chunks of the
+/// requested channel that overlap the requested time window.
+class CH_VEHICLE_API ChVehicleOutputColumnarReader {
+  public:
+    /// Open the specified file and load its index.
+    /// An exception is thrown if the file cannot be read, is not a complete columnar output file, or its index is
+    /// corrupted. Corrupted data chunks are detected (and an exception thrown) when they are read.
+    ChVehicleOutputColumnarReader(const std::string& filename);
+
+    /// Return the names of all channels in the file.
+    const std::vector<std::string>& GetChannelNames() const { return m_names; }
+
+    /// Return the index of the channel with given name (-1 if no such channel exists).
+    int GetChannelIndex(const std::string& name) const;
+
+    /// Return the total number of output frames.
+    int64_t GetNumFrames() const { return m_num_frames; }
+
+    /// Return the first output time.
+    double GetStartTime() const;
+
+    /// Return the last output time.
+    double GetEndTime() const;
+
+    /// Read the output times and the values of the specified channel for all frames with time in [t_start, t_end].
+    /// Return false if the channel does not exist.
+    bool Read(const std::string& channel,
+              double t_start,
+              double t_end,
+              std::vector<double>& time,
+              std::vector<double>& values);
+
+    /// Read the output times and the values of the specified channel for all frames with time in [t_start, t_end].
+    /// Return false if the channel index is invalid.
+    bool Read(int channel, double t_start, double t_end, std::vector<double>& time, std::vector<double>& values);
+
+  private:
+    struct Chunk {
+        uint32_t size;
+        uint32_t checksum;
+        int64_t offset;
+    };
+
+    struct Block {
+        int64_t first_frame;
+        uint32_t num_frames;
+        uint32_t time_size;
+        uint32_t time_checksum;
+        int64_t time_offset;
+        double t_start;
+        double t_end;
+        std::unordered_map<uint32_t, Chunk> chunks;
+    };
+
+    /// Load, verify, and decompress a chunk with the specified number of values.
+    void ReadChunk(int64_t offset, uint32_t size, uint32_t checksum, uint32_t num_values, std::vector<double>& values);
+
+    /// Parse the file index (already loaded in the scratch buffer). Return false if the index is inconsistent.
+    bool ParseIndex(int64_t index_offset);
+
+    std::ifstream m_stream;
+    int64_t m_num_frames;
+    std::vector<std::string> m_names;
+    std::unordered_map<std::string, int> m_channel_index;
+    std::vector<Block> m_blocks;
+
+    std::vector<uint8_t> m_buffer;
+    std::vector<double> m_time_chunk;
+    std::vector<double> m_value_chunk;
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
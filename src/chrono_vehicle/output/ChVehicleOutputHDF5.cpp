@@ -20,9 +20,7 @@
 #include <iomanip>
 #include <sstream>
 #include <fstream>
-
-#include "chrono/physics/ChLinkLock.h"
-#include "chrono/physics/ChLinkUniversal.h"
+#include <mutex>
 
 #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 
@@ -280,21 +278,22 @@ const H5::CompType& ChVehicleOutputHDF5::getBodyLoadType() {
 
 // -----------------------------------------------------------------------------
 
-ChVehicleOutputHDF5::ChVehicleOutputHDF5(const std::string& filename)
-    : m_frame_group(nullptr), m_section_group(nullptr) {
+// HDF5 library calls from different output databases (possibly on different writer threads) are serialized, since
+// the HDF5 library may not be built thread-safe. The compound types are also shared by all output databases.
+static std::mutex hdf5_mutex;
+
+ChVehicleOutputHDF5::ChVehicleOutputHDF5(const std::string& filename, bool async, int num_buffers)
+    : ChVehicleOutputBuffered(async, num_buffers) {
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
     m_fileHDF5 = new H5::H5File(filename, H5F_ACC_TRUNC);
     H5::Group frames_group(m_fileHDF5->createGroup("/Frames"));
 }
 
 ChVehicleOutputHDF5::~ChVehicleOutputHDF5() {
-    if (m_section_group)
-        m_section_group->close();
-    if (m_frame_group)
-        m_frame_group->close();
-    m_fileHDF5->close();
+    Close();
 
-    delete m_section_group;
-    delete m_frame_group;
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
+    m_fileHDF5->close();
     delete m_fileHDF5;
     
     delete m_body_type;
@@ -307,6 +306,11 @@ ChVehicleOutputHDF5::~ChVehicleOutputHDF5() {
     delete m_rotspring_type;
 }
 
+void ChVehicleOutputHDF5::FlushFile() {
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
+    m_fileHDF5->flush(H5F_SCOPE_LOCAL);
+}
+
 // -----------------------------------------------------------------------------
 
 std::string format_number(int num, int precision) {
@@ -315,206 +319,125 @@ std::string format_number(int num, int precision) {
     return out.str();
 }
 
-// -----------------------------------------------------------------------------
+// Write a one-dimensional dataset with the given records.
+template <typename T>
+static void WriteDataSet(H5::Group& group,
+                         const std::string& name,
+                         const H5::CompType& type,
+                         const std::vector<T>& info) {
+    hsize_t dim[] = {info.size()};
+    H5::DataSpace dataspace(1, dim);
+    H5::DataSet set = group.createDataSet(name, type, dataspace);
+    set.write(info.data(), type);
+}
 
-void ChVehicleOutputHDF5::WriteTime(int frame, double time) {
-    // Close the currently open section group
-    if (m_section_group) {
-        m_section_group->close();
-        delete m_section_group;
-        m_section_group = nullptr;
-    }
+// -----------------------------------------------------------------------------
 
-    // Close the currently open frame group
-    if (m_frame_group) {
-        m_frame_group->close();
-        delete m_frame_group;
-        m_frame_group = nullptr;
-    }
+void ChVehicleOutputHDF5::WriteFrame(const ChVehicleOutputFrame& frame) {
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
 
     // Open the frames group and create the group for this frame
-    auto frame_name = std::string("Frame_") + format_number(frame, 6);
+    auto frame_name = std::string("Frame_") + format_number(frame.frame, 6);
     H5::Group frames_group = m_fileHDF5->openGroup("/Frames");
-    m_frame_group = new H5::Group(frames_group.createGroup(frame_name));
+    H5::Group frame_group = frames_group.createGroup(frame_name);
 
     // Create an attribute with timestamp
     {
         H5::DataSpace dataspace(H5S_SCALAR);
-        H5::Attribute att = m_frame_group->createAttribute("Timestamp", H5::PredType::NATIVE_DOUBLE, dataspace);
-        att.write(H5::PredType::NATIVE_DOUBLE, &time);
-    }
-}
-
-void ChVehicleOutputHDF5::WriteSection(const std::string& name) {
-    // Close the currently open section group
-    if (m_section_group) {
-        m_section_group->close();
-        delete m_section_group;
-        m_section_group = nullptr;
-    }
-
-    // Create the group for this section in the current frame group
-    m_section_group = new H5::Group(m_frame_group->createGroup(name));
-}
-
-void ChVehicleOutputHDF5::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
-    if (bodies.empty())
-        return;
-
-    auto nbodies = bodies.size();
-    hsize_t dim[] = {nbodies};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<body_info> info(nbodies);
-    for (auto i = 0; i < nbodies; i++) {
-        const ChVector<>& p = bodies[i]->GetPos();
-        const ChQuaternion<>& q = bodies[i]->GetRot();
-        info[i] = {bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Bodies", getBodyType(), dataspace);
-    set.write(info.data(), getBodyType());
-}
-
-void ChVehicleOutputHDF5::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
-    if (bodies.empty())
-        return;
-
-    auto nbodies = bodies.size();
-    hsize_t dim[] = { nbodies };
-    H5::DataSpace dataspace(1, dim);
-    std::vector<bodyaux_info> info(nbodies);
-    for (auto i = 0; i < nbodies; i++) {
-        const ChVector<>& p = bodies[i]->GetPos();
-        const ChQuaternion<>& q = bodies[i]->GetRot();
-        info[i] = { bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3() };
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Bodies AuxRef", getBodyAuxType(), dataspace);
-    set.write(info.data(), getBodyAuxType());
-}
-
-void ChVehicleOutputHDF5::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
-    if (markers.empty())
-        return;
-
-    auto nmarkers = markers.size();
-    hsize_t dim[] = {nmarkers};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<marker_info> info(nmarkers);
-    for (auto i = 0; i < nmarkers; i++) {
-        const ChVector<>& p = markers[i]->GetAbsCoord().pos;
-        const ChVector<>& pd = markers[i]->GetAbsCoord_dt().pos;
-        const ChVector<>& pdd = markers[i]->GetAbsCoord_dtdt().pos;
-        info[i] = {markers[i]->GetIdentifier(), p.x(), p.y(), p.z(), pd.x(), pd.y(), pd.z(), pdd.x(), pdd.y(), pdd.z()};
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Markers", getMarkerType(), dataspace);
-    set.write(info.data(), getMarkerType());
-}
-
-void ChVehicleOutputHDF5::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
-    if (shafts.empty())
-        return;
-
-    auto nshafts = shafts.size();
-    hsize_t dim[] = {nshafts};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<shaft_info> info(nshafts);
-    for (auto i = 0; i < nshafts; i++) {
-        info[i] = {shafts[i]->GetIdentifier(), shafts[i]->GetPos(), shafts[i]->GetPos_dt(), shafts[i]->GetPos_dtdt(),
-                   shafts[i]->GetAppliedTorque()};
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Shafts", getShaftType(), dataspace);
-    set.write(info.data(), getShaftType());
-}
-
-void ChVehicleOutputHDF5::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
-    if (joints.empty())
-        return;
-
-    auto njoints = joints.size();
-    hsize_t dim[] = { njoints };
-    H5::DataSpace dataspace(1, dim);
-    std::vector<joint_info> info(njoints);
-    for (auto i = 0; i < njoints; i++) {
-        const ChVector<>& f = joints[i]->Get_react_force();
-        const ChVector<>& t = joints[i]->Get_react_torque();
-        info[i] = { joints[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z() };
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Joints", getJointType(), dataspace);
-    set.write(info.data(), getJointType());
-}
-
-void ChVehicleOutputHDF5::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
-    if (couples.empty())
-        return;
-
-    auto ncouples = couples.size();
-    hsize_t dim[] = {ncouples};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<couple_info> info(ncouples);
-    for (auto i = 0; i < ncouples; i++) {
-        info[i] = {couples[i]->GetIdentifier(),          couples[i]->GetRelativeRotation(),
-                   couples[i]->GetRelativeRotation_dt(), couples[i]->GetRelativeRotation_dtdt(),
-                   couples[i]->GetTorqueReactionOn1(),   couples[i]->GetTorqueReactionOn2()};
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Couples", getCoupleType(), dataspace);
-    set.write(info.data(), getCoupleType());
-}
-
-void ChVehicleOutputHDF5::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
-    if (springs.empty())
-        return;
-
-    auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<linspring_info> info(nsprings);
-    for (auto i = 0; i < nsprings; i++) {
-        info[i] = {springs[i]->GetIdentifier(), springs[i]->GetLength(), springs[i]->GetVelocity(),
-                   springs[i]->GetForce()};
+        H5::Attribute att = frame_group.createAttribute("Timestamp", H5::PredType::NATIVE_DOUBLE, dataspace);
+        att.write(H5::PredType::NATIVE_DOUBLE, &frame.time);
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Lin Springs", getLinSpringType(), dataspace);
-    set.write(info.data(), getLinSpringType());
-}
-
-void ChVehicleOutputHDF5::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
-    if (springs.empty())
-        return;
-
-    auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<rotspring_info> info(nsprings);
-    for (auto i = 0; i < nsprings; i++) {
-        info[i] = {springs[i]->GetIdentifier(), springs[i]->GetAngle(), springs[i]->GetVelocity(),
-                   springs[i]->GetTorque()};
-    }
+    // Create the group for each section in the current frame group and write the section data
+    for (int is = 0; is < frame.num_sections; is++) {
+        const auto& section = frame.sections[is];
+        H5::Group section_group = frame_group.createGroup(section.name);
 
-    H5::DataSet set = m_section_group->createDataSet("Rot Springs", getRotSpringType(), dataspace);
-    set.write(info.data(), getRotSpringType());
-}
-
-void ChVehicleOutputHDF5::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
-    if (loads.empty())
-        return;
-
-    auto nloads = loads.size();
-    hsize_t dim[] = { nloads };
-    H5::DataSpace dataspace(1, dim);
-    std::vector<bodyload_info> info(nloads);
-    for (auto i = 0; i < nloads; i++) {
-        ChVector<> f = loads[i]->GetForce();
-        ChVector<> t = loads[i]->GetTorque();
-        info[i] = { loads[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z() };
+        if (!section.bodies.empty()) {
+            std::vector<body_info> body_data(section.bodies.size());
+            for (size_t i = 0; i < section.bodies.size(); i++) {
+                const auto& b = section.bodies[i];
+                body_data[i] = {b.id, b.pos.x(), b.pos.y(), b.pos.z(), b.rot.e0(), b.rot.e1(), b.rot.e2(), b.rot.e3()};
+            }
+            WriteDataSet(section_group, "Bodies", getBodyType(), body_data);
+        }
+
+        if (!section.auxref_bodies.empty()) {
+            std::vector<bodyaux_info> bodyaux_data(section.auxref_bodies.size());
+            for (size_t i = 0; i < section.auxref_bodies.size(); i++) {
+                const auto& b = section.auxref_bodies[i];
+                bodyaux_data[i] = {b.id,       b.pos.x(), b.pos.y(), b.pos.z(),
+                                   b.rot.e0(), b.rot.e1(), b.rot.e2(), b.rot.e3()};
+            }
+            WriteDataSet(section_group, "Bodies AuxRef", getBodyAuxType(), bodyaux_data);
+        }
+
+        if (!section.markers.empty()) {
+            std::vector<marker_info> marker_data(section.markers.size());
+            for (size_t i = 0; i < section.markers.size(); i++) {
+                const auto& m = section.markers[i];
+                marker_data[i] = {m.id,     m.pos.x(), m.pos.y(), m.pos.z(), m.vel.x(),
+                                  m.vel.y(), m.vel.z(), m.acc.x(), m.acc.y(), m.acc.z()};
+            }
+            WriteDataSet(section_group, "Markers", getMarkerType(), marker_data);
+        }
+
+        if (!section.shafts.empty()) {
+            std::vector<shaft_info> shaft_data(section.shafts.size());
+            for (size_t i = 0; i < section.shafts.size(); i++) {
+                const auto& s = section.shafts[i];
+                shaft_data[i] = {s.id, s.pos, s.vel, s.acc, s.torque};
+            }
+            WriteDataSet(section_group, "Shafts", getShaftType(), shaft_data);
+        }
+
+        if (!section.joints.empty()) {
+            std::vector<joint_info> joint_data(section.joints.size());
+            for (size_t i = 0; i < section.joints.size(); i++) {
+                const auto& j = section.joints[i];
+                joint_data[i] = {j.id,         j.force.x(),  j.force.y(), j.force.z(),
+                                 j.torque.x(), j.torque.y(), j.torque.z()};
+            }
+            WriteDataSet(section_group, "Joints", getJointType(), joint_data);
+        }
+
+        if (!section.couples.empty()) {
+            std::vector<couple_info> couple_data(section.couples.size());
+            for (size_t i = 0; i < section.couples.size(); i++) {
+                const auto& c = section.couples[i];
+                couple_data[i] = {c.id, c.pos, c.vel, c.acc, c.torque1, c.torque2};
+            }
+            WriteDataSet(section_group, "Couples", getCoupleType(), couple_data);
+        }
+
+        if (!section.lin_springs.empty()) {
+            std::vector<linspring_info> linspring_data(section.lin_springs.size());
+            for (size_t i = 0; i < section.lin_springs.size(); i++) {
+                const auto& s = section.lin_springs[i];
+                linspring_data[i] = {s.id, s.length, s.vel, s.force};
+            }
+            WriteDataSet(section_group, "Lin Springs", getLinSpringType(), linspring_data);
+        }
+
+        if (!section.rot_springs.empty()) {
+            std::vector<rotspring_info> rotspring_data(section.rot_springs.size());
+            for (size_t i = 0; i < section.rot_springs.size(); i++) {
+                const auto& s = section.rot_springs[i];
+                rotspring_data[i] = {s.id, s.angle, s.vel, s.torque};
+            }
+            WriteDataSet(section_group, "Rot Springs", getRotSpringType(), rotspring_data);
+        }
+
+        if (!section.body_loads.empty()) {
+            std::vector<bodyload_info> bodyload_data(section.body_loads.size());
+            for (size_t i = 0; i < section.body_loads.size(); i++) {
+                const auto& l = section.body_loads[i];
+                bodyload_data[i] = {l.id,         l.force.x(),  l.force.y(), l.force.z(),
+                                    l.torque.x(), l.torque.y(), l.torque.z()};
+            }
+            WriteDataSet(section_group, "Body-body Loads", getBodyLoadType(), bodyload_data);
+        }
     }
-
-    H5::DataSet set = m_section_group->createDataSet("Body-body Loads", getBodyLoadType(), dataspace);
-    set.write(info.data(), getBodyLoadType());
 }
 
 }  // end namespace vehicle
@@ -12,7 +12,7 @@
 // Authors: Radu Serban
 // =============================================================================
 //
-// ASCII text vehicle output database.
+// HDF5 vehicle output database.
 //
 // =============================================================================
 
@@ -22,7 +22,7 @@
 #include <string>
 #include <fstream>
 
-#include "chrono_vehicle/ChVehicleOutput.h"
+#include "chrono_vehicle/output/ChVehicleOutputBuffered.h"
 
 #include "H5Cpp.h"
 
@@ -33,28 +33,18 @@ namespace vehicle {
 /// @{
 
 /// HDF5 vehicle output database.
-class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutput {
+class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutputBuffered {
   public:
-    ChVehicleOutputHDF5(const std::string& filename);
+    /// Construct an HDF5 output database.
+    /// If 'async' is true, the HDF5 datasets are written on a background thread.
+    ChVehicleOutputHDF5(const std::string& filename, bool async = false, int num_buffers = 4);
     ~ChVehicleOutputHDF5();
 
   private:
-    virtual void WriteTime(int frame, double time) override;
-    virtual void WriteSection(const std::string& name) override;
-
-    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
-    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
-    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
-    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
-    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
-    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
-    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
-    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
-    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+    virtual void WriteFrame(const ChVehicleOutputFrame& frame) override;
+    virtual void FlushFile() override;
 
     H5::H5File* m_fileHDF5;
-    H5::Group* m_frame_group;
-    H5::Group* m_section_group;
 
     static H5::CompType* m_body_type;
     static H5::CompType* m_bodyaux_type;
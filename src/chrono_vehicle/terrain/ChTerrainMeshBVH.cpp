@@ -0,0 +1,184 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Bounding volume hierarchy for vertical height queries on a triangular mesh.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include "chrono_vehicle/ChWorldFrame.h"
+#include "chrono_vehicle/terrain/ChTerrainMeshBVH.h"
+
+namespace chrono {
+namespace vehicle {
+
+// Maximum number of triangles in a leaf node.
+static const int max_leaf_size = 4;
+
+// Maximum depth of the traversal stack (the median split keeps the tree balanced).
+static const int max_stack_size = 64;
+
+ChTerrainMeshBVH::ChTerrainMeshBVH(const geometry::ChTriangleMeshConnected& trimesh, const ChFrame<>& frame) {
+    const auto& vertices = trimesh.m_vertices;
+    const auto& faces = trimesh.m_face_v_indices;
+
+    // Express all triangles in the world ISO frame and discard those that are degenerate in the horizontal projection
+    // (these cannot be hit by a vertical ray).
+    std::vector<Triangle> tris;
+    tris.reserve(faces.size());
+    for (const auto& face : faces) {
+        Triangle tri;
+        ChVector<> p[3];
+        for (int j = 0; j < 3; j++) {
+            p[j] = ChWorldFrame::ToISO(frame.TransformPointLocalToParent(vertices[face[j]]));
+            tri.x[j] = p[j].x();
+            tri.y[j] = p[j].y();
+            tri.z[j] = p[j].z();
+        }
+        double det = (tri.x[1] - tri.x[0]) * (tri.y[2] - tri.y[0]) - (tri.x[2] - tri.x[0]) * (tri.y[1] - tri.y[0]);
+        ChVector<> nrm = Vcross(p[1] - p[0], p[2] - p[0]);
+        double len = nrm.Length();
+        if (std::abs(det) <= 1e-12 * len || len == 0)
+            continue;
+        if (nrm.z() < 0)
+            nrm = -nrm;
+        tri.inv_det = 1 / det;
+        tri.normal = ChWorldFrame::FromISO(nrm / len);
+        tris.push_back(tri);
+    }
+
+    if (tris.empty())
+        return;
+
+    std::vector<int> order(tris.size());
+    for (int i = 0; i < (int)tris.size(); i++)
+        order[i] = i;
+
+    m_tris.reserve(tris.size());
+    m_nodes.reserve(2 * tris.size() / max_leaf_size + 1);
+    Build(order, tris, 0, (int)tris.size());
+}
+
+// Recursively build the subtree over the triangles order[first, first+count) and return the index of its root.
+int ChTerrainMeshBVH::Build(std::vector<int>& order, std::vector<Triangle>& tris, int first, int count) {
+    Node node;
+    node.min[0] = node.min[1] = +std::numeric_limits<double>::max();
+    node.max[0] = node.max[1] = -std::numeric_limits<double>::max();
+    double cmin[2] = {+std::numeric_limits<double>::max(), +std::numeric_limits<double>::max()};
+    double cmax[2] = {-std::numeric_limits<double>::max(), -std::numeric_limits<double>::max()};
+    for (int i = first; i < first + count; i++) {
+        const Triangle& tri = tris[order[i]];
+        for (int j = 0; j < 3; j++) {
+            node.min[0] = std::min(node.min[0], tri.x[j]);
+            node.min[1] = std::min(node.min[1], tri.y[j]);
+            node.max[0] = std::max(node.max[0], tri.x[j]);
+            node.max[1] = std::max(node.max[1], tri.y[j]);
+        }
+        double cx = (tri.x[0] + tri.x[1] + tri.x[2]) / 3;
+        double cy = (tri.y[0] + tri.y[1] + tri.y[2]) / 3;
+        cmin[0] = std::min(cmin[0], cx);
+        cmin[1] = std::min(cmin[1], cy);
+        cmax[0] = std::max(cmax[0], cx);
+        cmax[1] = std::max(cmax[1], cy);
+    }
+
+    int index = (int)m_nodes.size();
+    m_nodes.push_back(node);
+
+    // Leaf node: append its triangles, contiguously, to the final triangle array
+    if (count <= max_leaf_size) {
+        m_nodes[index].index = (int)m_tris.size();
+        m_nodes[index].count = count;
+        for (int i = first; i < first + count; i++)
+            m_tris.push_back(tris[order[i]]);
+        return index;
+    }
+
+    // Internal node: split at the median centroid along the longest axis of the centroid bounds
+    int axis = (cmax[0] - cmin[0] >= cmax[1] - cmin[1]) ? 0 : 1;
+    int half = count / 2;
+    std::nth_element(order.begin() + first, order.begin() + first + half, order.begin() + first + count,
+                     [&tris, axis](int a, int b) {
+                         const Triangle& ta = tris[a];
+                         const Triangle& tb = tris[b];
+                         return axis == 0 ? (ta.x[0] + ta.x[1] + ta.x[2]) < (tb.x[0] + tb.x[1] + tb.x[2])
+                                          : (ta.y[0] + ta.y[1] + ta.y[2]) < (tb.y[0] + tb.y[1] + tb.y[2]);
+                     });
+
+    Build(order, tris, first, half);
+    int right = Build(order, tris, first + half, count - half);
+    m_nodes[index].index = right;
+    m_nodes[index].count = 0;
+
+    return index;
+}
+
+bool ChTerrainMeshBVH::PointInTriangle(const Triangle& tri, double x, double y, double& z) const {
+    const double eps = 1e-12;
+    double l1 = ((x - tri.x[0]) * (tri.y[2] - tri.y[0]) - (tri.x[2] - tri.x[0]) * (y - tri.y[0])) * tri.inv_det;
+    if (l1 < -eps)
+        return false;
+    double l2 = ((tri.x[1] - tri.x[0]) * (y - tri.y[0]) - (x - tri.x[0]) * (tri.y[1] - tri.y[0])) * tri.inv_det;
+    if (l2 < -eps)
+        return false;
+    double l0 = 1 - l1 - l2;
+    if (l0 < -eps)
+        return false;
+    z = l0 * tri.z[0] + l1 * tri.z[1] + l2 * tri.z[2];
+    return true;
+}
+
+bool ChTerrainMeshBVH::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    if (m_nodes.empty())
+        return false;
+
+    ChVector<> loc_iso = ChWorldFrame::ToISO(loc);
+    double x = loc_iso.x();
+    double y = loc_iso.y();
+
+    bool hit = false;
+    int stack[max_stack_size];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const Node& node = m_nodes[stack[--top]];
+        if (x < node.min[0] || x > node.max[0] || y < node.min[1] || y > node.max[1])
+            continue;
+
+        if (node.count > 0) {
+            for (int i = node.index; i < node.index + node.count; i++) {
+                double z;
+                if (PointInTriangle(m_tris[i], x, y, z) && (!hit || z > height)) {
+                    hit = true;
+                    height = z;
+                    normal = m_tris[i].normal;
+                }
+            }
+            continue;
+        }
+
+        int left = (int)(&node - m_nodes.data()) + 1;
+        assert(top + 2 <= max_stack_size);
+        stack[top++] = node.index;
+        stack[top++] = left;
+    }
+
+    return hit;
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,88 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Bounding volume hierarchy for vertical height queries on a triangular mesh.
+//
+// =============================================================================
+
+#ifndef CH_TERRAIN_MESH_BVH_H
+#define CH_TERRAIN_MESH_BVH_H
+
+#include <vector>
+
+#include "chrono/core/ChFrame.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_terrain
+/// @{
+
+/// Immutable bounding volume hierarchy for vertical height queries on a triangular mesh.
+/// The mesh triangles are transformed to the world frame and projected onto the horizontal plane, where a 2D AABB
+/// tree is built once, at construction. A query for the terrain point below a given location then reduces to a
+/// point-in-triangle search in the horizontal plane, keeping the highest of the triangles containing the point (i.e.,
+/// the first hit of a vertical ray cast from above).
+/// The hierarchy is independent of the collision system and all queries are const and lock-free, so that they can be
+/// issued concurrently from multiple threads.
+class CH_VEHICLE_API ChTerrainMeshBVH {
+  public:
+    /// Construct the hierarchy for the given mesh, with vertices expressed in the specified frame.
+    ChTerrainMeshBVH(const geometry::ChTriangleMeshConnected& trimesh,  ///< [in] triangular mesh
+                     const ChFrame<>& frame                             ///< [in] mesh frame (relative to world)
+    );
+
+    /// Find the terrain height and normal at the point below the specified location.
+    /// Return false if the vertical line through the given location does not intersect the mesh.
+    bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const;
+
+    /// Get the number of triangles in the hierarchy (degenerate triangles in the horizontal projection are excluded).
+    size_t GetNumTriangles() const { return m_tris.size(); }
+
+    /// Get the number of nodes in the hierarchy.
+    size_t GetNumNodes() const { return m_nodes.size(); }
+
+  private:
+    /// Triangle data, with vertices expressed in the world ISO frame (Z vertical).
+    struct Triangle {
+        double x[3];        ///< vertex horizontal coordinates
+        double y[3];        ///< vertex horizontal coordinates
+        double z[3];        ///< vertex heights
+        double inv_det;     ///< inverse of the (signed) projected area, times 2
+        ChVector<> normal;  ///< upward face normal, in the world frame
+    };
+
+    /// Hierarchy node. Nodes are stored in depth-first order, so that the left child of an internal node immediately
+    /// follows it; 'index' is the right child (internal node) or the first triangle (leaf).
+    struct Node {
+        double min[2];  ///< lower corner of the horizontal bounding box
+        double max[2];  ///< upper corner of the horizontal bounding box
+        int index;      ///< right child index (internal node) or index of first triangle (leaf)
+        int count;      ///< number of triangles (leaf) or 0 (internal node)
+    };
+
+    int Build(std::vector<int>& order, std::vector<Triangle>& tris, int first, int count);
+    bool PointInTriangle(const Triangle& tri, double x, double y, double& z) const;
+
+    std::vector<Triangle> m_tris;  ///< triangles, in leaf order
+    std::vector<Node> m_nodes;     ///< hierarchy nodes, in depth-first order
+};
+
+/// @} vehicle_terrain
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -57,6 +57,9 @@ class CH_VEHICLE_API FlatTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value specified at construction.
     virtual float GetCoefficientFriction(const ChVector<>& loc) const override;
 
+    /// Return true: queries of a flat terrain can be issued concurrently.
+    virtual bool SupportsConcurrentQueries() const override { return true; }
+
   private:
     double m_height;   ///< terrain height
     float m_friction;  ///< contact coefficient of friction
@@ -49,6 +49,7 @@ RigidTerrain::RigidTerrain(ChSystem* system)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_initialized(false),
       m_contact_callback(nullptr),
       m_collision_family(14) {}
 
@@ -59,6 +60,7 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_initialized(false),
       m_contact_callback(nullptr),
       m_collision_family(14) {
     // Open and parse the input file
@@ -230,27 +232,51 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
                                                             bool connected_mesh,
                                                             double sweep_sphere_radius,
                                                             bool visualization) {
+    // Load mesh from file
+    auto mesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_file, true, true);
+    std::shared_ptr<geometry::ChTriangleMeshSoup> mesh_soup;
+    if (!connected_mesh)
+        mesh_soup = geometry::ChTriangleMeshSoup::CreateFromWavefrontFile(mesh_file);
+
+    auto mesh_name = filesystem::path(mesh_file).stem();
+
+    return AddMeshPatch(material, position, mesh, mesh_soup, mesh_name, sweep_sphere_radius, visualization);
+}
+
+std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMaterialSurface> material,
+                                                            const ChCoordsys<>& position,
+                                                            std::shared_ptr<geometry::ChTriangleMeshConnected> mesh,
+                                                            const std::string& mesh_name,
+                                                            double sweep_sphere_radius,
+                                                            bool visualization) {
+    return AddMeshPatch(material, position, mesh, nullptr, mesh_name, sweep_sphere_radius, visualization);
+}
+
+std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddMeshPatch(
+    std::shared_ptr<ChMaterialSurface> material,
+    const ChCoordsys<>& position,
+    std::shared_ptr<geometry::ChTriangleMeshConnected> mesh,
+    std::shared_ptr<geometry::ChTriangleMeshSoup> mesh_soup,
+    const std::string& mesh_name,
+    double sweep_sphere_radius,
+    bool visualization) {
     auto patch = chrono_types::make_shared<MeshPatch>();
     AddPatch(patch, position, material);
     patch->m_visualize = visualization;
+    patch->m_trimesh = mesh;
+    patch->m_trimesh_s = mesh_soup;
 
-    // Load mesh from file
-    patch->m_trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_file, true, true);
-
-    // Create the collision model
+    // Create the collision model (use the mesh soup, if provided)
     patch->m_body->GetCollisionModel()->ClearModel();
-    if (connected_mesh) {
+    if (!mesh_soup) {
         patch->m_body->GetCollisionModel()->AddTriangleMesh(material, patch->m_trimesh, true, false, VNULL,
                                                             ChMatrix33<>(1), sweep_sphere_radius);
     } else {
-        patch->m_trimesh_s = geometry::ChTriangleMeshSoup::CreateFromWavefrontFile(mesh_file);
         patch->m_body->GetCollisionModel()->AddTriangleMesh(material, patch->m_trimesh_s, true, false, VNULL,
                                                             ChMatrix33<>(1), sweep_sphere_radius);
     }
     patch->m_body->GetCollisionModel()->BuildModel();
 
-    auto mesh_name = filesystem::path(mesh_file).stem();
-
     // Cache patch parameters
     patch->m_radius =
         std::max_element(patch->m_trimesh->getCoordsVertices().begin(),                                      //
@@ -277,7 +303,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
                                                             bool connected_mesh,
                                                             double sweep_sphere_radius,
                                                             bool visualization) {
-    auto patch = chrono_types::make_shared<MeshPatch>();
+    auto patch = chrono_types::make_shared<HeightMapPatch>();
     AddPatch(patch, position, material);
     patch->m_visualize = visualization;
 
@@ -316,6 +342,16 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
     // Initialize the array of accumulators (number of adjacent faces to a vertex)
     std::vector<int> accumulators(n_verts, 0);
 
+    // Cache the height grid (same vertex ordering as the mesh)
+    patch->m_nx = nv_x;
+    patch->m_ny = nv_y;
+    patch->m_dx = dx;
+    patch->m_dy = dy;
+    patch->m_hlength = length / 2;
+    patch->m_hwidth = width / 2;
+    patch->m_heights.resize(n_verts);
+    patch->m_use_grid = false;
+
     // Readability aliases
     std::vector<ChVector<> >& vertices = patch->m_trimesh->getCoordsVertices();
     std::vector<ChVector<> >& normals = patch->m_trimesh->getCoordsNormals();
@@ -333,6 +369,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
             double x = ix * dx - 0.5 * length;
             // Map gray level to vertex height
             double z = hMin + hmap.Gray(ix, iy) * h_scale;
+            patch->m_heights[iv] = z;
             // Set vertex location
             vertices[iv] = ChWorldFrame::FromISO(ChVector<>(x, y, z));
             // Initialize vertex normal to (0, 0, 0).
@@ -503,6 +540,7 @@ void RigidTerrain::Initialize() {
         patch->m_body->GetCollisionModel()->SetFamily(m_collision_family);
         patch->m_body->GetCollisionModel()->SetFamilyMaskNoCollisionWithFamily(m_collision_family);
     }
+    m_initialized = true;
 
     if (!m_friction_fun)
         m_use_friction_functor = false;
@@ -529,6 +567,13 @@ void RigidTerrain::BoxPatch::Initialize() {
 }
 
 void RigidTerrain::MeshPatch::Initialize() {
+    InitializeVisualization();
+
+    // Build the hierarchy for height queries (the patch body is fixed)
+    m_bvh = chrono_types::make_shared<ChTerrainMeshBVH>(*m_trimesh, m_body->GetFrame_REF_to_abs());
+}
+
+void RigidTerrain::MeshPatch::InitializeVisualization() {
     if (m_visualize) {
         m_body->AddVisualModel(chrono_types::make_shared<ChVisualModel>());
         auto trimesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
@@ -540,6 +585,18 @@ void RigidTerrain::MeshPatch::Initialize() {
     }
 }
 
+void RigidTerrain::HeightMapPatch::Initialize() {
+    // Grid queries are possible only if the patch vertical direction coincides with the world vertical.
+    // Otherwise, build a hierarchy over the patch mesh.
+    ChVector<> vertical = m_body->TransformDirectionLocalToParent(ChWorldFrame::FromISO(ChVector<>(0, 0, 1)));
+    m_use_grid = Vdot(vertical, ChWorldFrame::Vertical()) > 1 - 1e-10;
+
+    if (m_use_grid)
+        InitializeVisualization();
+    else
+        MeshPatch::Initialize();
+}
+
 // -----------------------------------------------------------------------------
 // Functions for obtaining the terrain height, normal, and coefficient of
 // friction  at the specified location.
@@ -578,6 +635,45 @@ float RigidTerrain::GetCoefficientFriction(const ChVector<>& loc) const {
     return hit ? friction : 0.8f;
 }
 
+void RigidTerrain::GetProperties(const ChVector<>& loc, double& height, ChVector<>& normal, float& friction) const {
+    bool hit = FindPoint(loc, height, normal, friction);
+    if (!hit)
+        height = 0.0;
+    if (m_friction_fun)
+        friction = (*m_friction_fun)(loc);
+}
+
+void RigidTerrain::GetProperties(const std::vector<ChVector<>>& loc,
+                                 std::vector<double>& height,
+                                 std::vector<ChVector<>>& normal,
+                                 std::vector<float>& friction) const {
+    size_t n = loc.size();
+    height.assign(n, std::numeric_limits<double>::lowest());
+    normal.assign(n, ChWorldFrame::Vertical());
+    friction.assign(n, 0.8f);
+
+    // Process all locations one patch at a time, keeping the highest hit
+    for (const auto& patch : m_patches) {
+        for (size_t i = 0; i < n; i++) {
+            double pheight;
+            ChVector<> pnormal;
+            bool phit = patch->FindPoint(loc[i], pheight, pnormal);
+            if (phit && pheight > height[i]) {
+                height[i] = pheight;
+                normal[i] = pnormal;
+                friction[i] = patch->m_friction;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        if (height[i] == std::numeric_limits<double>::lowest())
+            height[i] = 0.0;
+        if (m_friction_fun)
+            friction[i] = (*m_friction_fun)(loc[i]);
+    }
+}
+
 bool RigidTerrain::FindPoint(const ChVector<> loc, double& height, ChVector<>& normal, float& friction) const {
     bool hit = false;
     height = std::numeric_limits<double>::lowest();
@@ -616,6 +712,10 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector<>& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    if (m_bvh)
+        return m_bvh->FindPoint(loc, height, normal);
+
+    // Before initialization, cast a ray into the patch contact model
     ChVector<> from = loc + (m_radius + 1000) * ChWorldFrame::Vertical();
     ChVector<> to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -627,6 +727,49 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, C
     return result.hit;
 }
 
+bool RigidTerrain::HeightMapPatch::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    if (!m_use_grid)
+        return MeshPatch::FindPoint(loc, height, normal);
+
+    // Express the location in the patch ISO frame and find the grid cell
+    ChVector<> loc_iso = ChWorldFrame::ToISO(m_body->TransformPointParentToLocal(loc));
+    double x = loc_iso.x() + m_hlength;
+    double y = loc_iso.y() + m_hwidth;
+    if (x < 0 || x > 2 * m_hlength || y < 0 || y > 2 * m_hwidth)
+        return false;
+
+    int ix = std::min(static_cast<int>(x / m_dx), m_nx - 2);
+    int iy = std::min(static_cast<int>(y / m_dy), m_ny - 2);
+    double u = x / m_dx - ix;
+    double v = y / m_dy - iy;
+
+    int v0 = ix + m_nx * iy;
+    double h00 = m_heights[v0];
+    double h10 = m_heights[v0 + 1];
+    double h01 = m_heights[v0 + m_nx];
+    double h11 = m_heights[v0 + m_nx + 1];
+
+    // Interpolate within the cell triangle containing the point.
+    // Each cell is split along its (0,0)-(1,1) diagonal, as in the contact mesh.
+    double z, dzdx, dzdy;
+    if (v > u) {
+        dzdx = (h11 - h01) / m_dx;
+        dzdy = (h01 - h00) / m_dy;
+        z = h00 + u * (h11 - h01) + v * (h01 - h00);
+    } else {
+        dzdx = (h10 - h00) / m_dx;
+        dzdy = (h11 - h10) / m_dy;
+        z = h00 + u * (h10 - h00) + v * (h11 - h10);
+    }
+
+    ChVector<> point = ChWorldFrame::FromISO(ChVector<>(loc_iso.x(), loc_iso.y(), z));
+    ChVector<> nrm = ChWorldFrame::FromISO(ChVector<>(-dzdx, -dzdy, 1).GetNormalized());
+    height = ChWorldFrame::Height(m_body->TransformPointLocalToParent(point));
+    normal = m_body->TransformDirectionLocalToParent(nrm);
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
@@ -30,6 +30,7 @@
 
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/terrain/ChTerrainMeshBVH.h"
 
 #include "chrono_thirdparty/rapidjson/document.h"
 
@@ -127,8 +128,24 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         bool visualization = true                     ///< [in] enable/disable construction of visualization assets
     );
 
+    /// Add a terrain patch represented by the given triangular mesh, used for both contact and visualization.
+    /// The mesh is not copied; it can be shared with other terrain patches (e.g. in other systems), but must not be
+    /// modified.
+    std::shared_ptr<Patch> AddPatch(
+        std::shared_ptr<ChMaterialSurface> material,              ///< [in] contact material
+        const ChCoordsys<>& position,                             ///< [in] patch location and orientation
+        std::shared_ptr<geometry::ChTriangleMeshConnected> mesh,  ///< [in] patch mesh
+        const std::string& mesh_name,                             ///< [in] name of the patch mesh
+        double sweep_sphere_radius = 0,                           ///< [in] radius of sweep sphere
+        bool visualization = true  ///< [in] enable/disable construction of visualization assets
+    );
+
     /// Add a terrain patch represented by a height-field map.
     /// The height map is specified through a BMP gray-scale image.
+    /// The height grid is retained so that height and normal queries at locations on the patch are answered by
+    /// interpolation on the grid (consistent with the triangulation of the contact mesh), rather than through ray
+    /// casting. This requires that the patch vertical direction coincides with the world vertical; otherwise, queries
+    /// fall back on ray casting.
     std::shared_ptr<Patch> AddPatch(
         std::shared_ptr<ChMaterialSurface> material,  ///< [in] contact material
         const ChCoordsys<>& position,                 ///< [in] patch location and orientation
@@ -173,6 +190,23 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// See UseLocationDependentFriction.
     virtual float GetCoefficientFriction(const ChVector<>& loc) const override;
 
+    /// Get the terrain height, normal, and coefficient of friction at the point below the specified location.
+    /// All three quantities are obtained from a single query of the terrain patches.
+    virtual void GetProperties(const ChVector<>& loc,
+                               double& height,
+                               ChVector<>& normal,
+                               float& friction) const override;
+
+    /// Get the terrain heights, normals, and coefficients of friction at the points below the specified locations.
+    /// All locations are processed in a single pass over the terrain patches (see FindPoint).
+    virtual void GetProperties(const std::vector<ChVector<>>& loc,
+                               std::vector<double>& height,
+                               std::vector<ChVector<>>& normal,
+                               std::vector<float>& friction) const override;
+
+    /// Return true if the terrain was initialized (see FindPoint).
+    virtual bool SupportsConcurrentQueries() const override { return m_initialized; }
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -180,7 +214,10 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     void ExportMeshWavefront(const std::string& out_dir);
 
     /// Find the terrain height, normal, and coefficient of friction at the point below the specified location.
-    /// The point on the terrain surface is obtained through ray casting into the terrain contact model.
+    /// For box patches, the point on the terrain surface is obtained analytically. For mesh patches, it is obtained
+    /// through a vertical ray cast into a bounding volume hierarchy built over the patch mesh at initialization (see
+    /// ChTerrainMeshBVH), independently of the collision system. Height-map patches are queried on their height grid.
+    /// After Initialize, this function is thread safe.
     /// The return value is 'true' if the ray intersection succeeded and 'false' otherwise (in which case
     /// the output is set to heigh=0, normal=[0,0,1], and friction=0.8).
     bool FindPoint(const ChVector<> loc, double& height, ChVector<>& normal, float& friction) const;
@@ -206,21 +243,46 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         std::shared_ptr<geometry::ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<geometry::ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                                       ///< name of associated mesh
+        std::shared_ptr<ChTerrainMeshBVH> m_bvh;                       ///< hierarchy for height queries
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
+        void InitializeVisualization();
+    };
+
+    /// Patch represented as a mesh generated from a height map.
+    /// The regular grid of heights is cached and used to answer queries without ray casting.
+    struct CH_VEHICLE_API HeightMapPatch : public MeshPatch {
+        int m_nx;                       ///< number of grid vertices in the X direction
+        int m_ny;                       ///< number of grid vertices in the Y direction
+        double m_dx;                    ///< grid spacing in the X direction
+        double m_dy;                    ///< grid spacing in the Y direction
+        double m_hlength;               ///< patch half-length
+        double m_hwidth;                ///< patch half-width
+        std::vector<double> m_heights;  ///< grid heights (patch ISO frame), row by row from the (-X,-Y) corner
+        bool m_use_grid;                ///< answer queries from the height grid (patch aligned with world vertical)
+        virtual void Initialize() override;
+        virtual bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const override;
     };
 
     ChSystem* m_system;
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
+    bool m_initialized;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
 
     void AddPatch(std::shared_ptr<Patch> patch,
                   const ChCoordsys<>& position,
                   std::shared_ptr<ChMaterialSurface> material);
+    std::shared_ptr<Patch> AddMeshPatch(std::shared_ptr<ChMaterialSurface> material,
+                                        const ChCoordsys<>& position,
+                                        std::shared_ptr<geometry::ChTriangleMeshConnected> mesh,
+                                        std::shared_ptr<geometry::ChTriangleMeshSoup> mesh_soup,
+                                        const std::string& mesh_name,
+                                        double sweep_sphere_radius,
+                                        bool visualization);
     void LoadPatch(const rapidjson::Value& a);
 
     int m_collision_family;
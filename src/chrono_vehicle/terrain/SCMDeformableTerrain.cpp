@@ -174,6 +174,11 @@ double SCMDeformableTerrain::GetTestHeight() const {
     return m_ground->m_test_offset_up;
 }
 
+// Set the storage type for modified grid nodes.
+void SCMDeformableTerrain::SetGridStorage(GridStorage storage) {
+    m_ground->m_grid_map.SetType(storage);
+}
+
 // Set the color plot type.
 void SCMDeformableTerrain::SetPlotType(DataPlotType plot_type, double min_val, double max_val) {
     m_ground->m_plot_type = plot_type;
@@ -264,6 +269,11 @@ int SCMDeformableTerrain::GetNumErosionNodes() const {
     return m_ground->m_num_erosion_nodes;
 }
 
+// Return the total number of modified grid nodes.
+int SCMDeformableTerrain::GetNumModifiedNodes() const {
+    return static_cast<int>(m_ground->m_grid_map.Size());
+}
+
 // Timer information
 double SCMDeformableTerrain::GetTimerMovingPatches() const {
     return 1e3 * m_ground->m_timer_moving_patches();
@@ -306,6 +316,11 @@ void SCMDeformableTerrain::PrintStepStatistics(std::ostream& os) const {
     os << "   Number ray hits:         " << m_ground->m_num_ray_hits << std::endl;
     os << "   Number contact patches:  " << m_ground->m_num_contact_patches << std::endl;
     os << "   Number erosion nodes:    " << m_ground->m_num_erosion_nodes << std::endl;
+    os << "   Number modified nodes:   " << m_ground->m_grid_map.Size() << std::endl;
+    if (m_ground->m_grid_map.GetNumTiles() > 0) {
+        os << "   Number grid tiles:       " << m_ground->m_grid_map.GetNumTiles() << std::endl;
+        os << "   Number dirty grid tiles: " << m_ground->m_grid_map.GetNumDirtyTiles() << std::endl;
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -321,6 +336,158 @@ SCMContactableData::SCMContactableData(double area_ratio,
       Mohr_mu(std::tan(Mohr_friction * CH_C_DEG_TO_RAD)),
       Janosi_shear(Janosi_shear) {}
 
+// -----------------------------------------------------------------------------
+// Storage of modified grid nodes
+// -----------------------------------------------------------------------------
+
+SCMDeformableSoil::NodeStore::NodeStore()
+    : m_type(SCMDeformableTerrain::GridStorage::HASH_MAP),
+      m_num_nodes(0),
+      m_ti_min(0),
+      m_tj_min(0),
+      m_nti(0),
+      m_ntj(0),
+      m_num_tiles(0) {}
+
+void SCMDeformableSoil::NodeStore::SetType(SCMDeformableTerrain::GridStorage type) {
+    m_type = type;
+    m_num_nodes = 0;
+    m_map.clear();
+    m_tiles.clear();
+    m_ti_min = 0;
+    m_tj_min = 0;
+    m_nti = 0;
+    m_ntj = 0;
+    m_num_tiles = 0;
+}
+
+SCMDeformableSoil::NodeStore::Tile* SCMDeformableSoil::NodeStore::FindTile(const ChVector2<int>& ij) const {
+    int ti = TileCoord(ij.x()) - m_ti_min;
+    int tj = TileCoord(ij.y()) - m_tj_min;
+    if (ti < 0 || ti >= m_nti || tj < 0 || tj >= m_ntj)
+        return nullptr;
+    return m_tiles[ti + m_nti * tj].get();
+}
+
+SCMDeformableSoil::NodeRecord* SCMDeformableSoil::NodeStore::Find(const ChVector2<int>& ij) {
+    return const_cast<NodeRecord*>(static_cast<const NodeStore*>(this)->Find(ij));
+}
+
+const SCMDeformableSoil::NodeRecord* SCMDeformableSoil::NodeStore::Find(const ChVector2<int>& ij) const {
+    if (m_type == SCMDeformableTerrain::GridStorage::HASH_MAP) {
+        auto p = m_map.find(ij);
+        return (p != m_map.end()) ? &p->second : nullptr;
+    }
+
+    auto tile = FindTile(ij);
+    if (!tile)
+        return nullptr;
+    int k = TileIndex(ij);
+    return tile->valid[k] ? &tile->nodes[k] : nullptr;
+}
+
+SCMDeformableSoil::NodeRecord& SCMDeformableSoil::NodeStore::At(const ChVector2<int>& ij) {
+    auto nr = Find(ij);
+    assert(nr);
+    return *nr;
+}
+
+const SCMDeformableSoil::NodeRecord& SCMDeformableSoil::NodeStore::At(const ChVector2<int>& ij) const {
+    auto nr = Find(ij);
+    assert(nr);
+    return *nr;
+}
+
+SCMDeformableSoil::NodeRecord& SCMDeformableSoil::NodeStore::Insert(const ChVector2<int>& ij, const NodeRecord& nr) {
+    if (m_type == SCMDeformableTerrain::GridStorage::HASH_MAP) {
+        auto p = m_map.insert(std::make_pair(ij, nr));
+        if (p.second)
+            m_num_nodes++;
+        return p.first->second;
+    }
+
+    int ti = TileCoord(ij.x());
+    int tj = TileCoord(ij.y());
+    if (ti < m_ti_min || ti >= m_ti_min + m_nti || tj < m_tj_min || tj >= m_tj_min + m_ntj)
+        GrowTiles(ti, tj);
+
+    auto& tile = m_tiles[(ti - m_ti_min) + m_nti * (tj - m_tj_min)];
+    if (!tile) {
+        tile = std::unique_ptr<Tile>(new Tile);
+        tile->nodes.resize(TILE_SIZE * TILE_SIZE);
+        tile->valid.resize(TILE_SIZE * TILE_SIZE, false);
+        tile->dirty = false;
+        m_num_tiles++;
+    }
+
+    int k = TileIndex(ij);
+    if (!tile->valid[k]) {
+        tile->nodes[k] = nr;
+        tile->valid[k] = true;
+        tile->dirty = true;
+        m_num_nodes++;
+    }
+    return tile->nodes[k];
+}
+
+void SCMDeformableSoil::NodeStore::GrowTiles(int ti, int tj) {
+    // New directory range (grow by at least a few tiles in each direction to amortize reallocations)
+    const int pad = 4;
+    int ti_min = m_ti_min;
+    int tj_min = m_tj_min;
+    int ti_max = m_ti_min + m_nti - 1;
+    int tj_max = m_tj_min + m_ntj - 1;
+    if (m_nti == 0) {
+        ti_min = ti - pad;
+        ti_max = ti + pad;
+        tj_min = tj - pad;
+        tj_max = tj + pad;
+    }
+    if (ti < ti_min)
+        ti_min = ti - pad;
+    if (ti > ti_max)
+        ti_max = ti + pad;
+    if (tj < tj_min)
+        tj_min = tj - pad;
+    if (tj > tj_max)
+        tj_max = tj + pad;
+
+    int nti = ti_max - ti_min + 1;
+    int ntj = tj_max - tj_min + 1;
+    std::vector<std::unique_ptr<Tile>> tiles(nti * ntj);
+
+    // Move existing tiles (tile objects themselves are not relocated)
+    for (int j = 0; j < m_ntj; j++) {
+        for (int i = 0; i < m_nti; i++) {
+            int ii = i + m_ti_min - ti_min;
+            int jj = j + m_tj_min - tj_min;
+            tiles[ii + nti * jj] = std::move(m_tiles[i + m_nti * j]);
+        }
+    }
+
+    m_tiles = std::move(tiles);
+    m_ti_min = ti_min;
+    m_tj_min = tj_min;
+    m_nti = nti;
+    m_ntj = ntj;
+}
+
+int SCMDeformableSoil::NodeStore::GetNumDirtyTiles() const {
+    int num_dirty = 0;
+    for (const auto& tile : m_tiles) {
+        if (tile && tile->dirty)
+            num_dirty++;
+    }
+    return num_dirty;
+}
+
+void SCMDeformableSoil::NodeStore::ResetDirtyTiles() {
+    for (auto& tile : m_tiles) {
+        if (tile)
+            tile->dirty = false;
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Implementation of SCMDeformableSoil
 // -----------------------------------------------------------------------------
@@ -683,16 +850,15 @@ SCMDeformableTerrain::NodeInfo SCMDeformableSoil::GetNodeInfo(const ChVector<>&
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2<int> ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the map of modified nodes
+    if (auto p = m_grid_map.Find(ij)) {
+        ni.sinkage = p->sinkage;
+        ni.sinkage_plastic = p->sinkage_plastic;
+        ni.sinkage_elastic = p->sinkage_elastic;
+        ni.sigma = p->sigma;
+        ni.sigma_yield = p->sigma_yield;
+        ni.kshear = p->kshear;
+        ni.tau = p->tau;
         return ni;
     }
 
@@ -776,10 +942,9 @@ ChVector<> SCMDeformableSoil::GetInitNormal(const ChVector2<int>& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMDeformableSoil::GetHeight(const ChVector2<int>& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the map of modified nodes
+    if (auto p = m_grid_map.Find(loc))
+        return p->level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -996,10 +1161,6 @@ static const std::vector<ChVector2<int>> neighbors4{
     ChVector2<int>(0, 1)    // N
 };
 
-// Default implementation uses Map-Reduce for collecting ray intersection hits.
-// The alternative is to simultaenously load the global map of hits while ray casting (using a critical section).
-////#define RAY_CASTING_WITH_CRITICAL_SECTION
-
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMDeformableSoil::ComputeInternalForces() {
     // Initialize list of modified visualization mesh vertices (use any externally modified vertices)
@@ -1009,7 +1170,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
     for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+        auto& nr = m_grid_map.At(ij);
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -1025,6 +1186,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
     }
 
     m_modified_nodes.clear();
+    m_grid_map.ResetDirtyTiles();
 
     // Reset timers
     m_timer_moving_patches.reset();
@@ -1063,13 +1225,6 @@ void SCMDeformableSoil::ComputeInternalForces() {
     // Perform ray casting tests
     // -------------------------
 
-    // Information of vertices with ray-cast hits
-    struct HitRecord {
-        ChContactable* contactable;  // pointer to hit object
-        ChVector<> abs_point;        // hit point, expressed in global frame
-        int patch_id;                // index of associated patch id
-    };
-
     // Hash-map for vertices with ray-cast hits
     std::unordered_map<ChVector2<int>, HitRecord, CoordHash> hits;
 
@@ -1078,64 +1233,13 @@ void SCMDeformableSoil::ComputeInternalForces() {
 
     m_timer_ray_casting.start();
 
-#ifdef RAY_CASTING_WITH_CRITICAL_SECTION
-
-    int nthreads = GetSystem()->GetNumThreadsChrono();
-
-    // Loop through all moving patches (user-defined or default one)
-    for (auto& p : m_patches) {
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            ChVector2<int> ij = p.m_range[k];
-
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z;
-    #pragma omp critical(SCM_ray_casting)
-            z = GetHeight(ij);
-
-            ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
-
-            // Create ray at current grid location
-            collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector<> from = to - m_Z * m_test_offset_down;
-
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-    #pragma omp critical(SCM_ray_casting)
-                {
-                    // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-                    }
-
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
-                    m_num_ray_hits++;
-                }
-            }
-        }
-        m_num_ray_casts += num_ray_casts;
-    }
-
-#else
-
-    // Map-reduce approach (to eliminate critical section)
-
+    // Each thread appends its hits to a private buffer, so that no synchronization is needed while ray casting.
+    // The buffers are merged in the global map of hits after the parallel region. With a static schedule, each thread
+    // processes a contiguous chunk of the patch range and merging the buffers in thread order reproduces the order of
+    // a sequential traversal (the result does not depend on the number of threads).
     const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2<int>, HitRecord, CoordHash>> t_hits(nthreads);
+    if ((int)m_thread_hits.size() < nthreads)
+        m_thread_hits.resize(nthreads);
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
@@ -1143,8 +1247,8 @@ void SCMDeformableSoil::ComputeInternalForces() {
 
         // Loop through all vertices in the patch range
         int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
+    #pragma omp parallel for schedule(static) num_threads(nthreads) reduction(+ : num_ray_casts)
+        for (int k = 0; k < (int)p.m_range.size(); k++) {
             int t_num = ChOMP::GetThreadNum();
             ChVector2<int> ij = p.m_range[k];
 
@@ -1169,9 +1273,9 @@ void SCMDeformableSoil::ComputeInternalForces() {
             num_ray_casts++;
 
             if (mrayhit_result.hit) {
-                // Add to our map of hits to process
+                // Add to the buffer of hits for this thread
                 HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
+                m_thread_hits[t_num].push_back(std::make_pair(ij, record));
             }
         }
 
@@ -1179,25 +1283,26 @@ void SCMDeformableSoil::ComputeInternalForces() {
 
         m_num_ray_casts += num_ray_casts;
 
-        // Sequential insertion in global hits
+        // Sequential merge of the per-thread buffers in the global map of hits
+        size_t num_patch_hits = 0;
+        for (int t_num = 0; t_num < nthreads; t_num++)
+            num_patch_hits += m_thread_hits[t_num].size();
+        hits.reserve(hits.size() + num_patch_hits);
+
         for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
+            for (const auto& h : m_thread_hits[t_num]) {
                 // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
+                if (!m_grid_map.Find(h.first)) {
                     double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
+                    m_grid_map.Insert(h.first, NodeRecord(z, z, GetInitNormal(h.first)));
                 }
-                ////hits.insert(h);
+                hits.insert(h);
             }
-
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
+            m_thread_hits[t_num].clear();
         }
         m_num_ray_hits = (int)hits.size();
     }
 
-#endif
-
     m_timer_ray_casting.stop();
 
     // --------------------
@@ -1299,7 +1404,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
     for (auto& h : hits) {
         ChVector2<> ij = h.first;
 
-        auto& nr = m_grid_map.at(ij);      // node record
+        auto& nr = m_grid_map.At(ij);      // node record
         const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
 
         ChContactable* contactable = h.second.contactable;
@@ -1459,7 +1564,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
             // Calculate the displaced material from all touched nodes and identify boundary
             double tot_step_flow = 0;
             for (const auto& ij : p.nodes) {                     // for each node in contact patch
-                const auto& nr = m_grid_map.at(ij);              //   get node record
+                const auto& nr = m_grid_map.At(ij);              //   get node record
                 if (nr.sigma <= 0)                               //   if node not touched
                     continue;                                    //     skip (not in effective patch)
                 tot_step_flow += nr.step_plastic_flow;           //   accumulate displaced material
@@ -1467,10 +1572,11 @@ void SCMDeformableSoil::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
+                    auto nbr_nr = m_grid_map.Find(nbr_ij);       //     neighbor record
+                    if (!nbr_nr)                                 //     if neighbor not yet recorded
+                        p_boundary.insert(nbr_ij);               //       set neighbor as boundary
+                    else if (nbr_nr->sigma <= 0)                 //     if neighbor not touched
+                        p_boundary.insert(nbr_ij);               //       set neighbor as boundary
                 }
             }
             tot_step_flow *= GetSystem()->GetStep();
@@ -1481,13 +1587,13 @@ void SCMDeformableSoil::ComputeInternalForces() {
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
             for (const auto& ij : p_boundary) {                                  // for each node in bndry
                 m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
+                if (!m_grid_map.Find(ij)) {                                      //   if not yet recorded
                     double z = GetInitHeight(ij);                                //     undeformed height
                     const ChVector<>& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
+                    m_grid_map.Insert(ij, NodeRecord(z, z, n));                  //     add new node record
                     m_modified_nodes.push_back(ij);                              //     mark as modified
                 }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
+                auto& nr = m_grid_map.At(ij);                                    //   node record
                 nr.erosion = true;                                               //   add to erosion domain
                 AddMaterialToNode(diff, nr);                                     //   add raise amount
             }
@@ -1511,16 +1617,16 @@ void SCMDeformableSoil::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
+                    if (!m_grid_map.Find(nbr_ij)) {                     //   if neighbor not yet recorded
                         double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
                         const ChVector<>& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
                         NodeRecord nr(z, z, n);                         //     create new record
                         nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
+                        m_grid_map.Insert(nbr_ij, nr);                  //     add new node record
                         front.insert(nbr_ij);                           //     add neighbor to new front
                         m_modified_nodes.push_back(nbr_ij);             //     mark as modified
                     } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
+                        NodeRecord& nr = m_grid_map.At(nbr_ij);         //     get existing record
                         if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
                             nr.erosion = true;                          //       include in erosion domain
                             front.insert(nbr_ij);                       //       add neighbor to new front
@@ -1541,13 +1647,13 @@ void SCMDeformableSoil::ComputeInternalForces() {
 
         for (int iter = 0; iter < m_erosion_iterations; iter++) {
             for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
+                auto& nr = m_grid_map.At(ij);
                 for (int k = 0; k < 4; k++) {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    auto rec = m_grid_map.Find(nbr_ij);
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1592,7 +1698,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
         for (const auto& ij : m_modified_nodes) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
                 continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+            const auto& nr = m_grid_map.At(ij);       // grid node record
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
@@ -1715,14 +1821,14 @@ void SCMDeformableSoil::UpdateMeshVertexNormal(const ChVector2<int> ij, int iv)
 std::vector<SCMDeformableTerrain::NodeLevel> SCMDeformableSoil::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMDeformableTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        nodes.reserve(m_grid_map.Size());
+        m_grid_map.ForEach([&nodes](const ChVector2<int>& ij, const NodeRecord& nr) {
+            nodes.push_back(std::make_pair(ij, nr.level));
+        });
     } else {
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            const auto& nr = m_grid_map.At(ij);
+            nodes.push_back(std::make_pair(ij, nr.level));
         }
     }
     return nodes;
@@ -1734,7 +1840,8 @@ std::vector<SCMDeformableTerrain::NodeLevel> SCMDeformableSoil::GetModifiedNodes
 void SCMDeformableSoil::SetModifiedNodes(const std::vector<SCMDeformableTerrain::NodeLevel>& nodes) {
     for (const auto& n : nodes) {
         // Modify existing entry in grid map or insert new one
-        m_grid_map[n.first] = SCMDeformableSoil::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+        SCMDeformableSoil::NodeRecord nr(n.second, n.second, GetInitNormal(n.first));
+        m_grid_map.Insert(n.first, nr) = nr;
     }
 
     // Update visualization
@@ -1743,7 +1850,7 @@ void SCMDeformableSoil::SetModifiedNodes(const std::vector<SCMDeformableTerrain:
             auto ij = n.first;                           // grid location
             if (!CheckMeshBounds(ij))                    // if outside mesh
                 continue;                                //   do nothing
-            const auto& nr = m_grid_map.at(ij);          // grid node record
+            const auto& nr = m_grid_map.At(ij);          // grid node record
             int iv = GetMeshVertexIndex(ij);             // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
             if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
@@ -22,7 +22,9 @@
 
 #include <string>
 #include <ostream>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/assets/ChTriangleMeshShape.h"
 #include "chrono/physics/ChBody.h"
@@ -67,6 +69,12 @@ class CH_VEHICLE_API SCMDeformableTerrain : public ChTerrain {
         PLOT_MASSREMAINDER
     };
 
+    /// Storage type for the modified SCM grid nodes.
+    enum class GridStorage {
+        HASH_MAP,  ///< hash map keyed by the grid coordinates of the node
+        TILED      ///< blocks of nodes, allocated on first touch and addressed by direct index
+    };
+
     /// Information at SCM node.
     struct NodeInfo {
         double sinkage;          ///< sinkage, along local normal direction
@@ -133,6 +141,13 @@ class CH_VEHICLE_API SCMDeformableTerrain : public ChTerrain {
     ///  Return the current test height level.
     double GetTestHeight() const;
 
+    /// Set the storage type for the modified SCM grid nodes (default: GridStorage::HASH_MAP).
+    /// With GridStorage::TILED, nodes are stored in square tiles of 64x64 nodes which are allocated the first time one
+    /// of their nodes is modified. Node lookups then reduce to direct indexing, at the cost of allocating entire tiles.
+    /// This is typically faster for long simulations over large terrain patches, where the number of modified nodes
+    /// becomes large. This function must be called before Initialize().
+    void SetGridStorage(GridStorage storage);
+
     /// Set the color plot type for the soil mesh.
     /// When a scalar plot is used, also define the range in the pseudo-color colormap.
     void SetPlotType(DataPlotType plot_type, double min_val, double max_val);
@@ -271,6 +286,8 @@ class CH_VEHICLE_API SCMDeformableTerrain : public ChTerrain {
     int GetNumContactPatches() const;
     /// Return the number of nodes in the erosion domain at last step (bulldosing effects).
     int GetNumErosionNodes() const;
+    /// Return the total number of modified grid nodes (since the start of simulation).
+    int GetNumModifiedNodes() const;
 
     /// Return time for updating moving patches at last step (ms).
     double GetTimerMovingPatches() const;
@@ -404,6 +421,88 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
         std::size_t operator()(const ChVector2<int>& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Information of a grid node with a ray-cast hit
+    struct HitRecord {
+        ChContactable* contactable;  // pointer to hit object
+        ChVector<> abs_point;        // hit point, expressed in global frame
+        int patch_id;                // index of associated patch id
+    };
+
+    // Per-thread buffer of ray-cast hits
+    typedef std::vector<std::pair<ChVector2<int>, HitRecord>> HitBuffer;
+
+    // Persistent storage of the records of modified grid nodes.
+    // Records are kept either in a hash map or in square tiles of nodes. Tiles are allocated the first time one of
+    // their nodes is inserted and are addressed by direct index in a dense tile directory (grown as needed to cover
+    // all touched tiles). In both cases, references to node records remain valid after further insertions.
+    // Lookups can be performed concurrently; insertions are not thread safe.
+    class NodeStore {
+      public:
+        NodeStore();
+
+        // Set the storage type (this also removes all node records).
+        void SetType(SCMDeformableTerrain::GridStorage type);
+
+        // Return the record of the specified node (nullptr if the node was never modified).
+        NodeRecord* Find(const ChVector2<int>& ij);
+        const NodeRecord* Find(const ChVector2<int>& ij) const;
+
+        // Return the record of the specified node, which must exist.
+        NodeRecord& At(const ChVector2<int>& ij);
+        const NodeRecord& At(const ChVector2<int>& ij) const;
+
+        // Return the record of the specified node, inserting the given record if the node does not yet exist.
+        NodeRecord& Insert(const ChVector2<int>& ij, const NodeRecord& nr);
+
+        // Return the number of node records.
+        size_t Size() const { return m_num_nodes; }
+
+        // Invoke the given function on all node records.
+        template <typename Func>
+        void ForEach(Func f) const;
+
+        // Return the number of allocated tiles (TILED storage only).
+        int GetNumTiles() const { return m_num_tiles; }
+
+        // Return the number of tiles with nodes inserted since the last call to ResetDirtyTiles (TILED storage only).
+        int GetNumDirtyTiles() const;
+
+        // Clear the dirty flags of all tiles.
+        void ResetDirtyTiles();
+
+      private:
+        static const int TILE_BITS = 6;  // tiles of (2^TILE_BITS) x (2^TILE_BITS) nodes
+        static const int TILE_SIZE = 1 << TILE_BITS;
+
+        struct Tile {
+            std::vector<NodeRecord> nodes;  // node records (row-major in tile)
+            std::vector<bool> valid;        // flags for existing node records
+            bool dirty;                     // nodes inserted in this tile since last reset
+        };
+
+        // Tile coordinates of a grid node (floor division, through arithmetic shift) and node index within its tile
+        static int TileCoord(int i) { return i >> TILE_BITS; }
+        static int TileIndex(const ChVector2<int>& ij) {
+            return (ij.x() & (TILE_SIZE - 1)) + TILE_SIZE * (ij.y() & (TILE_SIZE - 1));
+        }
+
+        // Return the tile containing the specified node (nullptr if not allocated)
+        Tile* FindTile(const ChVector2<int>& ij) const;
+
+        // Grow the tile directory so that it includes the specified tile coordinates
+        void GrowTiles(int ti, int tj);
+
+        SCMDeformableTerrain::GridStorage m_type;
+        size_t m_num_nodes;
+
+        std::unordered_map<ChVector2<int>, NodeRecord, CoordHash> m_map;  // HASH_MAP storage
+
+        std::vector<std::unique_ptr<Tile>> m_tiles;  // TILED storage: dense tile directory (row-major)
+        int m_ti_min, m_tj_min;                      // tile coordinates of first directory entry
+        int m_nti, m_ntj;                            // directory dimensions
+        int m_num_tiles;                             // number of allocated tiles
+    };
+
     // Create visualization mesh
     void CreateVisualizationMesh(double sizeX, double sizeY);
 
@@ -512,8 +611,10 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
 
     ChMatrixDynamic<> m_heights;  // (base) grid heights (when initializing from height-field map)
 
-    std::unordered_map<ChVector2<int>, NodeRecord, CoordHash> m_grid_map;  // modified grid nodes (persistent)
-    std::vector<ChVector2<int>> m_modified_nodes;                          // modified grid nodes (current)
+    NodeStore m_grid_map;                          // modified grid nodes (persistent)
+    std::vector<ChVector2<int>> m_modified_nodes;  // modified grid nodes (current)
+
+    std::vector<HitBuffer> m_thread_hits;  // per-thread ray-cast hits (reused across steps)
 
     std::vector<MovingPatchInfo> m_patches;  // set of active moving patches
     bool m_moving_patch;                     // user-specified moving patches?
@@ -573,6 +674,30 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
     friend class SCMDeformableTerrain;
 };
 
+template <typename Func>
+void SCMDeformableSoil::NodeStore::ForEach(Func f) const {
+    if (m_type == SCMDeformableTerrain::GridStorage::HASH_MAP) {
+        for (const auto& nr : m_map)
+            f(nr.first, nr.second);
+        return;
+    }
+
+    for (int tj = 0; tj < m_ntj; tj++) {
+        for (int ti = 0; ti < m_nti; ti++) {
+            const auto& tile = m_tiles[ti + m_nti * tj];
+            if (!tile)
+                continue;
+            for (int k = 0; k < TILE_SIZE * TILE_SIZE; k++) {
+                if (tile->valid[k]) {
+                    ChVector2<int> ij((m_ti_min + ti) * TILE_SIZE + k % TILE_SIZE,
+                                      (m_tj_min + tj) * TILE_SIZE + k / TILE_SIZE);
+                    f(ij, tile->nodes[k]);
+                }
+            }
+        }
+    }
+}
+
 /// @} vehicle_terrain
 
 }  // end namespace vehicle
@@ -22,6 +22,8 @@
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackedVehicle.h"
 
+#include "chrono/utils/ChTraceProfiler.h"
+
 #include "chrono_thirdparty/rapidjson/document.h"
 #include "chrono_thirdparty/rapidjson/prettywriter.h"
 #include "chrono_thirdparty/rapidjson/stringbuffer.h"
@@ -76,6 +78,8 @@ void ChTrackedVehicle::Synchronize(double time,
                                    const DriverInputs& driver_inputs,
                                    const TerrainForces& shoe_forces_left,
                                    const TerrainForces& shoe_forces_right) {
+    CH_PROFILE_ZONE("TrackedVehicle::Synchronize");
+
     // Let the driveline combine driver inputs if needed.
     double braking_left, braking_right;
     m_driveline->CombineDriverInputs(driver_inputs, braking_left, braking_right);
@@ -115,6 +119,8 @@ void ChTrackedVehicle::Synchronize(double time,
 // Advance the state of this vehicle by the specified time step.
 // -----------------------------------------------------------------------------
 void ChTrackedVehicle::Advance(double step) {
+    CH_PROFILE_ZONE("TrackedVehicle::Advance");
+
     if (m_powertrain) {
         // Advance state of the associated powertrain.
         m_powertrain->Advance(step);
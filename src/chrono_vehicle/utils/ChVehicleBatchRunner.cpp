@@ -0,0 +1,181 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Runner for batches of independent vehicle simulations (e.g., parameter
+// sweeps), executed concurrently on a pool of worker threads.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <fstream>
+#include <thread>
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/utils/ChVehicleBatchRunner.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChVehicleBatchRunner::ChVehicleBatchRunner(const ChSystem& prototype)
+    : m_prototype(prototype), m_num_threads(ChOMP::GetNumProcs()), m_wall_time(0) {}
+
+void ChVehicleBatchRunner::SetNumThreads(int num_threads) {
+    m_num_threads = std::max(num_threads, 1);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleBatchRunner::Run(int num_instances, const InstanceFactory& factory, double end_time, double step) {
+    m_results.clear();
+    m_results.resize(num_instances);
+
+    // Instances are assigned dynamically to the worker threads.
+    // An exception thrown while simulating an instance stops all workers and is rethrown at the end of the batch.
+    std::atomic<int> next_index(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+
+    auto worker = [&]() {
+        while (!failed) {
+            int index = next_index++;
+            if (index >= num_instances)
+                break;
+            try {
+                RunInstance(index, factory, end_time, step);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (!failed)
+                    exception = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    ChTimer<> timer;
+    timer.start();
+
+    // The calling thread acts as one of the workers
+    int num_workers = std::min(m_num_threads, num_instances);
+    std::vector<std::thread> threads;
+    for (int i = 1; i < num_workers; i++)
+        threads.push_back(std::thread(worker));
+    worker();
+    for (auto& t : threads)
+        t.join();
+
+    timer.stop();
+    m_wall_time = timer();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void ChVehicleBatchRunner::RunInstance(int index, const InstanceFactory& factory, double end_time, double step) {
+    ChTimer<> timer;
+    timer.start();
+
+    // Create the instance system as a clone of the prototype (single-threaded, as instances run concurrently).
+    // Note that the instance must be destroyed before its system.
+    std::unique_ptr<ChSystem> system(m_prototype.Clone());
+    system->SetNumThreads(1, 1, 1);
+
+    auto instance = factory(index);
+    instance->Construct(system.get(), *this);
+
+    int num_steps = 0;
+    double time = system->GetChTime();
+    while (time < end_time && !instance->Done(time)) {
+        instance->Synchronize(time);
+        instance->Advance(step);
+        system->DoStepDynamics(step);
+        time = system->GetChTime();
+        num_steps++;
+    }
+
+    timer.stop();
+
+    Result& result = m_results[index];
+    result.sim_time = time;
+    result.num_steps = num_steps;
+    result.wall_time = timer();
+    result.values = instance->GetResults();
+}
+
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<geometry::ChTriangleMeshConnected> ChVehicleBatchRunner::GetSharedMesh(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(m_data_mutex);
+
+    auto it = m_meshes.find(filename);
+    if (it != m_meshes.end())
+        return it->second;
+
+    auto mesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(filename, true, true);
+    m_meshes[filename] = mesh;
+    return mesh;
+}
+
+const rapidjson::Document& ChVehicleBatchRunner::GetSharedJSON(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(m_data_mutex);
+
+    auto it = m_json.find(filename);
+    if (it != m_json.end())
+        return *it->second;
+
+    auto d = std::unique_ptr<rapidjson::Document>(new rapidjson::Document);
+    ReadFileJSON(filename, *d);
+    auto& doc = *d;
+    m_json[filename] = std::move(d);
+    return doc;
+}
+
+// -----------------------------------------------------------------------------
+
+double ChVehicleBatchRunner::GetSimulatedTime() const {
+    double sim_time = 0;
+    for (const auto& r : m_results)
+        sim_time += r.sim_time;
+    return sim_time;
+}
+
+double ChVehicleBatchRunner::GetThroughput() const {
+    if (m_wall_time <= 0)
+        return 0;
+    int num_workers = std::max(std::min(m_num_threads, (int)m_results.size()), 1);
+    return GetSimulatedTime() / (m_wall_time * num_workers);
+}
+
+void ChVehicleBatchRunner::WriteResults(const std::string& filename, const std::string& delim) const {
+    std::ofstream ofile(filename);
+
+    ofile << "instance" << delim << "sim_time" << delim << "num_steps" << delim << "wall_time";
+    for (const auto& name : m_result_names)
+        ofile << delim << name;
+    ofile << "\n";
+
+    for (size_t i = 0; i < m_results.size(); i++) {
+        const auto& r = m_results[i];
+        ofile << i << delim << r.sim_time << delim << r.num_steps << delim << r.wall_time;
+        for (const auto& v : r.values)
+            ofile << delim << v;
+        ofile << "\n";
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
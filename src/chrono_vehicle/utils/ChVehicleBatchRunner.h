@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Runner for batches of independent vehicle simulations (e.g., parameter
+// sweeps), executed concurrently on a pool of worker threads.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_BATCH_RUNNER_H
+#define CH_VEHICLE_BATCH_RUNNER_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChSystem.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+#include "chrono_thirdparty/rapidjson/document.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_utils
+/// @{
+
+/// Runner for a batch of independent vehicle simulations.
+/// Each member of the batch (an instance) is simulated in its own Chrono system, obtained by cloning a prototype
+/// system (see ChSystem::Clone), so that all instances share the same solver, integrator, and collision settings. The
+/// instances are distributed dynamically over a pool of worker threads; each instance system is stepped by a single
+/// thread. Data loaded from files (triangle meshes and JSON specification files) can be shared read-only between
+/// instances through the runner, so that it is only loaded once per batch.
+///
+/// At the end of the batch, the runner collects one row of results per instance (instance index, simulated time,
+/// number of steps, wall-clock time, and user-defined quantities) in a result table.
+class CH_VEHICLE_API ChVehicleBatchRunner {
+  public:
+    /// Base class for a member of the batch.
+    /// A concrete instance constructs its vehicle, terrain, and driver in the system provided by the runner and
+    /// synchronizes and advances them at each step. The runner advances the system dynamics.
+    class CH_VEHICLE_API Instance {
+      public:
+        virtual ~Instance() {}
+
+        /// Construct and initialize the vehicle, terrain, and driver for this instance in the given (empty) system.
+        /// Shared data should be obtained through the runner (see GetSharedMesh and GetSharedJSON).
+        /// This function is called from a worker thread.
+        virtual void Construct(ChSystem* system, ChVehicleBatchRunner& runner) = 0;
+
+        /// Synchronize all subsystems at the specified time.
+        virtual void Synchronize(double time) = 0;
+
+        /// Advance the state of all subsystems by the specified step (excluding the system dynamics).
+        virtual void Advance(double step) = 0;
+
+        /// Return true to stop the simulation of this instance before the batch end time (default: false).
+        virtual bool Done(double time) const { return false; }
+
+        /// Return the user-defined results for this instance, one value per result name (see SetResultNames).
+        /// This function is called once, at the end of the simulation of this instance.
+        virtual std::vector<double> GetResults() const { return std::vector<double>(); }
+    };
+
+    /// Function for creating the instance with given index in the batch.
+    typedef std::function<std::unique_ptr<Instance>(int index)> InstanceFactory;
+
+    /// Construct a batch runner using the specified prototype system.
+    /// The prototype system is only used to create the instance systems (through ChSystem::Clone); it is not modified.
+    ChVehicleBatchRunner(const ChSystem& prototype);
+
+    ~ChVehicleBatchRunner() {}
+
+    /// Set the number of worker threads (default: number of available processors).
+    void SetNumThreads(int num_threads);
+
+    /// Set the names of the user-defined results returned by each instance.
+    void SetResultNames(const std::vector<std::string>& names) { m_result_names = names; }
+
+    /// Run the batch.
+    /// Create 'num_instances' instances with the provided factory and simulate each of them up to the specified end
+    /// time (or until the instance indicates it is done), using the given step size.
+    void Run(int num_instances, const InstanceFactory& factory, double end_time, double step);
+
+    /// Return a triangle mesh loaded from the specified Wavefront OBJ file, shared by all instances.
+    /// The mesh is loaded on the first request; all instances must treat it as read-only.
+    std::shared_ptr<geometry::ChTriangleMeshConnected> GetSharedMesh(const std::string& filename);
+
+    /// Return the JSON document parsed from the specified file, shared by all instances.
+    /// The file is parsed on the first request. The returned document remains valid for the lifetime of the runner.
+    const rapidjson::Document& GetSharedJSON(const std::string& filename);
+
+    /// Return the number of worker threads.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Return the wall-clock time for the last batch run (in seconds).
+    double GetWallTime() const { return m_wall_time; }
+
+    /// Return the total simulated time over all instances of the last batch run (in seconds).
+    double GetSimulatedTime() const;
+
+    /// Return the throughput of the last batch run, as simulated seconds per wall-clock second per thread.
+    double GetThroughput() const;
+
+    /// Write the result table of the last batch run to the specified file.
+    /// Values are separated by the given delimiter; the first line contains the column names.
+    void WriteResults(const std::string& filename, const std::string& delim = ",") const;
+
+  private:
+    /// Result row for one instance.
+    struct Result {
+        Result() : sim_time(0), num_steps(0), wall_time(0) {}
+        double sim_time;             ///< final simulated time
+        int num_steps;               ///< number of steps
+        double wall_time;            ///< wall-clock time for construction and simulation
+        std::vector<double> values;  ///< user-defined results
+    };
+
+    void RunInstance(int index, const InstanceFactory& factory, double end_time, double step);
+
+    const ChSystem& m_prototype;  ///< prototype for the instance systems
+    int m_num_threads;            ///< number of worker threads
+
+    std::vector<std::string> m_result_names;  ///< names of user-defined results
+    std::vector<Result> m_results;            ///< results of last batch run (one per instance)
+    double m_wall_time;                       ///< wall-clock time of last batch run
+
+    std::mutex m_data_mutex;  ///< protects the shared data maps
+    std::unordered_map<std::string, std::shared_ptr<geometry::ChTriangleMeshConnected>> m_meshes;
+    std::unordered_map<std::string, std::unique_ptr<rapidjson::Document>> m_json;
+};
+
+/// @} vehicle_utils
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
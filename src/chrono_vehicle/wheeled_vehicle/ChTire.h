@@ -204,7 +204,8 @@ class CH_VEHICLE_API ChTire : public ChPart {
 
     /// Collsion algorithm based on a paper of J. Shane Sui and John A. Hirshey II:
     /// "A New Analytical Tire Model for Vehicle Dynamic Analysis" presented at 2001 MSC User Meeting
-    static bool DiscTerrainCollisionEnvelope(
+    /// The terrain contour is sampled into scratch buffers owned by this tire, which are reused across calls.
+    bool DiscTerrainCollisionEnvelope(
         const ChTerrain& terrain,            ///< [in] reference to terrain system
         const ChVector<>& disc_center,       ///< [in] global location of the disc center
         const ChVector<>& disc_normal,       ///< [in] disc normal, expressed in the global frame
@@ -225,6 +226,11 @@ class CH_VEHICLE_API ChTire : public ChPart {
     std::string m_vis_mesh_file;  ///< name of OBJ file for visualization of this tire (may be empty)
 
   private:
+    std::vector<ChVector<>> m_env_points;   ///< scratch: contour sample points (DiscTerrainCollisionEnvelope)
+    std::vector<double> m_env_heights;      ///< scratch: terrain heights below contour samples
+    std::vector<ChVector<>> m_env_normals;  ///< scratch: terrain normals below contour samples
+    std::vector<float> m_env_friction;      ///< scratch: terrain friction below contour samples
+
     double m_slip_angle;
     double m_longitudinal_slip;
     double m_camber_angle;
@@ -17,6 +17,9 @@
 // =============================================================================
 
 #include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChForceElementTire.h"
+
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_thirdparty/rapidjson/document.h"
 #include "chrono_thirdparty/rapidjson/prettywriter.h"
@@ -28,10 +31,10 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 ChWheeledVehicle::ChWheeledVehicle(const std::string& name, ChContactMethod contact_method)
-    : ChVehicle(name, contact_method), m_parking_on(false) {}
+    : ChVehicle(name, contact_method), m_parking_on(false), m_parallel_tires(false), m_advance_tires(true) {}
 
 ChWheeledVehicle::ChWheeledVehicle(const std::string& name, ChSystem* system)
-    : ChVehicle(name, system), m_parking_on(false) {}
+    : ChVehicle(name, system), m_parking_on(false), m_parallel_tires(false), m_advance_tires(true) {}
 
 // -----------------------------------------------------------------------------
 // Initialize a tire and attach it to one of the vehicle's wheels.
@@ -62,6 +65,8 @@ void ChWheeledVehicle::InitializePowertrain(std::shared_ptr<ChPowertrain> powert
 // to the terrain system.
 // -----------------------------------------------------------------------------
 void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_inputs, const ChTerrain& terrain) {
+    CH_PROFILE_ZONE("WheeledVehicle::Synchronize");
+
     double powertrain_torque = 0;
     if (m_powertrain && m_driveline) {
         // Extract the torque from the powertrain.
@@ -84,12 +89,26 @@ void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_input
         connector->Synchronize(time, driver_inputs);
     }
 
+    // Synchronize the vehicle tires.
+    // Tires only read the state of their associated wheel and modify their own state, so all tires can be processed
+    // before the axle subsystems (which apply the tire forces to the wheel spindles).
+    m_timer_tires.reset();
+    m_timer_tires.start();
+    CollectTires();
+    int nthreads = (m_parallel_tires && terrain.SupportsConcurrentQueries()) ? m_system->GetNumThreadsChrono() : 1;
+    int ntires = (int)m_tires_parallel.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int i = 0; i < ntires; i++) {
+        CH_PROFILE_ZONE("TireSynchronize");
+        m_tires_parallel[i]->Synchronize(time, terrain);
+    }
+    for (auto tire : m_tires_serial) {
+        tire->Synchronize(time, terrain);
+    }
+    m_timer_tires.stop();
+
     // Synchronize the vehicle's axle subsystems
     for (auto& axle : m_axles) {
-        for (auto& wheel : axle->GetWheels()) {
-            if (wheel->m_tire)
-                wheel->m_tire->Synchronize(time, terrain);
-        }
         axle->Synchronize(time, driver_inputs);
     }
 
@@ -102,25 +121,69 @@ void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_input
 // Advance the state of this vehicle by the specified time step.
 // -----------------------------------------------------------------------------
 void ChWheeledVehicle::Advance(double step) {
+    CH_PROFILE_ZONE("WheeledVehicle::Advance");
+
     if (m_powertrain) {
         // Advance state of the associated powertrain.
         m_powertrain->Advance(step);
     }
 
-    // Advance state of all vehicle tires.
+    // Advance state of all vehicle tires (unless advanced externally).
     // This is done before advancing the state of the multibody system in order to use
     // wheel states corresponding to current time.
-    for (auto& axle : m_axles) {
-        for (auto& wheel : axle->GetWheels()) {
-            if (wheel->m_tire)
-                wheel->m_tire->Advance(step);
+    if (m_advance_tires) {
+        m_timer_tires.start();
+        CollectTires();
+        int nthreads = m_parallel_tires ? m_system->GetNumThreadsChrono() : 1;
+        int ntires = (int)m_tires_parallel.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+        for (int i = 0; i < ntires; i++) {
+            CH_PROFILE_ZONE("TireAdvance");
+            m_tires_parallel[i]->Advance(step);
         }
+        for (auto tire : m_tires_serial) {
+            tire->Advance(step);
+        }
+        m_timer_tires.stop();
     }
 
     // Invoke base class function to advance state of underlying Chrono system.
     ChVehicle::Advance(step);
 }
 
+// -----------------------------------------------------------------------------
+// Collect the tires attached to the vehicle wheels.
+// Force-element tires only interact with the terrain through (const) queries and can be updated concurrently. The
+// lists are rebuilt at each call (tires can be attached at any time), reusing their storage.
+// -----------------------------------------------------------------------------
+void ChWheeledVehicle::CollectTires() {
+    m_tires_parallel.clear();
+    m_tires_serial.clear();
+    for (auto& axle : m_axles) {
+        for (auto& wheel : axle->GetWheels()) {
+            if (!wheel->m_tire)
+                continue;
+            if (dynamic_cast<ChForceElementTire*>(wheel->m_tire.get()))
+                m_tires_parallel.push_back(wheel->m_tire.get());
+            else
+                m_tires_serial.push_back(wheel->m_tire.get());
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Register the vehicle tires with a tire batch, which then advances them.
+// -----------------------------------------------------------------------------
+void ChWheeledVehicle::RegisterTires(ChTireBatch& batch) {
+    for (auto& axle : m_axles) {
+        for (auto& wheel : axle->GetWheels()) {
+            if (wheel->m_tire)
+                batch.AddTire(wheel->m_tire);
+        }
+    }
+    m_advance_tires = false;
+}
+
 // -----------------------------------------------------------------------------
 // Enable/disable differential locking.
 // -----------------------------------------------------------------------------
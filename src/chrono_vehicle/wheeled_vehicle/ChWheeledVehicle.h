@@ -22,6 +22,10 @@
 #ifndef CH_WHEELED_VEHICLE_H
 #define CH_WHEELED_VEHICLE_H
 
+#include <vector>
+
+#include "chrono/core/ChTimer.h"
+
 #include "chrono_vehicle/ChVehicle.h"
 #include "chrono_vehicle/ChTerrain.h"
 #include "chrono_vehicle/wheeled_vehicle/ChSubchassis.h"
@@ -33,6 +37,7 @@
 #include "chrono_vehicle/wheeled_vehicle/ChSuspension.h"
 #include "chrono_vehicle/wheeled_vehicle/ChWheel.h"
 #include "chrono_vehicle/wheeled_vehicle/ChTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTireBatch.h"
 
 namespace chrono {
 namespace vehicle {
@@ -230,6 +235,35 @@ class CH_VEHICLE_API ChWheeledVehicle : public ChVehicle {
     /// This function has no effect if called before vehicle initialization.
     void DisconnectDriveline();
 
+    /// Enable/disable parallel update of the vehicle tires (default: false).
+    /// If enabled, the Synchronize and Advance functions of all force-element tires (e.g., TMeasy, Pac02, Pac89,
+    /// Fiala) are executed concurrently, using as many OpenMP threads as set for the underlying Chrono system (see
+    /// ChSystem::SetNumThreads). Each such tire only modifies its own state, but queries the terrain; tire updates are
+    /// therefore performed serially if the terrain does not support concurrent queries (see
+    /// ChTerrain::SupportsConcurrentQueries). Tires of other types (rigid, deformable) are always updated serially.
+    void EnableParallelTires(bool val) { m_parallel_tires = val; }
+
+    /// Return true if parallel update of the vehicle tires is enabled.
+    bool IsParallelTiresEnabled() const { return m_parallel_tires; }
+
+    /// Enable/disable the advance of the vehicle tires in Advance (default: true).
+    /// Disable if the vehicle tires are advanced externally, e.g. by a tire batch shared by all vehicles in the system
+    /// (see RegisterTires). Tire synchronization is not affected.
+    void EnableTireAdvance(bool val) { m_advance_tires = val; }
+
+    /// Return true if the vehicle tires are advanced in Advance.
+    bool IsTireAdvanceEnabled() const { return m_advance_tires; }
+
+    /// Register the vehicle tires with the specified tire batch and disable their advance by this vehicle.
+    /// A single ChTireBatch can collect the tires of all vehicles in a system, so that the force characteristics of all
+    /// their TMeasy and Pac02 tires are evaluated in single vectorized passes. The caller must then invoke
+    /// ChTireBatch::Advance once per step, after synchronizing all vehicles and before advancing the system state.
+    /// This function must be called after the tires were attached to the vehicle wheels.
+    void RegisterTires(ChTireBatch& batch);
+
+    /// Get the wall-clock time (in seconds) spent in the tire Synchronize and Advance functions during the last step.
+    double GetTimerTires() const { return m_timer_tires(); }
+
     /// Log current constraint violations.
     virtual void LogConstraintViolations() override;
 
@@ -268,6 +302,16 @@ class CH_VEHICLE_API ChWheeledVehicle : public ChVehicle {
     std::shared_ptr<ChDrivelineWV> m_driveline;  ///< driveline subsystem
     std::shared_ptr<ChPowertrain> m_powertrain;  ///< associated powertrain system
     bool m_parking_on;                           ///< indicates whether or not parking brake is engaged
+
+  private:
+    /// Collect the vehicle tires, separating those that can be updated concurrently.
+    void CollectTires();
+
+    bool m_parallel_tires;                  ///< update force-element tires in parallel
+    bool m_advance_tires;                   ///< advance the vehicle tires in Advance
+    std::vector<ChTire*> m_tires_parallel;  ///< tires that can be updated concurrently
+    std::vector<ChTire*> m_tires_serial;    ///< tires that must be updated serially
+    ChTimer<> m_timer_tires;                ///< timer for tire updates
 };
 
 /// @} vehicle_wheeled
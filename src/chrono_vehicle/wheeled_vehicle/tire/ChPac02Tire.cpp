@@ -356,8 +356,18 @@ void ChPac02Tire::Synchronize(double time, const ChTerrain& terrain) {
 }
 
 // -----------------------------------------------------------------------------
+// Advance the tire state.
+// The calculation is split in two parts, around the evaluation of the magic formula for the pure-slip longitudinal
+// and lateral forces, so that the magic formula can be evaluated for multiple tires at once (see ChTireBatch).
 // -----------------------------------------------------------------------------
 void ChPac02Tire::Advance(double step) {
+    if (!AdvanceSlip())
+        return;
+
+    AdvanceForces(MagicFormula(m_mf_x), MagicFormula(m_mf_y));
+}
+
+bool ChPac02Tire::AdvanceSlip() {
     // Set tire forces to zero.
     m_tireforce.point = m_wheel->GetPos();
     m_tireforce.force = ChVector<>(0, 0, 0);
@@ -365,7 +375,7 @@ void ChPac02Tire::Advance(double step) {
 
     // Return now if no contact.
     if (!m_data.in_contact)
-        return;
+        return false;
 
     // prevent singularity for kappa, when vx == 0
     const double epsilon = 0.1;
@@ -382,6 +392,29 @@ void ChPac02Tire::Advance(double step) {
     // Ensure that cp_side_slip stays between -pi()/2 & pi()/2 (a little less to prevent tan from going to infinity)
     ChClampValue(m_states.cp_side_slip, -CH_C_PI_2 + 0.001, CH_C_PI_2 - 0.001);
 
+    // Express alpha and gamma in rad. Express kappa as ratio.
+    m_gamma = CH_C_PI_2 - std::acos(m_states.disc_normal.z());
+    m_alpha = m_states.cp_side_slip;
+    m_kappa = m_states.cp_long_slip;
+
+    // Clamp |gamma| to specified value: Limit due to tire testing, avoids erratic extrapolation. m_gamma_limit is
+    // in rad too.
+    double gamma = ChClamp(m_gamma, -m_gamma_limit, m_gamma_limit);
+    double Fz = m_data.normal_force;
+
+    // Inputs to the magic formula for the pure-slip longitudinal and lateral forces (unused inputs are set such that
+    // the magic formula evaluates to 0).
+    m_mf_x = {0, 0, 0, 0, 0};
+    m_mf_y = {0, 0, 0, 0, 0};
+    if (m_use_mode == 1 || m_use_mode == 3 || m_use_mode == 4)
+        CalcFxInput(m_kappa, Fz, gamma, m_mf_x);
+    if (m_use_mode == 2 || m_use_mode == 3 || m_use_mode == 4)
+        CalcFyInput(m_alpha, Fz, gamma, m_mf_y);
+
+    return true;
+}
+
+void ChPac02Tire::AdvanceForces(double Fx0, double Fy0) {
     // Calculate the new force and moment values (normal force and moment have already been accounted for in
     // Synchronize()).
     // Express Fz in kN (note that all other forces and moments are in N and Nm).
@@ -393,31 +426,29 @@ void ChPac02Tire::Advance(double step) {
     double My = 0;
     double Mz = 0;
 
-    // Express alpha and gamma in rad. Express kappa as ratio.
-    m_gamma = CH_C_PI_2 - std::acos(m_states.disc_normal.z());
-    m_alpha = m_states.cp_side_slip;
-    m_kappa = m_states.cp_long_slip;
-
-    // Clamp |gamma| to specified value: Limit due to tire testing, avoids erratic extrapolation. m_gamma_limit is
-    // in rad too.
     double gamma = ChClamp(m_gamma, -m_gamma_limit, m_gamma_limit);
 
+    if (m_use_mode == 1 || m_use_mode == 3 || m_use_mode == 4)
+        m_mu_x_act = std::abs((Fx0 - m_mf_x.Sv) / Fz);
+    if (m_use_mode == 2 || m_use_mode == 3 || m_use_mode == 4)
+        m_mu_y_act = std::abs((Fy0 - m_mf_y.Sv) / Fz);
+
     switch (m_use_mode) {
         case 0:
             // vertical spring & damper mode
             break;
         case 1:
             // steady state pure longitudinal slip
-            Fx = CalcFx(m_kappa, Fz, gamma);
+            Fx = Fx0;
             break;
         case 2:
             // steady state pure lateral slip
-            Fy = CalcFy(m_alpha, Fz, gamma);
+            Fy = Fy0;
             break;
         case 3:
             // steady state pure lateral slip uncombined
-            Fx = CalcFx(m_kappa, Fz, gamma);
-            Fy = CalcFy(m_alpha, Fz, gamma);
+            Fx = Fx0;
+            Fy = Fy0;
             Mx = CalcMx(Fy, Fz, gamma);
             My = CalcMy(Fx, Fz, gamma);
             Mz = CalcMz(m_alpha, Fz, gamma, Fy);
@@ -425,8 +456,8 @@ void ChPac02Tire::Advance(double step) {
         case 4:
             // steady state combined slip
             if (m_use_friction_ellipsis) {
-                double Fx_u = CalcFx(m_kappa, Fz, gamma);
-                double Fy_u = CalcFy(m_alpha, Fz, gamma);
+                double Fx_u = Fx0;
+                double Fy_u = Fy0;
                 double as = sin(m_alpha_c);
                 double beta = acos(std::abs(m_kappa_c) / sqrt(pow(m_kappa_c, 2) + pow(as, 2)));
                 double mux = 1.0 / sqrt(pow(1.0 / m_mu_x_act, 2) + pow(tan(beta) / m_mu_y_max, 2));
@@ -437,8 +468,8 @@ void ChPac02Tire::Advance(double step) {
                 My = CalcMy(Fx, Fz, gamma);
                 Mz = CalcMz(m_alpha, Fz, gamma, Fy);
             } else {
-                Fx = CalcFxComb(m_kappa, m_alpha, Fz, gamma);
-                Fy = CalcFyComb(m_kappa, m_alpha, Fz, gamma);
+                Fx = CalcFxComb(m_kappa, m_alpha, Fz, gamma, Fx0);
+                Fy = CalcFyComb(m_kappa, m_alpha, Fz, gamma, Fy0);
                 Mx = CalcMx(Fy, Fz, gamma);
                 My = CalcMy(Fx, Fz, gamma);
                 Mz = CalcMzComb(m_kappa, m_alpha, Fz, gamma, Fx, Fy);
@@ -461,7 +492,31 @@ void ChPac02Tire::Advance(double step) {
         Vcross((m_data.frame.pos + m_data.depth * m_data.frame.rot.GetZaxis()) - m_tireforce.point, m_tireforce.force);
 }
 
-double ChPac02Tire::CalcFx(double kappa, double Fz, double gamma) {
+// -----------------------------------------------------------------------------
+// Magic formula, for one or for multiple sets of inputs.
+// The batch version uses the same arithmetic as the scalar version; it only differs in that the loop is marked for
+// vectorization.
+// -----------------------------------------------------------------------------
+double ChPac02Tire::MagicFormula(const MagicFormulaInput& in) {
+    return in.D * sin(in.C * atan(in.X1 - in.E * (in.X1 - atan(in.X1)))) + in.Sv;
+}
+
+void ChPac02Tire::MagicFormula(int n,
+                               const double* X1,
+                               const double* C,
+                               const double* D,
+                               const double* E,
+                               const double* Sv,
+                               double* y) {
+#pragma omp simd
+    for (int i = 0; i < n; i++) {
+        y[i] = D[i] * std::sin(C[i] * std::atan(X1[i] - E[i] * (X1[i] - std::atan(X1[i])))) + Sv[i];
+    }
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChPac02Tire::CalcFxInput(double kappa, double Fz, double gamma, MagicFormulaInput& mf) {
     // calculates the longitudinal force based on a limited parameter set.
     // Pi is not considered
     double Fz0s = m_PacCoeff.FzNomin * m_PacScal.lfz0;
@@ -477,14 +532,15 @@ double ChPac02Tire::CalcFx(double kappa, double Fz, double gamma) {
     double Sh = (m_PacCoeff.phx1 + m_PacCoeff.phx2 * dFz) * m_PacScal.lhx;
     double Sv = Fz * (m_PacCoeff.pvx1 + m_PacCoeff.pvx2 * dFz) * m_PacScal.lvx * m_PacScal.lmux;
     m_kappa_c = kappa + Sh + Sv / BCD;
-    double X1 = B * (kappa + Sh);
-    double Fx0 = D * sin(C * atan(X1 - E * (X1 - atan(X1)))) + Sv;
-    m_mu_x_act = std::abs((Fx0 - Sv) / Fz);
+    mf.X1 = B * (kappa + Sh);
+    mf.C = C;
+    mf.D = D;
+    mf.E = E;
+    mf.Sv = Sv;
     m_mu_x_max = std::abs(D / Fz);
-    return Fx0;
 }
 
-double ChPac02Tire::CalcFy(double alpha, double Fz, double gamma) {
+void ChPac02Tire::CalcFyInput(double alpha, double Fz, double gamma, MagicFormulaInput& mf) {
     double Fz0s = m_PacCoeff.FzNomin * m_PacScal.lfz0;
     double dFz = (Fz - Fz0s) / Fz0s;
     double C = m_PacCoeff.pcy1 * m_PacScal.lcy;
@@ -504,13 +560,14 @@ double ChPac02Tire::CalcFy(double alpha, double Fz, double gamma) {
     double Sh = (m_PacCoeff.phy1 + m_PacCoeff.phy2 * dFz) * m_PacScal.lhy;
     double Sv = Fz * ((m_PacCoeff.pvy1 + m_PacCoeff.pvy2 * dFz) * m_PacScal.lvy) * m_PacScal.lmuy;
     m_alpha_c = alpha + Sh + Sv / BCD;
-    double X1 = ChClamp(B * (alpha + Sh), -CH_C_PI_2 + 0.001,
-                        CH_C_PI_2 - 0.001);  // Ensure that X1 stays within +/-90 deg minus a little bit
-    double Fy0 = D * sin(C * atan(X1 - E * (X1 - atan(X1)))) + Sv;
+    mf.X1 = ChClamp(B * (alpha + Sh), -CH_C_PI_2 + 0.001,
+                    CH_C_PI_2 - 0.001);  // Ensure that X1 stays within +/-90 deg minus a little bit
+    mf.C = C;
+    mf.D = D;
+    mf.E = E;
+    mf.Sv = Sv;
     m_Shf = Sh + Sv / BCD;
-    m_mu_y_act = std::abs((Fy0 - Sv) / Fz);
     m_mu_y_max = std::abs(D / Fz);
-    return Fy0;
 }
 
 // Oeverturning Couple
@@ -567,21 +624,9 @@ double ChPac02Tire::CalcMres(double alpha, double Fz, double gamma) {
     return D * cos(C * atan(B * alpha_r)) * cos(alpha);
 }
 
-double ChPac02Tire::CalcFxComb(double kappa, double alpha, double Fz, double gamma) {
+double ChPac02Tire::CalcFxComb(double kappa, double alpha, double Fz, double gamma, double Fx0) {
     double Fz0s = m_PacCoeff.FzNomin * m_PacScal.lfz0;
     double dFz = (Fz - Fz0s) / Fz0s;
-    double C = m_PacCoeff.pcx1 * m_PacScal.lcx;
-    double Mux = (m_PacCoeff.pdx1 + m_PacCoeff.pdx2 * dFz) * (1.0 - m_PacCoeff.pdx3 * pow(gamma, 2)) * m_PacScal.lmux;
-    double D = Mux * Fz * m_mu / m_PacCoeff.mu0;
-    double E = (m_PacCoeff.pex1 + m_PacCoeff.pex2 * dFz + m_PacCoeff.pex3 * dFz * dFz) * m_PacScal.lex;
-    if (E > 1.0)
-        E = 1.0;
-    double BCD = Fz * (m_PacCoeff.pkx1 + m_PacCoeff.pkx2 * dFz) * m_PacScal.lkx;  // BCD = Kx
-    double B = BCD / (C * D);
-    double Sh = (m_PacCoeff.phx1 + m_PacCoeff.phx2 * dFz) * m_PacScal.lhx;
-    double Sv = Fz * (m_PacCoeff.pvx1 + m_PacCoeff.pvx2 * dFz) * m_PacScal.lvx * m_PacScal.lmux;
-    double X1 = B * (kappa + Sh);
-    double Fx0 = D * sin(C * atan(X1 - E * (X1 - atan(X1)))) + Sv;
     double Shxa = m_PacCoeff.rhx1;
     double alpha_s = tan(alpha) * ChSignum(m_data.vel.x()) + Shxa;
     double Bxa =
@@ -593,28 +638,11 @@ double ChPac02Tire::CalcFxComb(double kappa, double alpha, double Fz, double gam
     return Fx0 * Gxa;
 }
 
-double ChPac02Tire::CalcFyComb(double kappa, double alpha, double Fz, double gamma) {
+double ChPac02Tire::CalcFyComb(double kappa, double alpha, double Fz, double gamma, double Fy0) {
     double Fz0s = m_PacCoeff.FzNomin * m_PacScal.lfz0;
     double dFz = (Fz - Fz0s) / Fz0s;
-    double C = m_PacCoeff.pcy1 * m_PacScal.lcy;
     double Muy = (m_PacCoeff.pdy1 + m_PacCoeff.pdy2 * dFz) * (1.0 - m_PacCoeff.pdy3 * pow(gamma, 2)) * m_PacScal.lmuy;
-    double D = Muy * Fz * m_mu / m_PacCoeff.mu0;
-    double E = (m_PacCoeff.pey1 + m_PacCoeff.pey2 * dFz) *
-               (1.0 + m_PacCoeff.pey5 * pow(gamma, 2) - (m_PacCoeff.pey3 + m_PacCoeff.pey4 * gamma) * ChSignum(alpha)) *
-               m_PacScal.ley;
-    if (E > 1.0)
-        E = 1.0;
-    double Ky0 = m_PacCoeff.pky1 * m_PacCoeff.FzNomin * sin(2.0 * atan(Fz / (m_PacCoeff.pky2 * Fz0s))) *
-                 m_PacScal.lfz0 * m_PacScal.lky;
-    double BCD = Ky0;  // BCD = Ky
-    double B = BCD / (C * D);
-    double Sh = (m_PacCoeff.phy1 + m_PacCoeff.phy2 * dFz) * m_PacScal.lhy;
-    double Sv = Fz * ((m_PacCoeff.pvy1 + m_PacCoeff.pvy2 * dFz) * m_PacScal.lvy) * m_PacScal.lmuy;
-    double X1 = ChClamp(B * (alpha + Sh), -CH_C_PI_2 + 0.001,
-                        CH_C_PI_2 - 0.001);  // Ensure that X1 stays within +/-90 deg minus a little bit
-    double Fy0 = D * sin(C * atan(X1 - E * (X1 - atan(X1)))) + Sv;
     double Shyk = m_PacCoeff.rhx1 + m_PacCoeff.rhy2 * dFz;
-    m_Shf = Sh + Sv / BCD;
     double kappa_s = kappa + Shyk;
     double Byk = m_PacCoeff.rby1 * cos(atan(m_PacCoeff.rby2 * (tan(alpha) - m_PacCoeff.rby3)));
     double Cyk = m_PacCoeff.rcy1;
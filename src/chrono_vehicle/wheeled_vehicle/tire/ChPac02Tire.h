@@ -90,6 +90,28 @@ class CH_VEHICLE_API ChPac02Tire : public ChForceElementTire {
     /// The reported value will be similar to that reported by ChTire::GetCamberAngle.
     double GetCamberAngle_internal() { return m_gamma * CH_C_DEG_TO_RAD; }
 
+    /// Inputs to the magic formula y = D sin(C atan(X1 - E (X1 - atan(X1)))) + Sv.
+    struct MagicFormulaInput {
+        double X1;  ///< stretched and shifted slip, B (x + Sh)
+        double C;   ///< shape factor
+        double D;   ///< peak value
+        double E;   ///< curvature factor
+        double Sv;  ///< vertical shift
+    };
+
+    /// Evaluate the magic formula for the given inputs.
+    static double MagicFormula(const MagicFormulaInput& in);
+
+    /// Evaluate the magic formula for n sets of inputs, provided in structure-of-arrays layout.
+    /// This function performs the same calculations as the scalar version, in a loop that can be vectorized.
+    static void MagicFormula(int n,
+                             const double* X1,
+                             const double* C,
+                             const double* D,
+                             const double* E,
+                             const double* Sv,
+                             double* y);
+
   protected:
     /// Set the parameters in the Pac89 model.
     virtual void SetPac02Params() = 0;
@@ -339,16 +361,28 @@ class CH_VEHICLE_API ChPac02Tire : public ChForceElementTire {
 
     std::shared_ptr<ChCylinderShape> m_cyl_shape;  ///< visualization cylinder asset
 
-    double CalcFx(double kappa, double Fz, double gamma);
-    double CalcFy(double alpha, double Fz, double gamma);
+    MagicFormulaInput m_mf_x;  ///< magic formula inputs for the pure-slip longitudinal force
+    MagicFormulaInput m_mf_y;  ///< magic formula inputs for the pure-slip lateral force
+
+    /// First part of Advance: reset the tire force and calculate the slip quantities and the magic formula inputs.
+    /// Return false if the tire is not in contact with the terrain.
+    bool AdvanceSlip();
+
+    /// Second part of Advance: calculate the tire force and moment, given the pure-slip forces.
+    void AdvanceForces(double Fx0, double Fy0);
+
+    void CalcFxInput(double kappa, double Fz, double gamma, MagicFormulaInput& mf);
+    void CalcFyInput(double alpha, double Fz, double gamma, MagicFormulaInput& mf);
     double CalcMx(double Fy, double Fz, double gamma);
     double CalcMy(double Fx, double Fy, double gamma);
     double CalcMz(double alpha, double Fz, double gamma, double Fy);
     double CalcTrail(double alpha, double Fz, double gamma);
     double CalcMres(double alpha, double Fz, double gamma);
-    double CalcFxComb(double kappa, double alpha, double Fz, double gamma);
-    double CalcFyComb(double kappa, double alpha, double Fz, double gamma);
+    double CalcFxComb(double kappa, double alpha, double Fz, double gamma, double Fx0);
+    double CalcFyComb(double kappa, double alpha, double Fz, double gamma, double Fy0);
     double CalcMzComb(double kappa, double alpha, double Fz, double gamma, double Fx, double Fy);
+
+    friend class ChTireBatch;
 };
 
 /// @} vehicle_wheeled_tire
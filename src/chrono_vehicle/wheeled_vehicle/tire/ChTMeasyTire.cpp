@@ -236,8 +236,22 @@ void ChTMeasyTire::Synchronize(double time, const ChTerrain& terrain) {
 }
 
 // -----------------------------------------------------------------------------
+// Advance the tire state.
+// The calculation is split in two parts, around the evaluation of the combined-slip force characteristic, so that the
+// characteristic can be evaluated for multiple tires at once (see ChTireBatch).
 // -----------------------------------------------------------------------------
 void ChTMeasyTire::Advance(double step) {
+    if (!AdvanceSlip())
+        return;
+
+    double f = 0.0;
+    double fos = 0.0;
+    tmxy_combined(f, fos, m_slip.sg, m_slip.df0, m_slip.sm, m_slip.fm, m_slip.ss, m_slip.fs);
+
+    AdvanceForces(step, f, fos);
+}
+
+bool ChTMeasyTire::AdvanceSlip() {
     // Set tire forces to zero.
     m_tireforce.point = m_wheel->GetPos();
     m_tireforce.force = ChVector<>(0, 0, 0);
@@ -245,7 +259,7 @@ void ChTMeasyTire::Advance(double step) {
 
     // Return now if no contact.
     if (!m_data.in_contact)
-        return;
+        return false;
 
     double sc;              // combined slip
     double calpha, salpha;  // cos(alpha) rsp. sin(alpha), alpha = slip angle
@@ -260,9 +274,6 @@ void ChTMeasyTire::Advance(double step) {
     // coefficients
     // m_data.normal_force is nevertheless still taken as the applied vertical tire force
     double Fz = std::min(m_data.normal_force, m_TMeasyCoeff.pn_max);
-    double Mx = 0;
-    double My = 0;
-    double Mz = 0;
 
     // Calculate Fz dependend Curve Parameters
     double dfx0 = InterpQ(Fz, m_TMeasyCoeff.dfx0_pn, m_TMeasyCoeff.dfx0_p2n);
@@ -307,8 +318,6 @@ void ChTMeasyTire::Advance(double step) {
     double sm = hypot(sxm * calpha / hsxn, sym * salpha / hsyn);
     double fs = hypot(fxs * calpha, fys * salpha);
     double ss = hypot(sxs * calpha / hsxn, sys * salpha / hsyn);
-    double f = 0.0;
-    double fos = 0.0;
 
     // consider camber effects
     // Calculate length of tire contact patch
@@ -323,7 +332,41 @@ void ChTMeasyTire::Advance(double step) {
     // generalzed slip
     double sg = hypot(sc, sb);
 
-    tmxy_combined(f, fos, sg, df0, sm, fm, ss, fs);
+    m_slip.muscale = muscale;
+    m_slip.gamma = gamma;
+    m_slip.Fz = Fz;
+    m_slip.hsxn = hsxn;
+    m_slip.hsyn = hsyn;
+    m_slip.nto0 = nto0;
+    m_slip.synto0 = synto0;
+    m_slip.syntoE = syntoE;
+    m_slip.plen = plen;
+    m_slip.rb = rb;
+    m_slip.sb = sb;
+    m_slip.sg = sg;
+    m_slip.df0 = df0;
+    m_slip.sm = sm;
+    m_slip.fm = fm;
+    m_slip.ss = ss;
+    m_slip.fs = fs;
+
+    return true;
+}
+
+void ChTMeasyTire::AdvanceForces(double step, double f, double fos) {
+    double muscale = m_slip.muscale;
+    double gamma = m_slip.gamma;
+    double Fz = m_slip.Fz;
+    double hsxn = m_slip.hsxn;
+    double hsyn = m_slip.hsyn;
+    double plen = m_slip.plen;
+    double rb = m_slip.rb;
+    double sb = m_slip.sb;
+    double sg = m_slip.sg;
+    double Mx = 0;
+    double My = 0;
+    double Mz = 0;
+
     if (sg > 0.0) {
         m_states.Fx = f * m_states.sx / sg;
         m_states.Fy = f * m_states.sy / sg;
@@ -332,7 +375,7 @@ void ChTMeasyTire::Advance(double step) {
         m_states.Fy = 0.0;
     }
     // Calculate dimensionless lever arm
-    double levN = tmy_tireoff(m_states.sy, nto0, synto0, syntoE);
+    double levN = tmy_tireoff(m_states.sy, m_slip.nto0, m_slip.synto0, m_slip.syntoE);
 
     // Bore Torque
     if (sg > 0.0) {
@@ -538,6 +581,65 @@ void ChTMeasyTire::tmxy_combined(double& f,
     fos *= kN2N;
 }
 
+void ChTMeasyTire::tmxy_combined(int n,
+                                 const double* s,
+                                 const double* df0,
+                                 const double* sm,
+                                 const double* fm,
+                                 const double* ss,
+                                 const double* fs,
+                                 double* f,
+                                 double* fos) {
+    // All branches of the scalar version are evaluated and the result is selected. Values in branches that are not
+    // selected may be non-finite; these are discarded. Note that all arithmetic is performed unconditionally (only
+    // the selections are conditional), which allows the loop to be vectorized without relaxing floating-point
+    // semantics.
+#pragma omp simd
+    for (int i = 0; i < n; i++) {
+        double si = s[i];
+        double smi = sm[i];
+        double fmi = fm[i];
+        double ssi = ss[i];
+        double fsi = fs[i];
+        double df0i = df0[i];
+        double df0sm = 2.0 * fmi / smi;
+        double df0max = (df0sm > df0i) ? df0sm : df0i;
+        double df0loc = (smi > 0.0) ? df0max : 0.0;
+
+        // adhesion
+        double p = df0loc * smi / fmi - 2.0;
+        double sn = si / smi;
+        double dn = 1.0 + (sn + p) * sn;
+        double f_adh = df0loc * smi * sn / dn;
+        double fos_adh = df0loc / dn;
+
+        // transition to sliding: 2 parabolas or cubic fallback function
+        double a = (fmi / smi) * (fmi / smi) / (df0loc * smi);
+        double sstar = smi + (fmi - fsi) / (a * (ssi - smi));
+        double b = a * (sstar - smi) / (ssi - sstar);
+        double sc = (si - smi) / (ssi - smi);
+        double f_par1 = fmi - a * (si - smi) * (si - smi);
+        double f_par2 = fsi + b * (ssi - si) * (ssi - si);
+        double f_cub = fmi - (fmi - fsi) * sc * sc * (3.0 - 2.0 * sc);
+        double f_par = (si <= sstar) ? f_par1 : f_par2;
+        double f_trn = (sstar <= ssi) ? f_par : f_cub;
+
+        // full sliding
+        bool sliding = si > ssi;
+        bool adhesion = !sliding & (si < smi);
+        double fi = sliding ? fsi : (adhesion ? f_adh : f_trn);
+        double fos_slp = fi / si;
+        double fosi = adhesion ? fos_adh : fos_slp;
+
+        // normal operating conditions (scale up from kN to N)
+        bool active = (si > 0.0) & (df0loc > 0.0);
+        double fi_N = fi * kN2N;
+        double fosi_N = fosi * kN2N;
+        f[i] = active ? fi_N : 0.0;
+        fos[i] = active ? fosi_N : 0.0;
+    }
+}
+
 double ChTMeasyTire::tmy_tireoff(double sy, double nto0, double synto0, double syntoE) {
     double nto = 0.0;
 
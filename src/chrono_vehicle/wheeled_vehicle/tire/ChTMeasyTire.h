@@ -186,6 +186,22 @@ class CH_VEHICLE_API ChTMeasyTire : public ChForceElementTire {
     /// Simple parameter consistency test.
     bool CheckParameters();
 
+    /// Evaluate the combined-slip force characteristic (force f and ratio f/s, in N) for a generalized slip s.
+    static void tmxy_combined(double& f, double& fos, double s, double df0, double sm, double fm, double ss, double fs);
+
+    /// Evaluate the combined-slip force characteristic for n sets of inputs, provided in structure-of-arrays layout.
+    /// This function produces the same results as the scalar version (up to round-off), but all branches are replaced
+    /// by selections so that the loop can be vectorized.
+    static void tmxy_combined(int n,
+                              const double* s,
+                              const double* df0,
+                              const double* sm,
+                              const double* fm,
+                              const double* ss,
+                              const double* fs,
+                              double* f,
+                              double* fos);
+
   protected:
     /// Set the parameters in the TMeasy model.
     virtual void SetTMeasyParams() = 0;
@@ -304,7 +320,6 @@ class CH_VEHICLE_API ChTMeasyTire : public ChForceElementTire {
     std::vector<double> m_tire_test_defl;  // set, when test data are used for vertical
     std::vector<double> m_tire_test_frc;   // stiffness calculation
 
-    void tmxy_combined(double& f, double& fos, double s, double df0, double sm, double fm, double ss, double fs);
     double tmy_tireoff(double sy, double nto0, double synto0, double syntoE);
 
     struct ContactData {
@@ -346,6 +361,38 @@ class CH_VEHICLE_API ChTMeasyTire : public ChForceElementTire {
     TerrainForce m_tireforce;
 
     std::shared_ptr<ChCylinderShape> m_cyl_shape;  ///< visualization cylinder asset
+
+    /// Inputs to the combined-slip force characteristic and intermediate quantities used in Advance.
+    struct SlipData {
+        double sg;       // generalized slip
+        double df0;      // initial slope of the combined force characteristic
+        double sm;       // slip at maximum force
+        double fm;       // maximum force
+        double ss;       // slip at full sliding
+        double fs;       // sliding force
+        double muscale;  // factor for considering local friction
+        double gamma;    // clamped camber angle
+        double Fz;       // limited normal force
+        double hsxn;     // longitudinal slip normalizing factor
+        double hsyn;     // lateral slip normalizing factor
+        double nto0;     // normalized pneumatic trail at zero lateral slip
+        double synto0;   // lateral slip at which the pneumatic trail changes sign
+        double syntoE;   // lateral slip at which the pneumatic trail vanishes
+        double plen;     // contact patch length
+        double rb;       // bore radius
+        double sb;       // bore slip
+    };
+
+    SlipData m_slip;
+
+    /// First part of Advance: reset the tire force and calculate the inputs to the combined-slip characteristic.
+    /// Return false if the tire is not in contact with the terrain.
+    bool AdvanceSlip();
+
+    /// Second part of Advance: calculate the tire force and moment, given the combined-slip characteristic.
+    void AdvanceForces(double step, double f, double fos);
+
+    friend class ChTireBatch;
 };
 
 /// @} vehicle_wheeled_tire
@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batched advance of multiple force-element tires.
+//
+// =============================================================================
+
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTireBatch.h"
+
+namespace chrono {
+namespace vehicle {
+
+void ChTireBatch::AddTire(std::shared_ptr<ChTire> tire) {
+    m_tires.push_back(tire);
+    m_tire_ptrs.push_back(tire.get());
+}
+
+void ChTireBatch::ClearTires() {
+    m_tires.clear();
+    m_tire_ptrs.clear();
+}
+
+void ChTireBatch::Advance(const std::vector<ChTire*>& tires, double step) {
+    // Calculate slip quantities and collect the tires in contact, by type.
+    // Advance all other tires individually.
+    m_tmeasy.clear();
+    m_pac02.clear();
+    for (auto tire : tires) {
+        if (auto tmeasy = dynamic_cast<ChTMeasyTire*>(tire)) {
+            if (tmeasy->AdvanceSlip())
+                m_tmeasy.push_back(tmeasy);
+        } else if (auto pac02 = dynamic_cast<ChPac02Tire*>(tire)) {
+            if (pac02->AdvanceSlip())
+                m_pac02.push_back(pac02);
+        } else {
+            tire->Advance(step);
+        }
+    }
+
+    // TMeasy tires: gather inputs, evaluate the combined-slip characteristic, and complete the advance.
+    int n = (int)m_tmeasy.size();
+    if (n > 0) {
+        m_s.resize(n);
+        m_df0.resize(n);
+        m_sm.resize(n);
+        m_fm.resize(n);
+        m_ss.resize(n);
+        m_fs.resize(n);
+        m_f.resize(n);
+        m_fos.resize(n);
+        for (int i = 0; i < n; i++) {
+            const auto& slip = m_tmeasy[i]->m_slip;
+            m_s[i] = slip.sg;
+            m_df0[i] = slip.df0;
+            m_sm[i] = slip.sm;
+            m_fm[i] = slip.fm;
+            m_ss[i] = slip.ss;
+            m_fs[i] = slip.fs;
+        }
+        ChTMeasyTire::tmxy_combined(n, m_s.data(), m_df0.data(), m_sm.data(), m_fm.data(), m_ss.data(), m_fs.data(),
+                                    m_f.data(), m_fos.data());
+        for (int i = 0; i < n; i++)
+            m_tmeasy[i]->AdvanceForces(step, m_f[i], m_fos[i]);
+    }
+
+    // Pac02 tires: gather inputs, evaluate the magic formula, and complete the advance.
+    n = (int)m_pac02.size();
+    if (n > 0) {
+        m_X1.resize(2 * n);
+        m_C.resize(2 * n);
+        m_D.resize(2 * n);
+        m_E.resize(2 * n);
+        m_Sv.resize(2 * n);
+        m_y.resize(2 * n);
+        for (int i = 0; i < n; i++) {
+            const ChPac02Tire::MagicFormulaInput* mf[2] = {&m_pac02[i]->m_mf_x, &m_pac02[i]->m_mf_y};
+            for (int j = 0; j < 2; j++) {
+                m_X1[2 * i + j] = mf[j]->X1;
+                m_C[2 * i + j] = mf[j]->C;
+                m_D[2 * i + j] = mf[j]->D;
+                m_E[2 * i + j] = mf[j]->E;
+                m_Sv[2 * i + j] = mf[j]->Sv;
+            }
+        }
+        ChPac02Tire::MagicFormula(2 * n, m_X1.data(), m_C.data(), m_D.data(), m_E.data(), m_Sv.data(), m_y.data());
+        for (int i = 0; i < n; i++)
+            m_pac02[i]->AdvanceForces(m_y[2 * i], m_y[2 * i + 1]);
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batched advance of multiple force-element tires.
+//
+// =============================================================================
+
+#ifndef CH_TIRE_BATCH_H
+#define CH_TIRE_BATCH_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTMeasyTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChPac02Tire.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled_tire
+/// @{
+
+/// Batched advance of the states of multiple tires.
+/// The steady-state force characteristics of all TMeasy tires (combined-slip characteristic) and of all Pac02 tires
+/// (magic formula for the pure-slip forces) in contact with the terrain are evaluated in single passes over
+/// structure-of-arrays buffers, which the compiler can vectorize. All other calculations, as well as the advance of
+/// tires of any other type, are performed per tire. The resulting tire forces are the same as those obtained by
+/// calling Advance on each tire (up to round-off).
+/// The tires in a batch may belong to different vehicles: a single batch can collect the tires of all vehicles in a
+/// system (see ChWheeledVehicle::RegisterTires), so that all their characteristics are evaluated in one pass per tire
+/// type. Buffers are retained between calls.
+class CH_VEHICLE_API ChTireBatch {
+  public:
+    ChTireBatch() {}
+
+    /// Register a tire with this batch.
+    void AddTire(std::shared_ptr<ChTire> tire);
+
+    /// Remove all registered tires.
+    void ClearTires();
+
+    /// Return the number of registered tires.
+    size_t GetNumTires() const { return m_tires.size(); }
+
+    /// Advance the states of all registered tires by the given step.
+    /// This function must be called once per step, after all tires were synchronized and before the state of the
+    /// underlying Chrono system is advanced.
+    void Advance(double step) { Advance(m_tire_ptrs, step); }
+
+    /// Advance the states of the specified tires by the given step.
+    void Advance(const std::vector<ChTire*>& tires, double step);
+
+  private:
+    std::vector<std::shared_ptr<ChTire>> m_tires;  ///< registered tires
+    std::vector<ChTire*> m_tire_ptrs;              ///< registered tires (raw pointers)
+
+    std::vector<ChTMeasyTire*> m_tmeasy;  ///< TMeasy tires in contact
+    std::vector<ChPac02Tire*> m_pac02;    ///< Pac02 tires in contact
+
+    // TMeasy combined-slip characteristic (one entry per tire)
+    std::vector<double> m_s;
+    std::vector<double> m_df0;
+    std::vector<double> m_sm;
+    std::vector<double> m_fm;
+    std::vector<double> m_ss;
+    std::vector<double> m_fs;
+    std::vector<double> m_f;
+    std::vector<double> m_fos;
+
+    // Pac02 magic formula (two entries per tire, for the longitudinal and lateral forces)
+    std::vector<double> m_X1;
+    std::vector<double> m_C;
+    std::vector<double> m_D;
+    std::vector<double> m_E;
+    std::vector<double> m_Sv;
+    std::vector<double> m_y;
+};
+
+/// @} vehicle_wheeled_tire
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -67,7 +67,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, MKL, MUMPS, PARDISO_PROJECT
 
 class ANCFBeamTest {
   public:
-    ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFBeamTest() { delete m_system; }
 
@@ -89,7 +89,7 @@ class ANCFBeamTest {
     int m_NumThreads;
 };
 
-ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = num_elements;
     m_NumThreads = NumThreads;
@@ -210,6 +210,9 @@ ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThre
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
 
+    // Optionally evaluate the element internal forces in batches of elements
+    mesh->SetBatchedInternalForces(useBatched);
+
     // Setup visualization
     auto vis_surf = chrono_types::make_shared<ChVisualShapeFEA>(mesh);
     vis_surf->SetFEMdataType(ChVisualShapeFEA::DataType::SURFACE);
@@ -488,6 +491,10 @@ int main(int argc, char* argv[]) {
                         ANCFBeamTest test(num_els(i), ls, NumThreads, true);
                         test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_ContInt");
                     }
+                    {
+                        ANCFBeamTest test(num_els(i), ls, NumThreads, true, true);
+                        test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_ContInt_Batched");
+                    }
                     {
                         ANCFBeamTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_PreInt");
@@ -66,7 +66,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, MKL, MUMPS, PARDISO_PROJECT
 
 class ANCFHexaTest {
   public:
-    ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFHexaTest() { delete m_system; }
 
@@ -88,7 +88,7 @@ class ANCFHexaTest {
     int m_NumThreads;
 };
 
-ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = 2 * num_elements * num_elements;
     m_NumThreads = NumThreads;
@@ -202,6 +202,9 @@ ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThre
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
 
+    // Optionally evaluate the element internal forces in batches of elements
+    mesh->SetBatchedInternalForces(useBatched);
+
     // Setup visualization
     auto mvisualizemesh = chrono_types::make_shared<ChVisualShapeFEA>(mesh);
     mvisualizemesh->SetFEMdataType(ChVisualShapeFEA::DataType::NODE_SPEED_NORM);
@@ -509,6 +512,10 @@ int main(int argc, char* argv[]) {
                         ANCFHexaTest test(num_els(i), ls, NumThreads, true);
                         test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_ContInt");
                     }
+                    {
+                        ANCFHexaTest test(num_els(i), ls, NumThreads, true, true);
+                        test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_ContInt_Batched");
+                    }
                     {
                         ANCFHexaTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_PreInt");
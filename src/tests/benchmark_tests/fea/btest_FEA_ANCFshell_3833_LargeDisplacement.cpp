@@ -66,7 +66,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, MKL, MUMPS, PARDISO_PROJECT
 
 class ANCFShellTest {
   public:
-    ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFShellTest() { delete m_system; }
 
@@ -88,7 +88,11 @@ class ANCFShellTest {
     int m_NumThreads;
 };
 
-ANCFShellTest::ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFShellTest::ANCFShellTest(int num_elements,
+                             SolverType solver_type,
+                             int NumThreads,
+                             bool useContInt,
+                             bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = 2 * num_elements * num_elements;
     m_NumThreads = NumThreads;
@@ -202,6 +206,9 @@ ANCFShellTest::ANCFShellTest(int num_elements, SolverType solver_type, int NumTh
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
 
+    // Optionally evaluate the element internal forces in batches of elements
+    mesh->SetBatchedInternalForces(useBatched);
+
     // Setup visualization
     auto mvisualizemesh = chrono_types::make_shared<ChVisualShapeFEA>(mesh);
     mvisualizemesh->SetFEMdataType(ChVisualShapeFEA::DataType::SURFACE);
@@ -507,6 +514,10 @@ int main(int argc, char* argv[]) {
                         ANCFShellTest test(num_els(i), ls, NumThreads, true);
                         test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_ContInt");
                     }
+                    {
+                        ANCFShellTest test(num_els(i), ls, NumThreads, true, true);
+                        test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_ContInt_Batched");
+                    }
                     {
                         ANCFShellTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_PreInt");
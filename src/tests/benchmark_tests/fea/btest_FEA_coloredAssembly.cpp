@@ -0,0 +1,121 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test comparing the assembly of FEA element internal forces by
+// element color (plain stores) and over all elements (atomic updates) for an
+// ANCF shell band mesh, for different numbers of threads.
+//
+// The benchmark reports the time for loading the element internal forces in the
+// global residual vector, as well as the number of element colors.
+//
+// =============================================================================
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// =============================================================================
+
+#define NUM_EVALUATIONS 200  // number of timed residual evaluations
+
+// Create a band of NX x NY ANCF shell elements (e.g., a flattened track band or tire tread).
+static std::shared_ptr<ChMesh> CreateBand(ChSystem& sys, int NX, int NY) {
+    double length = 2.0;
+    double width = 0.5;
+    double thickness = 0.01;
+    double dx = length / NX;
+    double dy = width / NY;
+
+    ChVector<> E(2.1e7, 2.1e7, 2.1e7);
+    ChVector<> nu(0.3, 0.3, 0.3);
+    ChVector<> G(8.0769231e6, 8.0769231e6, 8.0769231e6);
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, E, nu, G);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    ChVector<> dir(0, 0, 1);
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= NX; i++) {
+        for (int j = 0; j <= NY; j++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, j * dy, 0), dir);
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+
+    for (int i = 0; i < NX; i++) {
+        for (int j = 0; j < NY; j++) {
+            int nA = i * (NY + 1) + j;
+            int nB = (i + 1) * (NY + 1) + j;
+            auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+            element->SetNodes(nodes[nA], nodes[nB], nodes[nB + 1], nodes[nA + 1]);
+            element->SetDimensions(dx, dy);
+            element->AddLayer(thickness, 0, mat);
+            element->SetAlphaDamp(0.0);
+            mesh->AddElement(element);
+        }
+    }
+
+    return mesh;
+}
+
+// Benchmark arguments: number of threads, assembly method (0: atomic, 1: colored).
+static void ColoredAssembly(benchmark::State& state) {
+    int nthreads = (int)state.range(0);
+    bool colored = state.range(1) != 0;
+
+    ChSystemSMC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetNumThreads(nthreads);
+
+    auto mesh = CreateBand(sys, 200, 8);
+    mesh->SetColoredAssembly(colored);
+
+    // Complete the system setup and move the nodes away from the reference configuration
+    sys.DoStepDynamics(1e-4);
+
+    ChVectorDynamic<> R(sys.GetNcoords_w());
+    double time = 0;
+
+    for (auto _ : state) {
+        mesh->ResetTimers();
+        for (int i = 0; i < NUM_EVALUATIONS; i++) {
+            R.setZero();
+            sys.LoadResidual_F(R, 1.0);
+        }
+        time += mesh->GetTimeInternalForces();
+    }
+
+    state.counters["Elements"] = mesh->GetNelements();
+    state.counters["Colors"] = colored ? mesh->GetNumElementColors() : 0;
+    state.counters["Fint_ms/eval"] = 1e3 * time / (NUM_EVALUATIONS * state.iterations());
+}
+
+static void ColoredAssemblyArgs(benchmark::internal::Benchmark* b) {
+    for (int nthreads : {1, 2, 4, 8, 16}) {
+        b->Args({nthreads, 0});
+        b->Args({nthreads, 1});
+    }
+}
+
+BENCHMARK(ColoredAssembly)->Unit(benchmark::kMillisecond)->UseRealTime()->Apply(ColoredAssemblyArgs);
+
+// =============================================================================
+
+BENCHMARK_MAIN();
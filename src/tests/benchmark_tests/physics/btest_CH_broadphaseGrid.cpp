@@ -0,0 +1,169 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test comparing the broadphase grid resolution methods of the Chrono
+// collision system (fixed resolution, fixed bin size, fixed density, adaptive).
+//
+// Two scenes are considered:
+// - granular: spheres and boxes settling in a container (uniform distribution
+//   of collision shapes)
+// - clustered: a few piles of objects far apart on a large ground patch, as for
+//   a vehicle on a large terrain (most grid bins are empty and a few are dense)
+//
+// The benchmark reports the broadphase and narrowphase times per step, the final
+// number of grid bins, and the number of shape pairs found by the broadphase.
+//
+// =============================================================================
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// =============================================================================
+
+#define STEP_SIZE 1e-3      // integration step size
+#define NUM_SKIP_STEPS 200  // number of steps for hot start
+#define NUM_SIM_STEPS 500   // number of timed steps
+
+enum class Scene { GRANULAR, CLUSTERED };
+
+// Add a pile of spheres and boxes (4 layers of n x n objects) at the specified location.
+static void AddPile(ChSystem& sys, std::shared_ptr<ChMaterialSurface> mat, const ChVector<>& center, int n) {
+    double r = 0.1;
+    double d = 2.1 * r;
+    for (int k = 0; k < 4; k++) {
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                ChVector<> pos = center + ChVector<>((i - n / 2) * d + 0.01 * k, (j - n / 2) * d, r + k * d);
+                std::shared_ptr<ChBody> body;
+                if ((i + j + k) % 3 == 0)
+                    body = chrono_types::make_shared<ChBodyEasyBox>(1.6 * r, 1.6 * r, 1.6 * r, 1000, mat,
+                                                                    ChCollisionSystemType::CHRONO);
+                else
+                    body = chrono_types::make_shared<ChBodyEasySphere>(r, 1000, mat, ChCollisionSystemType::CHRONO);
+                body->SetPos(pos);
+                sys.AddBody(body);
+            }
+        }
+    }
+}
+
+// Add a fixed box.
+static void AddFixedBox(ChSystem& sys,
+                        std::shared_ptr<ChMaterialSurface> mat,
+                        const ChVector<>& pos,
+                        const ChVector<>& size) {
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(size.x(), size.y(), size.z(), 1000, mat,
+                                                        ChCollisionSystemType::CHRONO);
+    box->SetPos(pos);
+    box->SetBodyFixed(true);
+    sys.AddBody(box);
+}
+
+static void CreateScene(ChSystem& sys, Scene scene) {
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    switch (scene) {
+        case Scene::GRANULAR:
+            // Container with a single dense pile
+            AddFixedBox(sys, mat, ChVector<>(0, 0, -0.1), ChVector<>(5, 5, 0.2));
+            AddFixedBox(sys, mat, ChVector<>(-2.6, 0, 0.5), ChVector<>(0.2, 5, 1));
+            AddFixedBox(sys, mat, ChVector<>(+2.6, 0, 0.5), ChVector<>(0.2, 5, 1));
+            AddFixedBox(sys, mat, ChVector<>(0, -2.6, 0.5), ChVector<>(5, 0.2, 1));
+            AddFixedBox(sys, mat, ChVector<>(0, +2.6, 0.5), ChVector<>(5, 0.2, 1));
+            AddPile(sys, mat, ChVector<>(0, 0, 0), 22);
+            break;
+        case Scene::CLUSTERED:
+            // Large ground patch with four small piles, far apart
+            AddFixedBox(sys, mat, ChVector<>(0, 0, -0.1), ChVector<>(200, 200, 0.2));
+            AddPile(sys, mat, ChVector<>(-80, -80, 0), 11);
+            AddPile(sys, mat, ChVector<>(+80, -80, 0), 11);
+            AddPile(sys, mat, ChVector<>(-80, +80, 0), 11);
+            AddPile(sys, mat, ChVector<>(+80, +80, 0), 11);
+            break;
+    }
+}
+
+// Benchmark argument: grid method (0: fixed resolution, 1: fixed bin size, 2: fixed density, 3: adaptive).
+template <Scene SCENE>
+static void BroadphaseGrid(benchmark::State& state) {
+    int method = (int)state.range(0);
+
+    double broad_time = 0;
+    double narrow_time = 0;
+    ChVector<int> bins;
+    size_t num_pairs = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+
+        ChSystemNSC sys;
+        auto coll = chrono_types::make_shared<ChCollisionSystemChrono>();
+        switch (method) {
+            case 0:
+                coll->SetBroadphaseGridResolution(ChVector<int>(10, 10, 10));
+                break;
+            case 1:
+                coll->SetBroadphaseGridSize(ChVector<>(1, 1, 1));
+                break;
+            case 2:
+                coll->SetBroadphaseGridDensity(5);
+                break;
+            case 3:
+                coll->SetBroadphaseGridAdaptive(5);
+                break;
+        }
+        sys.SetCollisionSystem(coll);
+        CreateScene(sys, SCENE);
+
+        for (int i = 0; i < NUM_SKIP_STEPS + NUM_SIM_STEPS; i++) {
+            if (i == NUM_SKIP_STEPS)
+                state.ResumeTiming();
+            sys.DoStepDynamics(STEP_SIZE);
+            if (i >= NUM_SKIP_STEPS) {
+                broad_time += sys.GetTimerCollisionBroad();
+                narrow_time += sys.GetTimerCollisionNarrow();
+            }
+        }
+
+        bins = coll->GetBroadphaseGridResolution();
+        num_pairs = coll->GetOverlappingPairs().size();
+    }
+
+    state.counters["Bins"] = (double)bins.x() * bins.y() * bins.z();
+    state.counters["Pairs"] = (double)num_pairs;
+    state.counters["Broad_ms/step"] = 1e3 * broad_time / (NUM_SIM_STEPS * state.iterations());
+    state.counters["Narrow_ms/step"] = 1e3 * narrow_time / (NUM_SIM_STEPS * state.iterations());
+}
+
+#define BROADPHASE_GRID_TEST(SCENE)                 \
+    BENCHMARK_TEMPLATE(BroadphaseGrid, SCENE)       \
+        ->Unit(benchmark::kMillisecond)             \
+        ->UseRealTime()                             \
+        ->Iterations(1)                             \
+        ->Arg(0)                                    \
+        ->Arg(1)                                    \
+        ->Arg(2)                                    \
+        ->Arg(3);
+
+BROADPHASE_GRID_TEST(Scene::GRANULAR)
+BROADPHASE_GRID_TEST(Scene::CLUSTERED)
+
+// =============================================================================
+
+BENCHMARK_MAIN();
@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the VI solvers (APGD, Barzilai-Borwein, ADMM) on the NSC
+// mixer problem of btest_CH_mixerNSC, with different numbers of threads for the
+// constraint operations (Schur complement products, projections) and with or
+// without warm starting.
+//
+// The benchmark reports the solver iterations and the solver time per step.
+//
+// =============================================================================
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/solver/ChSolverBB.h"
+#include "chrono/solver/ChSolverADMM.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+#define NUM_BODIES 32       // number of bodies of each type (spheres, boxes, cylinders)
+#define STEP_SIZE 0.02      // integration step size
+#define NUM_SKIP_STEPS 200  // number of steps for hot start
+#define NUM_SIM_STEPS 200   // number of timed steps
+
+enum class SolverType { APGD, BB, ADMM };
+
+// Create the mixer of btest_CH_mixerNSC.
+static void CreateMixer(ChSystem& sys) {
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    ChSetRandomSeed(42);
+    for (int bi = 0; bi < NUM_BODIES; bi++) {
+        auto sphereBody = chrono_types::make_shared<ChBodyEasySphere>(1.0, 1000, true, true, mat);
+        sphereBody->SetPos(ChVector<>(-5 + ChRandom() * 10, 4 + bi * 0.05, -5 + ChRandom() * 10));
+        sys.Add(sphereBody);
+
+        auto boxBody = chrono_types::make_shared<ChBodyEasyBox>(1.25, 1.25, 1.25, 1000, true, true, mat);
+        boxBody->SetPos(ChVector<>(-5 + ChRandom() * 10, 4 + bi * 0.05, -5 + ChRandom() * 10));
+        sys.Add(boxBody);
+
+        auto cylBody = chrono_types::make_shared<ChBodyEasyCylinder>(0.8, 1.0, 1000, true, true, mat);
+        cylBody->SetPos(ChVector<>(-5 + ChRandom() * 10, 4 + bi * 0.05, -5 + ChRandom() * 10));
+        sys.Add(cylBody);
+    }
+
+    auto floorBody = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, true, true, mat);
+    floorBody->SetPos(ChVector<>(0, -5, 0));
+    floorBody->SetBodyFixed(true);
+    sys.Add(floorBody);
+
+    ChVector<> wall_pos[4] = {{-10, 0, 0}, {10, 0, 0}, {0, 0, -10}, {0, 0, 10}};
+    ChVector<> wall_size[4] = {{1, 10, 20.99}, {1, 10, 20.99}, {20.99, 10, 1}, {20.99, 10, 1}};
+    for (int i = 0; i < 4; i++) {
+        auto wallBody = chrono_types::make_shared<ChBodyEasyBox>(wall_size[i].x(), wall_size[i].y(), wall_size[i].z(),
+                                                                 1000, true, true, mat);
+        wallBody->SetPos(wall_pos[i]);
+        wallBody->SetBodyFixed(true);
+        sys.Add(wallBody);
+    }
+
+    auto rotatingBody = chrono_types::make_shared<ChBodyEasyBox>(10, 5, 1, 4000, true, true, mat);
+    rotatingBody->SetPos(ChVector<>(0, -1.6, 0));
+    sys.Add(rotatingBody);
+
+    auto motor = chrono_types::make_shared<ChLinkMotorRotationSpeed>();
+    motor->Initialize(rotatingBody, floorBody, ChFrame<>(ChVector<>(0, 0, 0), Q_from_AngAxis(CH_C_PI_2, VECT_X)));
+    motor->SetSpeedFunction(chrono_types::make_shared<ChFunction_Const>(CH_C_PI / 3.0));
+    sys.AddLink(motor);
+}
+
+// Benchmark arguments: number of threads, warm starting (0/1).
+template <SolverType SOLVER>
+static void MixerVI(benchmark::State& state) {
+    int num_threads = (int)state.range(0);
+    bool warm_start = state.range(1) != 0;
+
+    double solve_time = 0;
+    double num_iterations = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+
+        ChSystemNSC sys;
+        sys.SetNumThreads(num_threads, 1, 1);
+
+        std::shared_ptr<ChIterativeSolverVI> solver;
+        switch (SOLVER) {
+            case SolverType::APGD:
+                solver = chrono_types::make_shared<ChSolverAPGD>();
+                break;
+            case SolverType::BB:
+                solver = chrono_types::make_shared<ChSolverBB>();
+                break;
+            case SolverType::ADMM:
+                solver = chrono_types::make_shared<ChSolverADMM>();
+                break;
+        }
+        solver->SetMaxIterations(100);
+        solver->SetTolerance(1e-6);
+        solver->EnableWarmStart(warm_start);
+        sys.SetSolver(solver);
+
+        CreateMixer(sys);
+
+        for (int i = 0; i < NUM_SKIP_STEPS + NUM_SIM_STEPS; i++) {
+            if (i == NUM_SKIP_STEPS)
+                state.ResumeTiming();
+            sys.DoStepDynamics(STEP_SIZE);
+            if (i >= NUM_SKIP_STEPS) {
+                solve_time += sys.GetTimerLSsolve();
+                num_iterations += solver->GetIterations();
+            }
+        }
+    }
+
+    state.counters["Iterations/step"] = num_iterations / (NUM_SIM_STEPS * state.iterations());
+    state.counters["Solve_ms/step"] = 1e3 * solve_time / (NUM_SIM_STEPS * state.iterations());
+}
+
+static void MixerVIArgs(benchmark::internal::Benchmark* b) {
+    for (int nthreads : {1, 2, 4, 8}) {
+        b->Args({nthreads, 0});
+        b->Args({nthreads, 1});
+    }
+}
+
+#define MIXER_VI_TEST(SOLVER) \
+    BENCHMARK_TEMPLATE(MixerVI, SOLVER)->Unit(benchmark::kMillisecond)->UseRealTime()->Iterations(1)->Apply(MixerVIArgs);
+
+MIXER_VI_TEST(SolverType::APGD)
+MIXER_VI_TEST(SolverType::BB)
+MIXER_VI_TEST(SolverType::ADMM)
+
+// =============================================================================
+
+BENCHMARK_MAIN();
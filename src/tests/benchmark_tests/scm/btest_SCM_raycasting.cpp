@@ -0,0 +1,168 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Scaling of the SCM ray casting with the number of threads.
+// A set of rigid spheres is dropped on an SCM patch and the same simulation is
+// repeated with an increasing number of threads. For each run, report the
+// average time spent in ray casting per step and the speedup with respect to
+// the single-threaded run.
+//
+// The global reference frame has Z up.
+// All units SI.
+// =============================================================================
+
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+
+#include "chrono_thirdparty/cxxopts/ChCLI.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+using std::cout;
+using std::endl;
+
+// =============================================================================
+
+double terrainLength = 20;  // size in X direction
+double terrainWidth = 20;   // size in Y direction
+double delta = 0.02;        // SCM grid spacing
+
+// Number of spheres in each direction
+int num_spheres = 6;
+
+// Number of simulation steps (settling and timed)
+int num_settle_steps = 50;
+int num_steps = 200;
+
+// Simulation step size
+double step_size = 2e-3;
+
+// Maximum number of threads
+int max_threads = ChOMP::GetNumProcs();
+
+// =============================================================================
+
+struct RunStats {
+    double raycast;  // average ray casting time per step (ms)
+    double raytest;  // average ray testing time per step (ms)
+    int num_casts;   // number of ray casts at last step
+    int num_hits;    // number of ray hits at last step
+};
+
+RunStats Run(int nthreads) {
+    ChSystemSMC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetNumThreads(nthreads, nthreads, 1);
+
+    // Create a grid of spheres resting on the terrain
+    auto material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    double radius = 0.5;
+    double spacing = 0.8 * terrainLength / num_spheres;
+    for (int ix = 0; ix < num_spheres; ix++) {
+        for (int iy = 0; iy < num_spheres; iy++) {
+            double x = (ix - 0.5 * (num_spheres - 1)) * spacing;
+            double y = (iy - 0.5 * (num_spheres - 1)) * spacing;
+            auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, material);
+            sphere->SetPos(ChVector<>(x, y, radius + 0.05));
+            sys.AddBody(sphere);
+        }
+    }
+
+    // Create the SCM terrain (single patch covering all spheres)
+    SCMDeformableTerrain terrain(&sys, false);
+    terrain.SetSoilParameters(2e6,   // Bekker Kphi
+                              0,     // Bekker Kc
+                              1.1,   // Bekker n exponent
+                              0,     // Mohr cohesive limit (Pa)
+                              30,    // Mohr friction limit (degrees)
+                              0.01,  // Janosi shear coefficient (m)
+                              2e8,   // Elastic stiffness (Pa/m), before plastic yield
+                              3e4    // Damping (Pa s/m), proportional to negative vertical speed (optional)
+    );
+    terrain.Initialize(terrainLength, terrainWidth, delta);
+
+    for (int i = 0; i < num_settle_steps; i++)
+        sys.DoStepDynamics(step_size);
+
+    RunStats stats = {0, 0, 0, 0};
+    for (int i = 0; i < num_steps; i++) {
+        sys.DoStepDynamics(step_size);
+        stats.raycast += terrain.GetTimerRayCasting();
+        stats.raytest += terrain.GetTimerRayTesting();
+    }
+    stats.raycast /= num_steps;
+    stats.raytest /= num_steps;
+    stats.num_casts = terrain.GetNumRayCasts();
+    stats.num_hits = terrain.GetNumRayHits();
+
+    return stats;
+}
+
+// =============================================================================
+
+void AddCommandLineOptions(ChCLI& cli);
+
+int main(int argc, char* argv[]) {
+    GetLog() << "Copyright (c) 2021 projectchrono.org\nChrono version: " << CHRONO_VERSION << "\n\n";
+
+    ChCLI cli(argv[0]);
+
+    AddCommandLineOptions(cli);
+    if (!cli.Parse(argc, argv, true))
+        return 0;
+
+    delta = cli.GetAsType<double>("delta");
+    num_spheres = cli.GetAsType<int>("num_spheres");
+    num_steps = cli.GetAsType<int>("num_steps");
+    max_threads = cli.GetAsType<int>("max_threads");
+
+    // Thread counts: powers of 2, up to and including the maximum number of threads
+    std::vector<int> threads;
+    for (int n = 1; n < max_threads; n *= 2)
+        threads.push_back(n);
+    threads.push_back(max_threads);
+
+    cout << "SCM grid spacing: " << delta << endl;
+    cout << "Num. spheres:     " << num_spheres * num_spheres << endl;
+    cout << "Num. steps:       " << num_steps << endl;
+    cout << endl;
+    cout << std::setw(8) << "threads" << std::setw(10) << "casts" << std::setw(10) << "hits" << std::setw(14)
+         << "raytest (ms)" << std::setw(14) << "raycast (ms)" << std::setw(10) << "speedup" << endl;
+
+    double raycast_1 = 0;
+    for (auto n : threads) {
+        auto stats = Run(n);
+        if (n == 1)
+            raycast_1 = stats.raycast;
+        cout << std::setw(8) << n << std::setw(10) << stats.num_casts << std::setw(10) << stats.num_hits
+             << std::setw(14) << stats.raytest << std::setw(14) << stats.raycast << std::setw(10)
+             << raycast_1 / stats.raycast << endl;
+    }
+
+    return 0;
+}
+
+void AddCommandLineOptions(ChCLI& cli) {
+    cli.AddOption<double>("Test", "d,delta", "SCM grid spacing", std::to_string(delta));
+    cli.AddOption<int>("Test", "s,num_spheres", "Number of spheres in each direction", std::to_string(num_spheres));
+    cli.AddOption<int>("Test", "n,num_steps", "Number of timed steps", std::to_string(num_steps));
+    cli.AddOption<int>("Test", "t,max_threads", "Maximum number of threads", std::to_string(max_threads));
+}
@@ -0,0 +1,212 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the throughput of batches of independent vehicle
+// simulations (ChVehicleBatchRunner).
+//
+// Each member of the batch is a reduced HMMWV accelerating on flat rigid
+// terrain with a different (constant) throttle input. The benchmark reports the
+// throughput as simulated seconds per wall-clock second per thread.
+//
+// A second batch uses an HMMWV constructed from JSON specification files on a
+// mesh terrain patch. The terrain mesh and the tire and powertrain
+// specifications are loaded once per batch and shared by all batch members
+// (ChVehicleBatchRunner::GetSharedMesh and GetSharedJSON).
+//
+// =============================================================================
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/ChDriver.h"
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/powertrain/SimplePowertrain.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/utils/ChVehicleBatchRunner.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/TMeasyTire.h"
+#include "chrono_vehicle/wheeled_vehicle/vehicle/WheeledVehicle.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+// =============================================================================
+
+#define NUM_INSTANCES 16  // number of vehicle simulations in a batch
+#define END_TIME 2.0      // simulated time for each batch member
+#define STEP_SIZE 2e-3    // integration step size
+
+// =============================================================================
+
+class HmmwvInstance : public ChVehicleBatchRunner::Instance {
+  public:
+    HmmwvInstance(double throttle) : m_throttle(throttle) {}
+
+    virtual void Construct(ChSystem* system, ChVehicleBatchRunner& runner) override {
+        m_hmmwv = std::unique_ptr<HMMWV_Reduced>(new HMMWV_Reduced(system));
+        m_hmmwv->SetChassisFixed(false);
+        m_hmmwv->SetInitPosition(ChCoordsys<>(ChVector<>(0, 0, 0.5), QUNIT));
+        m_hmmwv->SetPowertrainType(PowertrainModelType::SIMPLE_MAP);
+        m_hmmwv->SetDriveType(DrivelineTypeWV::RWD);
+        m_hmmwv->SetTireType(TireModelType::TMEASY);
+        m_hmmwv->SetTireStepSize(STEP_SIZE);
+        m_hmmwv->Initialize();
+
+        m_terrain = std::unique_ptr<RigidTerrain>(new RigidTerrain(system));
+        auto patch_material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+        patch_material->SetFriction(0.9f);
+        patch_material->SetYoungModulus(2e7f);
+        m_terrain->AddPatch(patch_material, CSYSNORM, 200, 20);
+        m_terrain->Initialize();
+
+        m_driver = std::unique_ptr<ChDriver>(new ChDriver(m_hmmwv->GetVehicle()));
+        m_driver->Initialize();
+        m_driver->SetThrottle(m_throttle);
+    }
+
+    virtual void Synchronize(double time) override {
+        DriverInputs driver_inputs = m_driver->GetInputs();
+        m_driver->Synchronize(time);
+        m_terrain->Synchronize(time);
+        m_hmmwv->Synchronize(time, driver_inputs, *m_terrain);
+    }
+
+    virtual void Advance(double step) override {
+        m_driver->Advance(step);
+        m_terrain->Advance(step);
+        m_hmmwv->Advance(step);
+    }
+
+    virtual std::vector<double> GetResults() const override {
+        return {m_throttle, m_hmmwv->GetVehicle().GetPos().x(), m_hmmwv->GetVehicle().GetSpeed()};
+    }
+
+  private:
+    double m_throttle;
+    std::unique_ptr<HMMWV_Reduced> m_hmmwv;
+    std::unique_ptr<RigidTerrain> m_terrain;
+    std::unique_ptr<ChDriver> m_driver;
+};
+
+// HMMWV constructed from JSON specification files, on a mesh terrain patch.
+// The terrain mesh and the tire and powertrain specifications are shared by all instances in the batch.
+class HmmwvSharedInstance : public ChVehicleBatchRunner::Instance {
+  public:
+    HmmwvSharedInstance(double throttle) : m_throttle(throttle) {}
+
+    virtual void Construct(ChSystem* system, ChVehicleBatchRunner& runner) override {
+        m_vehicle = std::unique_ptr<WheeledVehicle>(
+            new WheeledVehicle(system, vehicle::GetDataFile("hmmwv/vehicle/HMMWV_Vehicle.json"), false, false));
+        m_vehicle->Initialize(ChCoordsys<>(ChVector<>(-25, 0, 0.5), QUNIT));
+
+        const auto& powertrain_json =
+            runner.GetSharedJSON(vehicle::GetDataFile("hmmwv/powertrain/HMMWV_SimplePowertrain.json"));
+        m_vehicle->InitializePowertrain(chrono_types::make_shared<SimplePowertrain>(powertrain_json));
+
+        const auto& tire_json = runner.GetSharedJSON(vehicle::GetDataFile("hmmwv/tire/HMMWV_TMeasyTire.json"));
+        for (auto& axle : m_vehicle->GetAxles()) {
+            for (auto& wheel : axle->GetWheels()) {
+                auto tire = chrono_types::make_shared<TMeasyTire>(tire_json);
+                tire->SetStepsize(STEP_SIZE);
+                m_vehicle->InitializeTire(tire, wheel, VisualizationType::NONE);
+            }
+        }
+
+        m_terrain = std::unique_ptr<RigidTerrain>(new RigidTerrain(system));
+        auto patch_material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+        patch_material->SetFriction(0.9f);
+        patch_material->SetYoungModulus(2e7f);
+        auto mesh = runner.GetSharedMesh(vehicle::GetDataFile("terrain/meshes/bump.obj"));
+        m_terrain->AddPatch(patch_material, CSYSNORM, mesh, "bump", 0, false);
+        m_terrain->Initialize();
+
+        m_driver = std::unique_ptr<ChDriver>(new ChDriver(*m_vehicle));
+        m_driver->Initialize();
+        m_driver->SetThrottle(m_throttle);
+    }
+
+    virtual void Synchronize(double time) override {
+        DriverInputs driver_inputs = m_driver->GetInputs();
+        m_driver->Synchronize(time);
+        m_terrain->Synchronize(time);
+        m_vehicle->Synchronize(time, driver_inputs, *m_terrain);
+    }
+
+    virtual void Advance(double step) override {
+        m_driver->Advance(step);
+        m_terrain->Advance(step);
+        m_vehicle->Advance(step);
+    }
+
+    virtual std::vector<double> GetResults() const override {
+        return {m_throttle, m_vehicle->GetPos().x(), m_vehicle->GetSpeed()};
+    }
+
+  private:
+    double m_throttle;
+    std::unique_ptr<WheeledVehicle> m_vehicle;
+    std::unique_ptr<RigidTerrain> m_terrain;
+    std::unique_ptr<ChDriver> m_driver;
+};
+
+// =============================================================================
+
+template <typename INSTANCE>
+void RunBatch(benchmark::State& state, const std::string& out_name) {
+    int num_threads = (int)state.range(0);
+
+    ChSystemSMC prototype;
+    prototype.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    ChVehicleBatchRunner runner(prototype);
+    runner.SetNumThreads(num_threads);
+    runner.SetResultNames({"throttle", "x", "speed"});
+
+    auto factory = [](int index) {
+        double throttle = 0.2 + (0.8 * index) / NUM_INSTANCES;
+        return std::unique_ptr<ChVehicleBatchRunner::Instance>(new INSTANCE(throttle));
+    };
+
+    double throughput = 0;
+    for (auto _ : state) {
+        runner.Run(NUM_INSTANCES, factory, END_TIME, STEP_SIZE);
+        throughput += runner.GetThroughput();
+    }
+
+    state.counters["Sim_s/Wall_s/Thread"] = throughput / state.iterations();
+    state.counters["Instances"] = NUM_INSTANCES;
+
+    runner.WriteResults(out_name + "_" + std::to_string(num_threads) + ".csv");
+}
+
+static void HmmwvBatch(benchmark::State& state) {
+    RunBatch<HmmwvInstance>(state, "batch_results");
+}
+
+static void HmmwvSharedBatch(benchmark::State& state) {
+    RunBatch<HmmwvSharedInstance>(state, "batch_shared_results");
+}
+
+BENCHMARK(HmmwvBatch)->Unit(benchmark::kMillisecond)->UseRealTime()->Iterations(1)->RangeMultiplier(2)->Range(1, 16);
+BENCHMARK(HmmwvSharedBatch)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Iterations(1)
+    ->RangeMultiplier(2)
+    ->Range(1, 16);
+
+// =============================================================================
+
+BENCHMARK_MAIN();
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the cost of tire updates as a function of the number of
+// vehicle wheels and of the number of threads used for tire updates.
+//
+// MAN trucks with 2, 3, and 4 axles (4, 6, and 8 TMeasy tires) are driven on
+// a rigid height-map terrain. The benchmark reports the wall-clock time spent
+// in the tire Synchronize and Advance functions per step (see
+// ChWheeledVehicle::GetTimerTires), as well as the total time per step.
+//
+// =============================================================================
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/core/ChTimer.h"
+
+#include "chrono_vehicle/ChDriver.h"
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "chrono_models/vehicle/man/MAN_5t.h"
+#include "chrono_models/vehicle/man/MAN_7t.h"
+#include "chrono_models/vehicle/man/MAN_10t.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::man;
+
+// =============================================================================
+
+#define STEP_SIZE 1e-3      // integration step size
+#define NUM_SKIP_STEPS 500  // number of steps for hot start
+#define NUM_SIM_STEPS 1000  // number of timed steps
+
+// =============================================================================
+
+template <typename MODEL>
+static void TireUpdate(benchmark::State& state) {
+    int num_threads = (int)state.range(0);
+
+    double tire_time = 0;
+    double step_time = 0;
+    int num_wheels = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+
+        MODEL truck;
+        truck.SetContactMethod(ChContactMethod::SMC);
+        truck.SetChassisFixed(false);
+        truck.SetInitPosition(ChCoordsys<>(ChVector<>(-40, 0, 1.5), QUNIT));
+        truck.SetPowertrainType(PowertrainModelType::SIMPLE_MAP);
+        truck.SetTireType(TireModelType::TMEASY);
+        truck.SetTireStepSize(STEP_SIZE);
+        truck.Initialize();
+
+        auto& veh = truck.GetVehicle();
+        veh.EnableParallelTires(num_threads > 1);
+        truck.GetSystem()->SetNumThreads(num_threads, 1, 1);
+
+        RigidTerrain terrain(truck.GetSystem());
+        auto patch_mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+        patch_mat->SetFriction(0.9f);
+        patch_mat->SetYoungModulus(2e7f);
+        terrain.AddPatch(patch_mat, CSYSNORM, vehicle::GetDataFile("terrain/height_maps/bump64.bmp"), 128, 64, 0, 1,
+                         true, 0, false);
+        terrain.Initialize();
+
+        ChDriver driver(veh);
+        driver.Initialize();
+        driver.SetThrottle(0.5);
+
+        num_wheels = 0;
+        for (auto& axle : veh.GetAxles())
+            num_wheels += (int)axle->GetWheels().size();
+
+        ChTimer<> timer;
+        for (int i = 0; i < NUM_SKIP_STEPS + NUM_SIM_STEPS; i++) {
+            if (i == NUM_SKIP_STEPS) {
+                state.ResumeTiming();
+                timer.start();
+            }
+
+            double time = truck.GetSystem()->GetChTime();
+            DriverInputs driver_inputs = driver.GetInputs();
+            driver.Synchronize(time);
+            terrain.Synchronize(time);
+            truck.Synchronize(time, driver_inputs, terrain);
+            driver.Advance(STEP_SIZE);
+            terrain.Advance(STEP_SIZE);
+            truck.Advance(STEP_SIZE);
+
+            if (i >= NUM_SKIP_STEPS)
+                tire_time += veh.GetTimerTires();
+        }
+        timer.stop();
+        step_time += timer();
+    }
+
+    state.counters["Wheels"] = num_wheels;
+    state.counters["Tire_ms/step"] = 1e3 * tire_time / (NUM_SIM_STEPS * state.iterations());
+    state.counters["Step_ms/step"] = 1e3 * step_time / (NUM_SIM_STEPS * state.iterations());
+}
+
+#define TIRE_UPDATE_TEST(MODEL)              \
+    BENCHMARK_TEMPLATE(TireUpdate, MODEL)    \
+        ->Unit(benchmark::kMillisecond)      \
+        ->UseRealTime()                      \
+        ->Iterations(1)                      \
+        ->Arg(1)                             \
+        ->Arg(2)                             \
+        ->Arg(4);
+
+TIRE_UPDATE_TEST(MAN_5t)   // 4 wheels
+TIRE_UPDATE_TEST(MAN_7t)   // 6 wheels
+TIRE_UPDATE_TEST(MAN_10t)  // 8 wheels
+
+// =============================================================================
+
+BENCHMARK_MAIN();
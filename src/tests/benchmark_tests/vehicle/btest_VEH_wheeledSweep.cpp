@@ -0,0 +1,273 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark suite for the step cost of a wheeled vehicle.
+//
+// An HMMWV with a kinematic (simple) driveline is driven on a straight line.
+// The suite sweeps over:
+// - tire model: rigid, TMeasy, Pac02
+// - terrain: flat rigid box, rigid mesh (height map), SCM deformable
+// - contact method: NSC, SMC
+// - number of OpenMP threads: 1, 2, 4, 8 (TMeasy tires, SMC contact only)
+//
+// Results include the per-phase ChBenchmarkTest timers (as benchmark counters)
+// and are written by default in JSON format to 'btest_VEH_wheeledSweep.json'
+// (override with --benchmark_out and --benchmark_out_format). Such output files
+// can be stored as baselines and compared with the 'compare.py' tool of the
+// Google benchmark library to flag performance regressions.
+//
+// =============================================================================
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono_vehicle/ChDriver.h"
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+// =============================================================================
+
+#define TIRE_RIGID 0
+#define TIRE_TMEASY 1
+#define TIRE_PAC02 2
+
+#define TERRAIN_FLAT 0
+#define TERRAIN_MESH 1
+#define TERRAIN_SCM 2
+
+double step_size = 1e-3;
+
+// =============================================================================
+
+// Driver with constant throttle, applied after an initial delay.
+class SweepDriver : public ChDriver {
+  public:
+    SweepDriver(ChVehicle& vehicle, double delay) : ChDriver(vehicle), m_delay(delay) {}
+    ~SweepDriver() {}
+
+    virtual void Synchronize(double time) override {
+        m_steering = 0;
+        m_braking = 0;
+
+        double eff_time = time - m_delay;
+        if (eff_time < 0)
+            m_throttle = 0;
+        else if (eff_time > 0.5)
+            m_throttle = 0.5;
+        else
+            m_throttle = eff_time;
+    }
+
+  private:
+    double m_delay;
+};
+
+// =============================================================================
+
+template <int TIRE_TYPE, int TERRAIN_TYPE, ChContactMethod METHOD, int THREADS>
+class WheeledSweepTest : public utils::ChBenchmarkTest {
+  public:
+    WheeledSweepTest();
+    ~WheeledSweepTest();
+
+    ChSystem* GetSystem() override { return m_hmmwv->GetSystem(); }
+    void ExecuteStep() override;
+
+  private:
+    HMMWV_Full* m_hmmwv;
+    SweepDriver* m_driver;
+    ChTerrain* m_terrain;
+};
+
+template <int TIRE_TYPE, int TERRAIN_TYPE, ChContactMethod METHOD, int THREADS>
+WheeledSweepTest<TIRE_TYPE, TERRAIN_TYPE, METHOD, THREADS>::WheeledSweepTest() {
+    TireModelType tire_type = TireModelType::RIGID;
+    switch (TIRE_TYPE) {
+        case TIRE_TMEASY:
+            tire_type = TireModelType::TMEASY;
+            break;
+        case TIRE_PAC02:
+            tire_type = TireModelType::PAC02;
+            break;
+    }
+
+    double init_height = (TERRAIN_TYPE == TERRAIN_MESH) ? 1.5 : 0.7;
+
+    // Create the HMMWV vehicle, set parameters, and initialize.
+    m_hmmwv = new HMMWV_Full();
+    m_hmmwv->SetContactMethod(METHOD);
+    m_hmmwv->SetChassisFixed(false);
+    m_hmmwv->SetInitPosition(ChCoordsys<>(ChVector<>(-20, 0, init_height), QUNIT));
+    m_hmmwv->SetPowertrainType(PowertrainModelType::SIMPLE_MAP);
+    m_hmmwv->SetDriveType(DrivelineTypeWV::SIMPLE);
+    m_hmmwv->SetTireType(tire_type);
+    m_hmmwv->SetTireStepSize(step_size);
+    m_hmmwv->Initialize();
+
+    m_hmmwv->SetChassisVisualizationType(VisualizationType::NONE);
+    m_hmmwv->SetSuspensionVisualizationType(VisualizationType::NONE);
+    m_hmmwv->SetSteeringVisualizationType(VisualizationType::NONE);
+    m_hmmwv->SetWheelVisualizationType(VisualizationType::NONE);
+    m_hmmwv->SetTireVisualizationType(VisualizationType::NONE);
+
+    ChSystem* sys = m_hmmwv->GetSystem();
+    sys->SetNumThreads(THREADS, THREADS, 1);
+
+    // Create the terrain
+    switch (TERRAIN_TYPE) {
+        case TERRAIN_FLAT:
+        case TERRAIN_MESH: {
+            auto patch_mat = ChMaterialSurface::DefaultMaterial(METHOD);
+            patch_mat->SetFriction(0.9f);
+            patch_mat->SetRestitution(0.01f);
+            auto terrain = new RigidTerrain(sys);
+            if (TERRAIN_TYPE == TERRAIN_FLAT)
+                terrain->AddPatch(patch_mat, CSYSNORM, 100, 64, 1, false, 1, false);
+            else
+                terrain->AddPatch(patch_mat, CSYSNORM, vehicle::GetDataFile("terrain/height_maps/bump64.bmp"), 100,
+                                  64, 0, 1, true, 0, false);
+            terrain->Initialize();
+            m_terrain = terrain;
+            break;
+        }
+        case TERRAIN_SCM: {
+            auto terrain = new SCMDeformableTerrain(sys, false);
+            terrain->SetSoilParameters(2e6,   // Bekker Kphi
+                                       0,     // Bekker Kc
+                                       1.1,   // Bekker n exponent
+                                       0,     // Mohr cohesive limit (Pa)
+                                       30,    // Mohr friction limit (degrees)
+                                       0.01,  // Janosi shear coefficient (m)
+                                       2e8,   // Elastic stiffness (Pa/m), before plastic yield
+                                       3e4    // Damping (Pa s/m), proportional to negative vertical speed (optional)
+            );
+            for (auto& axle : m_hmmwv->GetVehicle().GetAxles()) {
+                terrain->AddMovingPatch(axle->GetWheel(VehicleSide::LEFT)->GetSpindle(), ChVector<>(0, 0, 0),
+                                        ChVector<>(1.0, 0.3, 1.0));
+                terrain->AddMovingPatch(axle->GetWheel(VehicleSide::RIGHT)->GetSpindle(), ChVector<>(0, 0, 0),
+                                        ChVector<>(1.0, 0.3, 1.0));
+            }
+            terrain->Initialize(60, 10, 0.04);
+            m_terrain = terrain;
+            break;
+        }
+    }
+
+    m_driver = new SweepDriver(m_hmmwv->GetVehicle(), 0.5);
+    m_driver->Initialize();
+}
+
+template <int TIRE_TYPE, int TERRAIN_TYPE, ChContactMethod METHOD, int THREADS>
+WheeledSweepTest<TIRE_TYPE, TERRAIN_TYPE, METHOD, THREADS>::~WheeledSweepTest() {
+    delete m_hmmwv;
+    delete m_terrain;
+    delete m_driver;
+}
+
+template <int TIRE_TYPE, int TERRAIN_TYPE, ChContactMethod METHOD, int THREADS>
+void WheeledSweepTest<TIRE_TYPE, TERRAIN_TYPE, METHOD, THREADS>::ExecuteStep() {
+    double time = m_hmmwv->GetSystem()->GetChTime();
+
+    // Driver inputs
+    DriverInputs driver_inputs = m_driver->GetInputs();
+
+    // Update modules (process inputs from other modules)
+    m_driver->Synchronize(time);
+    m_terrain->Synchronize(time);
+    m_hmmwv->Synchronize(time, driver_inputs, *m_terrain);
+
+    // Advance simulation for one timestep for all modules
+    m_driver->Advance(step_size);
+    m_terrain->Advance(step_size);
+    m_hmmwv->Advance(step_size);
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 1000  // number of steps for hot start (1e-3 * 1000 = 1s)
+#define NUM_SIM_STEPS 1000   // number of simulation steps for each benchmark (1e-3 * 1000 = 1s)
+#define REPEATS 3
+
+// Define and register the benchmark for one combination of tire, terrain, contact method, and number of threads.
+// NOTE: the typedef prevents errors in expanding macros due to types that contain a comma.
+#define VEH_SWEEP_TEST(TIRE, TERRAIN, METHOD, THREADS)                                                          \
+    typedef WheeledSweepTest<TIRE_##TIRE, TERRAIN_##TERRAIN, ChContactMethod::METHOD, THREADS>                  \
+        TIRE##_##TERRAIN##_##METHOD##_##THREADS##_type;                                                         \
+    CH_BM_SIMULATION_ONCE(HmmwvSweep_##TIRE##_##TERRAIN##_##METHOD##_##THREADS,                                 \
+                          TIRE##_##TERRAIN##_##METHOD##_##THREADS##_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS)
+
+// Sweep over tire models, terrain types, and contact methods (single thread)
+VEH_SWEEP_TEST(RIGID, FLAT, NSC, 1);
+VEH_SWEEP_TEST(RIGID, FLAT, SMC, 1);
+VEH_SWEEP_TEST(RIGID, MESH, NSC, 1);
+VEH_SWEEP_TEST(RIGID, MESH, SMC, 1);
+VEH_SWEEP_TEST(RIGID, SCM, NSC, 1);
+VEH_SWEEP_TEST(RIGID, SCM, SMC, 1);
+
+VEH_SWEEP_TEST(TMEASY, FLAT, NSC, 1);
+VEH_SWEEP_TEST(TMEASY, FLAT, SMC, 1);
+VEH_SWEEP_TEST(TMEASY, MESH, NSC, 1);
+VEH_SWEEP_TEST(TMEASY, MESH, SMC, 1);
+VEH_SWEEP_TEST(TMEASY, SCM, NSC, 1);
+VEH_SWEEP_TEST(TMEASY, SCM, SMC, 1);
+
+VEH_SWEEP_TEST(PAC02, FLAT, NSC, 1);
+VEH_SWEEP_TEST(PAC02, FLAT, SMC, 1);
+VEH_SWEEP_TEST(PAC02, MESH, NSC, 1);
+VEH_SWEEP_TEST(PAC02, MESH, SMC, 1);
+VEH_SWEEP_TEST(PAC02, SCM, NSC, 1);
+VEH_SWEEP_TEST(PAC02, SCM, SMC, 1);
+
+// Sweep over number of threads
+VEH_SWEEP_TEST(TMEASY, FLAT, SMC, 2);
+VEH_SWEEP_TEST(TMEASY, FLAT, SMC, 4);
+VEH_SWEEP_TEST(TMEASY, FLAT, SMC, 8);
+VEH_SWEEP_TEST(TMEASY, MESH, SMC, 2);
+VEH_SWEEP_TEST(TMEASY, MESH, SMC, 4);
+VEH_SWEEP_TEST(TMEASY, MESH, SMC, 8);
+VEH_SWEEP_TEST(TMEASY, SCM, SMC, 2);
+VEH_SWEEP_TEST(TMEASY, SCM, SMC, 4);
+VEH_SWEEP_TEST(TMEASY, SCM, SMC, 8);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    // Unless otherwise specified, write results in JSON format
+    std::vector<char*> args(argv, argv + argc);
+    std::string out_file = "--benchmark_out=btest_VEH_wheeledSweep.json";
+    std::string out_format = "--benchmark_out_format=json";
+    bool has_out = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], "--benchmark_out=", 16) == 0)
+            has_out = true;
+    }
+    if (!has_out) {
+        args.push_back(&out_file[0]);
+        args.push_back(&out_format[0]);
+    }
+    int num_args = (int)args.size();
+
+    ::benchmark::Initialize(&num_args, args.data());
+    if (::benchmark::ReportUnrecognizedArguments(num_args, args.data()))
+        return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+}
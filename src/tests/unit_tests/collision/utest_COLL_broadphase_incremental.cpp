@@ -0,0 +1,207 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono unit test for the incremental broadphase of the Chrono collision system.
+//
+// Identical systems, with a grid of fixed boxes and a set of spheres moving on
+// prescribed trajectories, are processed with the default broadphase, with the
+// incremental broadphase, and with the incremental broadphase forced to rebuild
+// its grid at each step. A sphere is added midway through the run. At each step,
+// the lists of overlapping shape pairs must contain the same pairs, and the
+// incremental and rebuilt lists must be identical (order included).
+//
+// A pile of spheres falling on fixed boxes is also simulated with the incremental
+// broadphase and with a grid rebuild at each step. The resulting body states must
+// be identical.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+const int num_fixed = 10;   // number of fixed boxes in each direction
+const int num_moving = 20;  // number of moving spheres
+const int num_steps = 200;  // number of steps
+
+class Model {
+  public:
+    Model(bool incremental) {
+        m_coll = chrono_types::make_shared<ChCollisionSystemChrono>();
+        m_coll->SetBroadphaseGridResolution(ChVector<int>(8, 8, 2));
+        m_coll->EnableIncrementalBroadphase(incremental);
+        m_sys.SetCollisionSystem(m_coll);
+
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+
+        for (int i = 0; i < num_fixed; i++) {
+            for (int j = 0; j < num_fixed; j++) {
+                auto box = chrono_types::make_shared<ChBodyEasyBox>(0.9, 0.9, 0.2, 1000, mat,
+                                                                    ChCollisionSystemType::CHRONO);
+                box->SetPos(ChVector<>(i, j, 0));
+                box->SetBodyFixed(true);
+                m_sys.AddBody(box);
+            }
+        }
+
+        for (int k = 0; k < num_moving; k++)
+            AddBall();
+    }
+
+    void AddBall() {
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+        auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.3, 1000, mat, ChCollisionSystemType::CHRONO);
+        m_sys.AddBody(ball);
+        m_balls.push_back(ball);
+    }
+
+    // Set the positions of the spheres at the given step (some spheres are parked) and run collision detection.
+    void Update(int step) {
+        for (int k = 0; k < (int)m_balls.size(); k++) {
+            double t = (k % 3 == 0) ? 0.0 : step * 0.01;
+            double x = 4.5 + 3.5 * std::cos(t * (1 + 0.1 * k) + k);
+            double y = 4.5 + 3.5 * std::sin(t * (1 + 0.05 * k) + 2 * k);
+            double z = 0.3 + 0.2 * std::sin(3 * t + k);
+            m_balls[k]->SetPos(ChVector<>(x, y, z));
+        }
+        m_sys.ComputeCollisions();
+    }
+
+    // Return the list of overlapping shape pairs, optionally sorted.
+    std::vector<std::pair<int, int>> GetPairs(bool sorted) {
+        std::vector<std::pair<int, int>> pairs;
+        for (const auto& p : m_coll->GetOverlappingPairs())
+            pairs.push_back(std::make_pair(std::min(p.x, p.y), std::max(p.x, p.y)));
+        if (sorted)
+            std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+
+    ChSystemSMC m_sys;
+    std::shared_ptr<ChCollisionSystemChrono> m_coll;
+    std::vector<std::shared_ptr<ChBody>> m_balls;
+};
+
+TEST(ChBroadphase, incremental) {
+    Model ref(false);
+    Model inc(true);
+    Model reb(true);
+
+    int num_pairs = 0;
+    for (int step = 0; step < num_steps; step++) {
+        // Adding a collision model midway must trigger a rebuild of the incremental broadphase grid
+        int num_rebuilds = inc.m_coll->GetNumBroadphaseRebuilds();
+        if (step == num_steps / 2) {
+            ref.AddBall();
+            inc.AddBall();
+            reb.AddBall();
+        }
+
+        // Invalidate the grid, forcing a full rebuild
+        reb.m_coll->EnableIncrementalBroadphase(true);
+
+        ref.Update(step);
+        inc.Update(step);
+        reb.Update(step);
+
+        if (step == num_steps / 2) {
+            ASSERT_EQ(inc.m_coll->GetNumBroadphaseRebuilds(), num_rebuilds + 1);
+        }
+        ASSERT_EQ(reb.m_coll->GetNumBroadphaseRebuilds(), step + 1);
+
+        auto ref_pairs = ref.GetPairs(true);
+        auto inc_pairs = inc.GetPairs(false);
+        auto reb_pairs = reb.GetPairs(false);
+        ASSERT_EQ(inc_pairs, reb_pairs) << "step " << step;
+        ASSERT_EQ(ref_pairs, inc_pairs) << "step " << step;
+        num_pairs += (int)ref_pairs.size();
+
+        // Fixed boxes and parked spheres are never processed after the first step (except after a rebuild).
+        if (step > 0 && step != num_steps / 2) {
+            ASSERT_LE(inc.m_coll->GetNumBroadphaseMovedShapes(), num_moving + 1);
+        }
+    }
+
+    ASSERT_GT(num_pairs, 0);
+    ASSERT_GE(inc.m_coll->GetNumBroadphaseRebuilds(), 1);
+}
+
+// Pile of spheres falling on a grid of fixed boxes.
+class PileModel {
+  public:
+    PileModel() {
+        m_coll = chrono_types::make_shared<ChCollisionSystemChrono>();
+        m_coll->SetBroadphaseGridResolution(ChVector<int>(6, 6, 3));
+        m_coll->EnableIncrementalBroadphase(true);
+        m_sys.SetCollisionSystem(m_coll);
+        m_sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                auto box = chrono_types::make_shared<ChBodyEasyBox>(0.9, 0.9, 0.2, 1000, mat,
+                                                                    ChCollisionSystemType::CHRONO);
+                box->SetPos(ChVector<>(i, j, 0));
+                box->SetBodyFixed(true);
+                m_sys.AddBody(box);
+            }
+        }
+
+        for (int k = 0; k < 3; k++) {
+            for (int i = 0; i < 5; i++) {
+                for (int j = 0; j < 5; j++) {
+                    auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.25, 1000, mat,
+                                                                            ChCollisionSystemType::CHRONO);
+                    ball->SetPos(ChVector<>(0.6 * i + 0.05 * k, 0.6 * j, 0.5 + 0.55 * k));
+                    m_sys.AddBody(ball);
+                }
+            }
+        }
+    }
+
+    ChSystemNSC m_sys;
+    std::shared_ptr<ChCollisionSystemChrono> m_coll;
+};
+
+TEST(ChBroadphase, incremental_dynamics) {
+    PileModel inc;
+    PileModel reb;
+
+    for (int step = 0; step < 300; step++) {
+        // Invalidate the grid, forcing a full rebuild
+        reb.m_coll->EnableIncrementalBroadphase(true);
+
+        inc.m_sys.DoStepDynamics(1e-3);
+        reb.m_sys.DoStepDynamics(1e-3);
+
+        ASSERT_EQ(inc.m_sys.GetNcontacts(), reb.m_sys.GetNcontacts()) << "step " << step;
+        const auto& inc_bodies = inc.m_sys.Get_bodylist();
+        const auto& reb_bodies = reb.m_sys.Get_bodylist();
+        for (size_t i = 0; i < inc_bodies.size(); i++) {
+            ASSERT_EQ(inc_bodies[i]->GetPos(), reb_bodies[i]->GetPos()) << "step " << step << " body " << i;
+            ASSERT_EQ(inc_bodies[i]->GetRot(), reb_bodies[i]->GetRot()) << "step " << step << " body " << i;
+        }
+    }
+
+    ASSERT_GT(inc.m_sys.GetNcontacts(), 0);
+    ASSERT_LT(inc.m_coll->GetNumBroadphaseRebuilds(), 300);
+    ASSERT_EQ(reb.m_coll->GetNumBroadphaseRebuilds(), 300);
+}
@@ -0,0 +1,152 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono unit test for the multithreaded narrowphase of the Chrono collision
+// system.
+//
+// Identical systems, with a pile of boxes and spheres on a fixed ground box,
+// are simulated using different numbers of collision threads. At each step, the
+// lists of contacts must coincide (including their order) and the final body
+// states must be identical.
+// =============================================================================
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+const int num_layers = 4;    // number of layers of falling objects
+const int num_per_side = 6;  // number of objects in each direction, per layer
+const int num_steps = 100;   // number of steps
+
+struct ContactData {
+    ChVector<> pA;
+    ChVector<> pB;
+    double distance;
+    ChContactable* objA;
+    ChContactable* objB;
+};
+
+class ContactRecorder : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        m_contacts.push_back({pA, pB, distance, contactobjA, contactobjB});
+        return true;
+    }
+
+    std::vector<ContactData> m_contacts;
+};
+
+class Model {
+  public:
+    Model(int num_threads) {
+        m_coll = chrono_types::make_shared<ChCollisionSystemChrono>();
+        m_coll->SetBroadphaseGridResolution(ChVector<int>(4, 4, 2));
+        m_sys.SetCollisionSystem(m_coll);
+        m_sys.SetNumThreads(1, num_threads, 1);
+
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+        auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, mat, ChCollisionSystemType::CHRONO);
+        ground->SetPos(ChVector<>(0, 0, -0.5));
+        ground->SetBodyFixed(true);
+        m_sys.AddBody(ground);
+
+        // Objects are slightly offset in each layer, so that they overlap with their neighbors
+        for (int k = 0; k < num_layers; k++) {
+            for (int i = 0; i < num_per_side; i++) {
+                for (int j = 0; j < num_per_side; j++) {
+                    ChVector<> pos(0.45 * (i - num_per_side / 2) + 0.05 * k, 0.45 * (j - num_per_side / 2),
+                                   0.2 + 0.45 * k);
+                    std::shared_ptr<ChBody> body;
+                    if ((i + j + k) % 2 == 0)
+                        body = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.4, 0.3, 1000, mat,
+                                                                        ChCollisionSystemType::CHRONO);
+                    else
+                        body = chrono_types::make_shared<ChBodyEasySphere>(0.25, 1000, mat,
+                                                                           ChCollisionSystemType::CHRONO);
+                    body->SetPos(pos);
+                    body->SetRot(Q_from_AngZ(0.1 * (i + 2 * j + 3 * k)));
+                    m_sys.AddBody(body);
+                }
+            }
+        }
+    }
+
+    // Advance the system and return the list of contacts, in the order in which they were generated.
+    std::vector<ContactData> Step() {
+        m_sys.DoStepDynamics(1e-3);
+        auto recorder = chrono_types::make_shared<ContactRecorder>();
+        m_sys.GetContactContainer()->ReportAllContacts(recorder);
+        return recorder->m_contacts;
+    }
+
+    ChSystemNSC m_sys;
+    std::shared_ptr<ChCollisionSystemChrono> m_coll;
+};
+
+TEST(ChNarrowphase, threads) {
+    Model ref(1);
+    Model par2(2);
+    Model par4(4);
+
+    int num_contacts = 0;
+    for (int step = 0; step < num_steps; step++) {
+        auto ref_contacts = ref.Step();
+        auto par2_contacts = par2.Step();
+        auto par4_contacts = par4.Step();
+
+        ASSERT_EQ(ref_contacts.size(), par2_contacts.size()) << "step " << step;
+        ASSERT_EQ(ref_contacts.size(), par4_contacts.size()) << "step " << step;
+
+        // Contacts must be reported in the same order, with the same data. Since contact objects are different for
+        // the different systems, compare their indices in the body lists.
+        for (size_t i = 0; i < ref_contacts.size(); i++) {
+            auto idA = ((ChBody*)ref_contacts[i].objA)->GetId();
+            auto idB = ((ChBody*)ref_contacts[i].objB)->GetId();
+            ASSERT_EQ(idA, ((ChBody*)par2_contacts[i].objA)->GetId()) << "step " << step << " contact " << i;
+            ASSERT_EQ(idB, ((ChBody*)par2_contacts[i].objB)->GetId()) << "step " << step << " contact " << i;
+            ASSERT_EQ(idA, ((ChBody*)par4_contacts[i].objA)->GetId()) << "step " << step << " contact " << i;
+            ASSERT_EQ(idB, ((ChBody*)par4_contacts[i].objB)->GetId()) << "step " << step << " contact " << i;
+            ASSERT_EQ(ref_contacts[i].pA, par2_contacts[i].pA) << "step " << step << " contact " << i;
+            ASSERT_EQ(ref_contacts[i].pA, par4_contacts[i].pA) << "step " << step << " contact " << i;
+            ASSERT_EQ(ref_contacts[i].distance, par2_contacts[i].distance) << "step " << step << " contact " << i;
+            ASSERT_EQ(ref_contacts[i].distance, par4_contacts[i].distance) << "step " << step << " contact " << i;
+        }
+        num_contacts += (int)ref_contacts.size();
+    }
+
+    ASSERT_GT(num_contacts, 0);
+
+    // Identical contact lists result in identical solver results.
+    const auto& ref_bodies = ref.m_sys.Get_bodylist();
+    const auto& par2_bodies = par2.m_sys.Get_bodylist();
+    const auto& par4_bodies = par4.m_sys.Get_bodylist();
+    for (size_t i = 0; i < ref_bodies.size(); i++) {
+        ASSERT_EQ(ref_bodies[i]->GetPos(), par2_bodies[i]->GetPos()) << "body " << i;
+        ASSERT_EQ(ref_bodies[i]->GetPos(), par4_bodies[i]->GetPos()) << "body " << i;
+        ASSERT_EQ(ref_bodies[i]->GetPos_dt(), par2_bodies[i]->GetPos_dt()) << "body " << i;
+        ASSERT_EQ(ref_bodies[i]->GetPos_dt(), par4_bodies[i]->GetPos_dt()) << "body " << i;
+    }
+}
@@ -0,0 +1,189 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the batched evaluation of ANCF element internal forces. The
+// mesh residual evaluated with element batches must match the residual evaluated
+// one element at a time, for elements with and without damping and for batches
+// that are not completely filled.
+//
+// =============================================================================
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementBeamANCF_3333.h"
+#include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChElementShellANCF_3833.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Number of elements with and without damping in each test mesh
+#define NUM_DAMPED 5
+#define NUM_UNDAMPED 2
+
+// Set up the system (with 2 threads, to exercise the parallel assembly) and add an empty mesh.
+static std::shared_ptr<ChMesh> CreateMesh(ChSystem& sys) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetNumThreads(2);
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+    return mesh;
+}
+
+// Move the mesh nodes (and their gradients) away from the reference configuration and set non-zero velocities.
+static void PerturbNodes(ChMesh& mesh) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-0.01, 0.01);
+    auto rnd = [&]() { return ChVector<>(dist(gen), dist(gen), dist(gen)); };
+
+    for (unsigned int i = 0; i < mesh.GetNnodes(); i++) {
+        if (auto node = std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh.GetNode(i))) {
+            node->SetPos(node->GetPos() + rnd());
+            node->SetPos_dt(100.0 * rnd());
+        }
+        if (auto node = std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh.GetNode(i))) {
+            node->SetD(node->GetD() + rnd());
+            node->SetD_dt(100.0 * rnd());
+        }
+        if (auto node = std::dynamic_pointer_cast<ChNodeFEAxyzDD>(mesh.GetNode(i))) {
+            node->SetDD(node->GetDD() + rnd());
+            node->SetDD_dt(100.0 * rnd());
+        }
+        if (auto node = std::dynamic_pointer_cast<ChNodeFEAxyzDDD>(mesh.GetNode(i))) {
+            node->SetDDD(node->GetDDD() + rnd());
+            node->SetDDD_dt(100.0 * rnd());
+        }
+    }
+}
+
+// Compare the residual evaluated with and without element batches.
+static void CheckBatchedResidual(ChSystem& sys, std::shared_ptr<ChMesh> mesh, unsigned int num_batches) {
+    // Complete the system setup and deform the mesh
+    sys.DoStepDynamics(1e-4);
+    PerturbNodes(*mesh);
+
+    ChVectorDynamic<> R0(sys.GetNcoords_w());
+    R0.setZero();
+    mesh->SetBatchedInternalForces(false);
+    sys.LoadResidual_F(R0, 1.0);
+
+    ChVectorDynamic<> R1(sys.GetNcoords_w());
+    R1.setZero();
+    mesh->SetBatchedInternalForces(true);
+    sys.LoadResidual_F(R1, 1.0);
+    ASSERT_EQ(mesh->GetNumElementBatches(), num_batches);
+
+    double tol = 1e-12 * R0.lpNorm<Eigen::Infinity>();
+    ASSERT_GT(tol, 0);
+    for (int i = 0; i < R0.size(); i++)
+        ASSERT_NEAR(R1(i), R0(i), tol) << "residual entry " << i;
+}
+
+TEST(ChElementBatch, HexaANCF_3843) {
+    ChSystemSMC sys;
+    auto mesh = CreateMesh(sys);
+    auto material = chrono_types::make_shared<ChMaterialHexaANCF>(7810, 1e7, 0.3);
+
+    double L = 0.1;
+    double W = 0.05;
+    double H = 0.02;
+    ChVector<> dir1(1, 0, 0);
+    ChVector<> dir2(0, 1, 0);
+    ChVector<> dir3(0, 0, 1);
+    for (int ie = 0; ie < NUM_DAMPED + NUM_UNDAMPED; ie++) {
+        double x = ie * L;
+        ChVector<> pos[8] = {{x, 0, 0}, {x + L, 0, 0}, {x + L, W, 0}, {x, W, 0},
+                             {x, 0, H}, {x + L, 0, H}, {x + L, W, H}, {x, W, H}};
+        std::shared_ptr<ChNodeFEAxyzDDD> nodes[8];
+        for (int in = 0; in < 8; in++) {
+            nodes[in] = chrono_types::make_shared<ChNodeFEAxyzDDD>(pos[in], dir1, dir2, dir3);
+            mesh->AddNode(nodes[in]);
+        }
+        auto element = chrono_types::make_shared<ChElementHexaANCF_3843>();
+        element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
+        element->SetDimensions(L, W, H);
+        element->SetMaterial(material);
+        element->SetAlphaDamp(ie < NUM_DAMPED ? 0.01 : 0.0);
+        mesh->AddElement(element);
+    }
+
+    CheckBatchedResidual(sys, mesh, 3);
+}
+
+TEST(ChElementBatch, ShellANCF_3833) {
+    ChSystemSMC sys;
+    auto mesh = CreateMesh(sys);
+    ChVector<> E(2.1e7, 1.0e7, 1.0e7);
+    ChVector<> nu(0.3, 0.3, 0.3);
+    ChVector<> G(8.0e6, 8.0e6, 8.0e6);
+    auto material = chrono_types::make_shared<ChMaterialShellANCF>(7810, E, nu, G);
+
+    double L = 0.1;
+    double W = 0.05;
+    ChVector<> dir(0, 0, 1);
+    ChVector<> curv(0, 0, 0);
+    for (int ie = 0; ie < NUM_DAMPED + NUM_UNDAMPED; ie++) {
+        double x = ie * L;
+        ChVector<> pos[8] = {{x, 0, 0},         {x + L, 0, 0},     {x + L, W, 0},     {x, W, 0},
+                             {x + L / 2, 0, 0}, {x + L, W / 2, 0}, {x + L / 2, W, 0}, {x, W / 2, 0}};
+        std::shared_ptr<ChNodeFEAxyzDD> nodes[8];
+        for (int in = 0; in < 8; in++) {
+            nodes[in] = chrono_types::make_shared<ChNodeFEAxyzDD>(pos[in], dir, curv);
+            mesh->AddNode(nodes[in]);
+        }
+        auto element = chrono_types::make_shared<ChElementShellANCF_3833>();
+        element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
+        element->SetDimensions(L, W);
+        element->AddLayer(0.005, 0, material);
+        element->AddLayer(0.005, CH_C_PI / 6, material);
+        element->SetAlphaDamp(ie < NUM_DAMPED ? 0.01 : 0.0);
+        mesh->AddElement(element);
+    }
+
+    CheckBatchedResidual(sys, mesh, 3);
+}
+
+TEST(ChElementBatch, BeamANCF_3333) {
+    ChSystemSMC sys;
+    auto mesh = CreateMesh(sys);
+    auto material = chrono_types::make_shared<ChMaterialBeamANCF>(7810, 1e7, 0.3, 10 * (1 + 0.3) / (12 + 11 * 0.3),
+                                                                  10 * (1 + 0.3) / (12 + 11 * 0.3));
+
+    double L = 0.5;
+    double T = 0.02;
+    ChVector<> dir1(0, 1, 0);
+    ChVector<> dir2(0, 0, 1);
+    for (int ie = 0; ie < NUM_DAMPED + NUM_UNDAMPED; ie++) {
+        double x = ie * L;
+        auto nodeA = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x, 0, 0), dir1, dir2);
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x + L, 0, 0), dir1, dir2);
+        auto nodeC = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x + L / 2, 0, 0), dir1, dir2);
+        mesh->AddNode(nodeA);
+        mesh->AddNode(nodeB);
+        mesh->AddNode(nodeC);
+        auto element = chrono_types::make_shared<ChElementBeamANCF_3333>();
+        element->SetNodes(nodeA, nodeB, nodeC);
+        element->SetDimensions(L, T, T);
+        element->SetMaterial(material);
+        element->SetAlphaDamp(ie < NUM_DAMPED ? 0.01 : 0.0);
+        mesh->AddElement(element);
+    }
+
+    CheckBatchedResidual(sys, mesh, 3);
+}
@@ -0,0 +1,103 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the assembly of the K blocks of FEA elements in the system
+// matrix. The matrix assembled in parallel in a compressed matrix with a given
+// sparsity pattern (using the cached K block map of the system descriptor) must
+// be identical to the matrix assembled one block at a time.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Assemble the system matrix one K block at a time (in an empty matrix) and in parallel (in a compressed matrix with
+// the same sparsity pattern) and check that the two matrices are identical.
+static void CheckAssembly(ChSystemDescriptor& descriptor) {
+    ChSparseMatrix Z0;
+    descriptor.ConvertToMatrixForm(&Z0, nullptr);
+    Z0.makeCompressed();
+
+    ChSparseMatrix Z1 = Z0;
+    Z1.makeCompressed();
+    descriptor.SetNumThreads(4);
+    for (int i = 0; i < 2; i++) {
+        descriptor.ConvertToMatrixForm(&Z1, nullptr);
+        ASSERT_TRUE(Z1.isCompressed());
+        ASSERT_EQ(Z1.nonZeros(), Z0.nonZeros());
+        for (int k = 0; k < Z0.nonZeros(); k++) {
+            ASSERT_EQ(Z1.innerIndexPtr()[k], Z0.innerIndexPtr()[k]);
+            ASSERT_EQ(Z1.valuePtr()[k], Z0.valuePtr()[k]);
+        }
+    }
+}
+
+TEST(ChSystemDescriptor, KblockAssembly) {
+    ChSystemSMC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetNumThreads(2);
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    sys.SetSolver(solver);
+
+    ChVector<> E(2.1e7, 2.1e7, 2.1e7);
+    ChVector<> nu(0.3, 0.3, 0.3);
+    ChVector<> G(8.0769231e6, 8.0769231e6, 8.0769231e6);
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, E, nu, G);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    int NX = 8;
+    int NY = 2;
+    double dx = 0.1;
+    double dy = 0.1;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= NX; i++) {
+        for (int j = 0; j <= NY; j++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, j * dy, 0), ChVector<>(0, 0, 1));
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+    for (int i = 0; i < NX; i++) {
+        for (int j = 0; j < NY; j++) {
+            int nA = i * (NY + 1) + j;
+            int nB = (i + 1) * (NY + 1) + j;
+            auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+            element->SetNodes(nodes[nA], nodes[nB], nodes[nB + 1], nodes[nA + 1]);
+            element->SetDimensions(dx, dy);
+            element->AddLayer(0.01, 0, mat);
+            element->SetAlphaDamp(0.01);
+            mesh->AddElement(element);
+        }
+    }
+
+    for (int i = 0; i < 5; i++)
+        sys.DoStepDynamics(1e-3);
+    CheckAssembly(*sys.GetSystemDescriptor());
+
+    // Change the variable offsets and check that the K block map is reconstructed
+    nodes[NY + 1]->SetFixed(true);
+    for (int i = 0; i < 5; i++)
+        sys.DoStepDynamics(1e-3);
+    CheckAssembly(*sys.GetSystemDescriptor());
+}
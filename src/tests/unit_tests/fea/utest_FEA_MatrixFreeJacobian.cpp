@@ -0,0 +1,182 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for matrix-free element Jacobians. The products with the element
+// Jacobian (and its diagonal) evaluated without forming the Jacobian must match
+// those obtained with the element Jacobian matrix, and a simulation using an
+// iterative solver with matrix-free element Jacobians must match the simulation
+// using assembled element Jacobians.
+//
+// =============================================================================
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create a beam of NX hexahedral ANCF elements, fixed at one end.
+static std::shared_ptr<ChMesh> CreateBeam(ChSystem& sys, int NX, double alpha) {
+    auto material = chrono_types::make_shared<ChMaterialHexaANCF>(7810, 1e7, 0.3);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    double L = 0.1;
+    double W = 0.05;
+    double H = 0.05;
+    ChVector<> dir1(1, 0, 0);
+    ChVector<> dir2(0, 1, 0);
+    ChVector<> dir3(0, 0, 1);
+
+    std::shared_ptr<ChNodeFEAxyzDDD> nodes[4];
+    ChVector<> pos[4] = {{0, 0, 0}, {0, W, 0}, {0, W, H}, {0, 0, H}};
+    for (int in = 0; in < 4; in++) {
+        nodes[in] = chrono_types::make_shared<ChNodeFEAxyzDDD>(pos[in], dir1, dir2, dir3);
+        nodes[in]->SetFixed(true);
+        mesh->AddNode(nodes[in]);
+    }
+
+    for (int ie = 0; ie < NX; ie++) {
+        double x = (ie + 1) * L;
+        std::shared_ptr<ChNodeFEAxyzDDD> next[4];
+        ChVector<> next_pos[4] = {{x, 0, 0}, {x, W, 0}, {x, W, H}, {x, 0, H}};
+        for (int in = 0; in < 4; in++) {
+            next[in] = chrono_types::make_shared<ChNodeFEAxyzDDD>(next_pos[in], dir1, dir2, dir3);
+            mesh->AddNode(next[in]);
+        }
+
+        auto element = chrono_types::make_shared<ChElementHexaANCF_3843>();
+        element->SetNodes(nodes[0], next[0], next[1], nodes[1], nodes[3], next[3], next[2], nodes[2]);
+        element->SetDimensions(L, W, H);
+        element->SetMaterial(material);
+        element->SetAlphaDamp(alpha);
+        mesh->AddElement(element);
+
+        for (int in = 0; in < 4; in++)
+            nodes[in] = next[in];
+    }
+
+    return mesh;
+}
+
+// Compare the matrix-free product and diagonal of the element Jacobians with those of the element Jacobian matrices.
+static void CheckElementProducts(double alpha) {
+    ChSystemSMC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+    auto mesh = CreateBeam(sys, 2, alpha);
+
+    // Complete the system setup, then move the nodes away from the reference configuration
+    sys.DoStepDynamics(1e-4);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-0.01, 0.01);
+    auto rnd = [&]() { return ChVector<>(dist(gen), dist(gen), dist(gen)); };
+    for (unsigned int i = 0; i < mesh->GetNnodes(); i++) {
+        auto node = std::dynamic_pointer_cast<ChNodeFEAxyzDDD>(mesh->GetNode(i));
+        node->SetPos(node->GetPos() + rnd());
+        node->SetPos_dt(100.0 * rnd());
+        node->SetD(node->GetD() + rnd());
+        node->SetD_dt(100.0 * rnd());
+        node->SetDD(node->GetDD() + rnd());
+        node->SetDD_dt(100.0 * rnd());
+        node->SetDDD(node->GetDDD() + rnd());
+        node->SetDDD_dt(100.0 * rnd());
+    }
+
+    double Kfactor = -0.3;
+    double Rfactor = -0.7;
+    double Mfactor = 1.3;
+
+    for (unsigned int ie = 0; ie < mesh->GetNelements(); ie++) {
+        auto element = mesh->GetElement(ie);
+        int n = element->GetNdofs();
+
+        ChMatrixDynamic<> H(n, n);
+        H.setZero();
+        element->ComputeKRMmatricesGlobal(H, Kfactor, Rfactor, Mfactor);
+
+        ChVectorDynamic<> v(n);
+        for (int i = 0; i < n; i++)
+            v(i) = dist(gen);
+        ChVectorDynamic<> Hv0 = H * v;
+        ChVectorDynamic<> Hv1(n);
+        element->ComputeKRMmatricesProduct(Hv1, v, Kfactor, Rfactor, Mfactor);
+
+        double tol = 1e-10 * Hv0.lpNorm<Eigen::Infinity>();
+        for (int i = 0; i < n; i++)
+            ASSERT_NEAR(Hv1(i), Hv0(i), tol) << "product entry " << i;
+
+        ChVectorDynamic<> Hd0 = H.diagonal();
+        ChVectorDynamic<> Hd1(n);
+        element->ComputeKRMmatricesDiagonal(Hd1, Kfactor, Rfactor, Mfactor);
+
+        tol = 1e-10 * Hd0.lpNorm<Eigen::Infinity>();
+        for (int i = 0; i < n; i++)
+            ASSERT_NEAR(Hd1(i), Hd0(i), tol) << "diagonal entry " << i;
+    }
+}
+
+TEST(ChElementHexaANCF_3843, MatrixFreeProduct) {
+    CheckElementProducts(0.01);
+}
+
+TEST(ChElementHexaANCF_3843, MatrixFreeProductNoDamping) {
+    CheckElementProducts(0.0);
+}
+
+// Simulate with an iterative solver, with and without matrix-free element Jacobians.
+TEST(ChMesh, MatrixFreeJacobian) {
+    ChSystemSMC sys[2];
+    std::shared_ptr<ChMesh> mesh[2];
+    for (int k = 0; k < 2; k++) {
+        sys[k].Set_G_acc(ChVector<>(0, 0, -9.81));
+
+        auto solver = chrono_types::make_shared<ChSolverGMRES>();
+        solver->SetMaxIterations(500);
+        solver->SetTolerance(1e-12);
+        solver->EnableDiagonalPreconditioner(true);
+        sys[k].SetSolver(solver);
+
+        mesh[k] = CreateBeam(sys[k], 4, 0.01);
+        mesh[k]->SetMatrixFreeJacobian(k == 1);
+    }
+
+    for (int i = 0; i < 5; i++) {
+        sys[0].DoStepDynamics(1e-3);
+        sys[1].DoStepDynamics(1e-3);
+    }
+
+    // The stiffness matrix formed from the matrix-free K blocks must match the assembled one
+    ChSparseMatrix K0;
+    ChSparseMatrix K1;
+    sys[0].GetStiffnessMatrix(&K0);
+    sys[1].GetStiffnessMatrix(&K1);
+    ChMatrixDynamic<> K0d = K0.toDense();
+    ChMatrixDynamic<> K1d = K1.toDense();
+    ASSERT_EQ(K1d.rows(), K0d.rows());
+    ASSERT_NEAR((K1d - K0d).lpNorm<Eigen::Infinity>(), 0.0, 1e-6 * K0d.lpNorm<Eigen::Infinity>());
+
+    // The node positions must match
+    for (unsigned int i = 0; i < mesh[0]->GetNnodes(); i++) {
+        auto node0 = std::dynamic_pointer_cast<ChNodeFEAxyzDDD>(mesh[0]->GetNode(i));
+        auto node1 = std::dynamic_pointer_cast<ChNodeFEAxyzDDD>(mesh[1]->GetNode(i));
+        ASSERT_NEAR((node1->GetPos() - node0->GetPos()).Length(), 0.0, 1e-9) << "node " << i;
+    }
+}
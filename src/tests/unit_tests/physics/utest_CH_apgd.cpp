@@ -0,0 +1,113 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Tests for the APGD solver.
+//
+// The model consists of a stack of boxes resting on a fixed ground box. The
+// first test checks that the solver converges and that the contact forces on
+// the ground balance the weight of the stack. The second test drops an
+// additional box on the stack at high speed and checks that a warm-started
+// solver does not require more iterations than a cold-started one, also after
+// the impact.
+//
+// =============================================================================
+
+#include <iostream>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverAPGD.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+const int num_boxes = 4;
+const double box_mass = 0.4 * 0.4 * 0.2 * 1000;
+const double step_size = 1e-3;
+const int max_iterations = 1000;
+const double tolerance = 1e-6;
+
+struct Model {
+    Model(bool warm_start, bool drop_box);
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> ground;
+    std::shared_ptr<ChSolverAPGD> solver;
+};
+
+Model::Model(bool warm_start, bool drop_box) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < num_boxes; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.2, 1000, false, true, mat);
+        box->SetPos(ChVector<>(0, 0, 0.1 + 0.2 * i));
+        sys.AddBody(box);
+    }
+
+    if (drop_box) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.2, 1000, false, true, mat);
+        box->SetPos(ChVector<>(0, 0, 0.1 + 0.2 * num_boxes + 0.1));
+        box->SetPos_dt(ChVector<>(0, 0, -10));
+        sys.AddBody(box);
+    }
+
+    solver = chrono_types::make_shared<ChSolverAPGD>();
+    solver->SetMaxIterations(max_iterations);
+    solver->SetTolerance(tolerance);
+    solver->EnableWarmStart(warm_start);
+    sys.SetSolver(solver);
+}
+
+// =============================================================================
+
+TEST(ChSolverAPGD, convergence) {
+    Model model(false, false);
+
+    for (int i = 0; i < 200; i++) {
+        model.sys.DoStepDynamics(step_size);
+        ASSERT_LT(model.solver->GetIterations(), max_iterations);
+        ASSERT_LT(model.solver->GetError(), tolerance);
+    }
+
+    // The ground must support the weight of the stack.
+    double weight = num_boxes * box_mass * 9.81;
+    ASSERT_NEAR(model.ground->GetContactForce().z(), -weight, 1e-2 * weight);
+}
+
+TEST(ChSolverAPGD, warm_start) {
+    Model cold(false, true);
+    Model warm(true, true);
+
+    int cold_iterations = 0;
+    int warm_iterations = 0;
+    for (int i = 0; i < 200; i++) {
+        cold.sys.DoStepDynamics(step_size);
+        warm.sys.DoStepDynamics(step_size);
+        cold_iterations += cold.solver->GetIterations();
+        warm_iterations += warm.solver->GetIterations();
+    }
+
+    std::cout << "Total iterations.  cold start: " << cold_iterations << "  warm start: " << warm_iterations
+              << std::endl;
+    ASSERT_LE(warm_iterations, cold_iterations);
+}
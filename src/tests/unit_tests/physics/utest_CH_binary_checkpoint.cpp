@@ -0,0 +1,238 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for binary checkpoint/restart of the full system state.
+//
+// The first model consists of a chain of pendulums (with a rotational motor at
+// the first joint) and a pair of shafts connected through a gear. The second
+// model is a stack of boxes and spheres resting on the ground, with a solver
+// warm started from the contact reactions of the previous step. A simulation
+// is checkpointed half-way and the checkpoint is loaded into a second,
+// identical system. Both simulations are then continued and their states must
+// match exactly (or, with the Bullet collision system, up to a tolerance).
+//
+// =============================================================================
+
+#include <cstdio>
+
+#include "chrono/ChConfig.h"
+#ifdef CHRONO_COLLISION
+    #include "chrono/collision/ChCollisionSystemChrono.h"
+#endif
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/physics/ChShaftsBody.h"
+#include "chrono/physics/ChShaftsGear.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// =============================================================================
+
+const double step_size = 1e-3;
+const int num_steps = 500;
+const int num_links = 4;
+
+void BuildModel(ChSystem& sys) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 0; i < num_links; i++) {
+        auto link = chrono_types::make_shared<ChBodyEasyBox>(1.0, 0.1, 0.1, 1000, false, false);
+        link->SetPos(ChVector<>(0.5 + i, 0, 0));
+        sys.AddBody(link);
+
+        ChCoordsys<> csys(ChVector<>(i, 0, 0), Q_from_AngX(CH_C_PI_2));
+        if (i == 0) {
+            auto motor = chrono_types::make_shared<ChLinkMotorRotationSpeed>();
+            motor->Initialize(link, prev, ChFrame<>(csys));
+            motor->SetSpeedFunction(chrono_types::make_shared<ChFunction_Sine>(0, 0.5, 2.0));
+            sys.AddLink(motor);
+        } else {
+            auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+            rev->Initialize(prev, link, csys);
+            sys.AddLink(rev);
+        }
+        prev = link;
+    }
+
+    auto shaftA = chrono_types::make_shared<ChShaft>();
+    shaftA->SetInertia(0.5);
+    shaftA->SetAppliedTorque(2.0);
+    sys.AddShaft(shaftA);
+
+    auto shaftB = chrono_types::make_shared<ChShaft>();
+    shaftB->SetInertia(1.5);
+    sys.AddShaft(shaftB);
+
+    auto gear = chrono_types::make_shared<ChShaftsGear>();
+    gear->Initialize(shaftA, shaftB);
+    gear->SetTransmissionRatio(-0.25);
+    sys.Add(gear);
+}
+
+void BuildContactModel(ChSystemNSC& sys, ChCollisionSystemType collision_type) {
+#ifdef CHRONO_COLLISION
+    if (collision_type == ChCollisionSystemType::CHRONO)
+        sys.SetCollisionSystem(chrono_types::make_shared<ChCollisionSystemChrono>());
+#endif
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(20);
+    solver->EnableWarmStart(true);
+    sys.SetSolver(solver);
+
+    // Warm start contacts from the reactions at the previous step (Bullet keeps its own cache of contact reactions)
+    if (collision_type == ChCollisionSystemType::CHRONO)
+        std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer())->EnableReactionCache(true);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, mat, collision_type);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    // The boxes are initially separated, since the analytical box-box test is degenerate for boxes with coincident
+    // faces and edges.
+    for (int k = 0; k < 3; k++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.2, 1000, mat, collision_type);
+        box->SetPos(ChVector<>(0.02 * k, 0, 0.11 + 0.21 * k));
+        sys.AddBody(box);
+
+        auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, mat, collision_type);
+        ball->SetPos(ChVector<>(1.0, 0.3 * k, 0.1));
+        ball->SetPos_dt(ChVector<>(-0.5, 0, 0));
+        sys.AddBody(ball);
+    }
+}
+
+void CheckIdentical(ChSystem& sys1, ChSystem& sys2) {
+    ChState x1(sys1.GetNcoords_x(), &sys1);
+    ChState x2(sys2.GetNcoords_x(), &sys2);
+    ChStateDelta v1(sys1.GetNcoords_w(), &sys1);
+    ChStateDelta v2(sys2.GetNcoords_w(), &sys2);
+    ChVectorDynamic<> L1(sys1.GetNconstr());
+    ChVectorDynamic<> L2(sys2.GetNconstr());
+    double T1, T2;
+    sys1.StateGather(x1, v1, T1);
+    sys2.StateGather(x2, v2, T2);
+    sys1.StateGatherReactions(L1);
+    sys2.StateGatherReactions(L2);
+
+    ASSERT_EQ(T1, T2);
+    ASSERT_TRUE(x1 == x2);
+    ASSERT_TRUE(v1 == v2);
+    ASSERT_EQ(L1.size(), L2.size());
+    ASSERT_TRUE(L1 == L2);
+}
+
+void CheckClose(ChSystem& sys1, ChSystem& sys2, double tolerance) {
+    ChState x1(sys1.GetNcoords_x(), &sys1);
+    ChState x2(sys2.GetNcoords_x(), &sys2);
+    ChStateDelta v1(sys1.GetNcoords_w(), &sys1);
+    ChStateDelta v2(sys2.GetNcoords_w(), &sys2);
+    double T1, T2;
+    sys1.StateGather(x1, v1, T1);
+    sys2.StateGather(x2, v2, T2);
+
+    ASSERT_EQ(T1, T2);
+    ASSERT_LT((x1 - x2).lpNorm<Eigen::Infinity>(), tolerance);
+    ASSERT_LT((v1 - v2).lpNorm<Eigen::Infinity>(), tolerance);
+}
+
+TEST(ChSystem, binary_checkpoint) {
+    const std::string filename = "checkpoint_test.dat";
+
+    ChSystemNSC sys1;
+    BuildModel(sys1);
+    for (int i = 0; i < num_steps; i++)
+        sys1.DoStepDynamics(step_size);
+    ASSERT_TRUE(utils::WriteBinaryCheckpoint(&sys1, filename));
+
+    ChSystemNSC sys2;
+    BuildModel(sys2);
+    ASSERT_TRUE(utils::ReadBinaryCheckpoint(&sys2, filename));
+    ASSERT_EQ(sys1.GetChTime(), sys2.GetChTime());
+
+    for (int i = 0; i < num_steps; i++) {
+        sys1.DoStepDynamics(step_size);
+        sys2.DoStepDynamics(step_size);
+    }
+
+    CheckIdentical(sys1, sys2);
+
+    // A checkpoint cannot be loaded in a different system.
+    ChSystemNSC sys3;
+    BuildModel(sys3);
+    sys3.AddBody(chrono_types::make_shared<ChBody>());
+    ASSERT_FALSE(utils::ReadBinaryCheckpoint(&sys3, filename));
+
+    std::remove(filename.c_str());
+}
+
+// Checkpoint a simulation with contacts, load the checkpoint into a second system, and continue both simulations.
+void RunContactCheckpoint(ChSystemNSC& sys1, ChSystemNSC& sys2, const std::string& filename) {
+    for (int i = 0; i < num_steps; i++)
+        sys1.DoStepDynamics(step_size);
+    ASSERT_GT(sys1.GetNcontacts(), 0);
+    ASSERT_TRUE(utils::WriteBinaryCheckpoint(&sys1, filename));
+    ASSERT_TRUE(utils::ReadBinaryCheckpoint(&sys2, filename));
+
+    // The contacts generated at the first step after the restart are warm started from the saved reactions
+    for (int i = 0; i < num_steps; i++) {
+        sys1.DoStepDynamics(step_size);
+        sys2.DoStepDynamics(step_size);
+        ASSERT_EQ(sys1.GetNcontacts(), sys2.GetNcontacts());
+    }
+
+    std::remove(filename.c_str());
+}
+
+#ifdef CHRONO_COLLISION
+
+TEST(ChSystem, binary_checkpoint_contacts) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    BuildContactModel(sys1, ChCollisionSystemType::CHRONO);
+    BuildContactModel(sys2, ChCollisionSystemType::CHRONO);
+    RunContactCheckpoint(sys1, sys2, "checkpoint_contacts_test.dat");
+
+    CheckIdentical(sys1, sys2);
+}
+
+#endif
+
+// With Bullet, the restarted system warm starts new contact manifolds from the saved reactions, but the manifolds of
+// the original system retain contact points over several steps, so the results are not bit-identical.
+TEST(ChSystem, binary_checkpoint_contacts_bullet) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    BuildContactModel(sys1, ChCollisionSystemType::BULLET);
+    BuildContactModel(sys2, ChCollisionSystemType::BULLET);
+    RunContactCheckpoint(sys1, sys2, "checkpoint_contacts_bullet_test.dat");
+
+    CheckClose(sys1, sys2, 1e-3);
+}
@@ -0,0 +1,162 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Tests for reuse of the matrix factorization in sparse direct solvers.
+//
+// The model consists of a chain of pendulums moving under gravity, simulated
+// with the HHT integrator and the Eigen SparseLU solver. The tests compare the
+// results obtained with factorization reuse against those obtained with a new
+// factorization at each step, and check when the matrix is (re)factorized.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+const int num_links = 10;
+const double step_size = 1e-3;
+const int num_steps = 200;
+
+struct RunResult {
+    std::vector<ChVector<>> pos;  // final positions of the pendulum links
+    int num_setup;                // number of solver Setup calls
+    int num_factorizations;       // number of matrix factorizations
+    int num_refactorizations;     // number of numerical refactorizations
+    int num_reuses;               // number of Setup calls which reused the factorization
+    int num_refreshes;            // number of factorizations triggered by the accuracy monitor
+};
+
+void CreateModel(ChSystemSMC& sys, std::vector<std::shared_ptr<ChBody>>& links) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    auto prev = ground;
+    for (int i = 0; i < num_links; i++) {
+        auto link = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.05, 0.05, 1000, false, false);
+        link->SetPos(ChVector<>(0.5 * i + 0.25, 0, 0));
+        sys.AddBody(link);
+        links.push_back(link);
+
+        auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev->Initialize(prev, link, ChCoordsys<>(ChVector<>(0.5 * i, 0, 0), Q_from_AngX(CH_C_PI_2)));
+        sys.AddLink(rev);
+
+        prev = link;
+    }
+
+    sys.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-6);
+    integrator->SetModifiedNewton(true);
+}
+
+RunResult Simulate(bool reuse) {
+    ChSystemSMC sys;
+    std::vector<std::shared_ptr<ChBody>> links;
+    CreateModel(sys, links);
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    solver->EnableFactorizationReuse(reuse);
+    sys.SetSolver(solver);
+
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(step_size);
+
+    RunResult result;
+    for (const auto& link : links)
+        result.pos.push_back(link->GetPos());
+    result.num_setup = solver->GetNumSetupCalls();
+    result.num_factorizations = solver->GetNumFactorizations();
+    result.num_refactorizations = solver->GetNumRefactorizations();
+    result.num_reuses = solver->GetNumFactorizationReuses();
+    result.num_refreshes = solver->GetNumFactorizationRefreshes();
+
+    return result;
+}
+
+// =============================================================================
+
+TEST(ChDirectSolverLS, factorization_reuse) {
+    auto ref = Simulate(false);
+    auto res = Simulate(true);
+
+    // Without reuse, there is exactly one factorization per Setup call.
+    // After the first call, the locked sparsity pattern allows numerical refactorizations.
+    ASSERT_EQ(ref.num_factorizations, ref.num_setup);
+    ASSERT_EQ(ref.num_refactorizations, ref.num_setup - 1);
+    ASSERT_EQ(ref.num_reuses, 0);
+    ASSERT_EQ(ref.num_refreshes, 0);
+
+    // With reuse, most Setup calls keep the existing factorization. A Setup call that reuses the factorization does
+    // not refactorize; all other factorizations are numerical refactorizations (except the very first one).
+    ASSERT_GT(res.num_reuses, 0);
+    ASSERT_LT(res.num_factorizations, ref.num_factorizations);
+    ASSERT_EQ(res.num_factorizations, res.num_setup - res.num_reuses + res.num_refreshes);
+    ASSERT_EQ(res.num_refactorizations, res.num_factorizations - 1);
+
+    // Results must be consistent with those obtained with a new factorization at each step.
+    for (int i = 0; i < num_links; i++) {
+        ASSERT_NEAR(res.pos[i].x(), ref.pos[i].x(), 1e-3);
+        ASSERT_NEAR(res.pos[i].y(), ref.pos[i].y(), 1e-3);
+        ASSERT_NEAR(res.pos[i].z(), ref.pos[i].z(), 1e-3);
+    }
+}
+
+TEST(ChDirectSolverLS, force_refactorization) {
+    ChSystemSMC sys;
+    std::vector<std::shared_ptr<ChBody>> links;
+    CreateModel(sys, links);
+
+    // Allow a large number of reuses, so that only the accuracy monitor or an explicit request trigger factorizations
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    solver->EnableFactorizationReuse(true, 1000);
+    sys.SetSolver(solver);
+
+    for (int i = 0; i < 10; i++)
+        sys.DoStepDynamics(step_size);
+
+    for (int i = 0; i < 10; i++) {
+        bool force = (i % 2 == 1);
+        int num_refact = solver->GetNumRefactorizations();
+        int num_refresh = solver->GetNumFactorizationRefreshes();
+        int num_reuse = solver->GetNumFactorizationReuses();
+        if (force)
+            solver->ForceRefactorization();
+
+        sys.DoStepDynamics(step_size);
+
+        // Not counting factorizations triggered by the accuracy monitor, a forced step refactorizes exactly once (at
+        // the first Setup call of the step), while all Setup calls in other steps reuse the current factorization.
+        int delta_refact = solver->GetNumRefactorizations() - num_refact;
+        int delta_refresh = solver->GetNumFactorizationRefreshes() - num_refresh;
+        ASSERT_EQ(delta_refact - delta_refresh, force ? 1 : 0) << "step " << i;
+        ASSERT_GE(solver->GetNumFactorizationReuses() - num_reuse, force ? 0 : 1) << "step " << i;
+    }
+}
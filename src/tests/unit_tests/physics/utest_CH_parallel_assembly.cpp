@@ -0,0 +1,150 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the parallel evaluation of the per-item loops in ChAssembly.
+//
+// The model consists of a chain of pendulums connected through revolute joints
+// and spring-dampers, and a chain of shafts connected through gears. The same
+// model is simulated with serial assembly on 1 thread and with parallel
+// assembly on several threads. States and residuals must be identical.
+//
+// =============================================================================
+
+#include <string>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChShaft.h"
+#include "chrono/physics/ChShaftsGear.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+const int num_bodies = 40;
+const int num_shafts = 40;
+const int num_steps = 100;
+const double step_size = 1e-3;
+
+void BuildModel(ChSystem& sys) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.1, 0.1, 1000, false, false);
+        body->SetPos(ChVector<>(0.5 * i + 0.25, 0, 0));
+        sys.AddBody(body);
+
+        auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev->Initialize(prev, body, ChCoordsys<>(ChVector<>(0.5 * i, 0, 0), Q_from_AngX(CH_C_PI_2)));
+        sys.AddLink(rev);
+
+        auto spring = chrono_types::make_shared<ChLinkTSDA>();
+        spring->Initialize(ground, body, false, ChVector<>(0.5 * i, 0, 1), ChVector<>(0.5 * i + 0.25, 0, 0));
+        spring->SetSpringCoefficient(100.0 + i);
+        spring->SetDampingCoefficient(1.0);
+        sys.AddLink(spring);
+
+        prev = body;
+    }
+
+    std::shared_ptr<ChShaft> prev_shaft;
+    for (int i = 0; i < num_shafts; i++) {
+        auto shaft = chrono_types::make_shared<ChShaft>();
+        shaft->SetInertia(0.1 + 0.01 * i);
+        shaft->SetPos_dt(0.1 * i);
+        sys.Add(shaft);
+
+        if (prev_shaft) {
+            auto gear = chrono_types::make_shared<ChShaftsGear>();
+            gear->Initialize(prev_shaft, shaft);
+            gear->SetTransmissionRatio(-1.0);
+            sys.Add(gear);
+        } else {
+            shaft->SetAppliedTorque(2.0);
+        }
+        prev_shaft = shaft;
+    }
+}
+
+void ExpectEqual(const ChVectorDynamic<>& a, const ChVectorDynamic<>& b, const std::string& what, int step) {
+    ASSERT_EQ(a.size(), b.size()) << what << " step " << step;
+    for (int i = 0; i < a.size(); i++)
+        ASSERT_EQ(a(i), b(i)) << what << " step " << step << " index " << i;
+}
+
+TEST(ChAssembly, parallel_loops) {
+    ChSystemNSC sys_serial;
+    BuildModel(sys_serial);
+    sys_serial.SetNumThreads(1);
+    sys_serial.EnableParallelAssembly(false);
+
+    ChSystemNSC sys_parallel;
+    BuildModel(sys_parallel);
+    sys_parallel.SetNumThreads(4);
+    sys_parallel.EnableParallelAssembly(true);
+
+    for (int step = 0; step < num_steps; step++) {
+        sys_serial.DoStepDynamics(step_size);
+        sys_parallel.DoStepDynamics(step_size);
+
+        ChState x1, x2;
+        ChStateDelta v1, v2;
+        double t1, t2;
+        x1.setZero(sys_serial.GetNcoords_x(), &sys_serial);
+        v1.setZero(sys_serial.GetNcoords_v(), &sys_serial);
+        x2.setZero(sys_parallel.GetNcoords_x(), &sys_parallel);
+        v2.setZero(sys_parallel.GetNcoords_v(), &sys_parallel);
+        sys_serial.StateGather(x1, v1, t1);
+        sys_parallel.StateGather(x2, v2, t2);
+        ASSERT_EQ(t1, t2);
+        ExpectEqual(x1, x2, "x", step);
+        ExpectEqual(v1, v2, "v", step);
+    }
+
+    // Residuals and constraint terms at the final state
+    sys_serial.Update();
+    sys_parallel.Update();
+
+    int nv = sys_serial.GetNcoords_v();
+    int nc = sys_serial.GetNconstr();
+    ASSERT_EQ(sys_parallel.GetNcoords_v(), nv);
+    ASSERT_EQ(sys_parallel.GetNconstr(), nc);
+
+    ChVectorDynamic<> w(nv);
+    for (int i = 0; i < nv; i++)
+        w(i) = 1.0 + 0.1 * i;
+
+    ChVectorDynamic<> R1 = ChVectorDynamic<>::Zero(nv);
+    ChVectorDynamic<> R2 = ChVectorDynamic<>::Zero(nv);
+    sys_serial.LoadResidual_F(R1, 1.0);
+    sys_parallel.LoadResidual_F(R2, 1.0);
+    ExpectEqual(R1, R2, "F", num_steps);
+    sys_serial.LoadResidual_Mv(R1, w, 0.5);
+    sys_parallel.LoadResidual_Mv(R2, w, 0.5);
+    ExpectEqual(R1, R2, "F + M*w", num_steps);
+
+    ChVectorDynamic<> Qc1 = ChVectorDynamic<>::Zero(nc);
+    ChVectorDynamic<> Qc2 = ChVectorDynamic<>::Zero(nc);
+    sys_serial.LoadConstraint_C(Qc1, 1.0);
+    sys_parallel.LoadConstraint_C(Qc2, 1.0);
+    ExpectEqual(Qc1, Qc2, "C", num_steps);
+    sys_serial.LoadConstraint_Ct(Qc1, 2.0);
+    sys_parallel.LoadConstraint_Ct(Qc2, 2.0);
+    ExpectEqual(Qc1, Qc2, "C + Ct", num_steps);
+}
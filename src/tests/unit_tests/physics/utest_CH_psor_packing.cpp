@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for packed processing of rigid-body contacts in the PSOR solver.
+//
+// The model consists of a stack of boxes resting on a fixed ground box. The
+// test compares the results obtained with packed contacts against those
+// obtained with the default PSOR implementation, and checks that all contacts
+// (including the one-sided contacts with the fixed ground) are packed.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+const int num_boxes = 5;
+const double step_size = 1e-3;
+const double end_time = 0.5;
+
+struct RunResult {
+    std::vector<ChVector<>> pos;    // final positions of the boxes
+    std::vector<ChVector<>> force;  // final contact forces on the boxes
+    int num_packed;                 // number of packed contacts in the last solve
+    int num_contacts;               // number of contacts in the last step
+    int num_ground_contacts;        // number of contacts with the ground in the last step
+};
+
+// Count the contacts involving the specified body.
+class ContactCounter : public ChContactContainer::ReportContactCallback {
+  public:
+    ContactCounter(ChBody* body) : m_body(body), m_count(0) {}
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        if (contactobjA == m_body || contactobjB == m_body)
+            m_count++;
+        return true;
+    }
+    ChBody* m_body;
+    int m_count;
+};
+
+RunResult Simulate(bool packing) {
+    ChSystemNSC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> boxes;
+    for (int i = 0; i < num_boxes; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.2, 1000, false, true, mat);
+        box->SetPos(ChVector<>(0.01 * i, 0, 0.1 + 0.2 * i));
+        box->SetPos_dt(ChVector<>(0.1, 0, 0));
+        sys.AddBody(box);
+        boxes.push_back(box);
+    }
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(100);
+    solver->SetTolerance(1e-8);
+    solver->EnableWarmStart(true);
+    solver->EnableContactPacking(packing);
+    sys.SetSolver(solver);
+
+    while (sys.GetChTime() < end_time)
+        sys.DoStepDynamics(step_size);
+
+    RunResult result;
+    for (const auto& box : boxes) {
+        result.pos.push_back(box->GetPos());
+        result.force.push_back(box->GetContactForce());
+    }
+    result.num_packed = solver->GetNumPackedContacts();
+    result.num_contacts = sys.GetNcontacts();
+
+    auto counter = chrono_types::make_shared<ContactCounter>(ground.get());
+    sys.GetContactContainer()->ReportAllContacts(counter);
+    result.num_ground_contacts = counter->m_count;
+
+    return result;
+}
+
+// =============================================================================
+
+TEST(ChSolverPSOR, contact_packing) {
+    auto ref = Simulate(false);
+    auto res = Simulate(true);
+
+    ASSERT_EQ(ref.num_packed, 0);
+
+    // All contacts must be packed, including those with the fixed ground.
+    ASSERT_GT(res.num_ground_contacts, 0);
+    ASSERT_GT(res.num_contacts, res.num_ground_contacts);
+    ASSERT_EQ(res.num_packed, res.num_contacts);
+
+    // Results must match those of the default implementation (up to round-off).
+    for (int i = 0; i < num_boxes; i++) {
+        ASSERT_NEAR(res.pos[i].x(), ref.pos[i].x(), 1e-6);
+        ASSERT_NEAR(res.pos[i].y(), ref.pos[i].y(), 1e-6);
+        ASSERT_NEAR(res.pos[i].z(), ref.pos[i].z(), 1e-6);
+        ASSERT_NEAR(res.force[i].x(), ref.force[i].x(), 1e-3);
+        ASSERT_NEAR(res.force[i].y(), ref.force[i].y(), 1e-3);
+        ASSERT_NEAR(res.force[i].z(), ref.force[i].z(), 1e-3);
+    }
+}
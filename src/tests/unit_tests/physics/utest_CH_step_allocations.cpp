@@ -0,0 +1,98 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for zero-allocation steady-state stepping.
+//
+// The model consists of a box resting on a fixed ground box and a pendulum
+// connected to ground through a revolute joint. With reuse of per-step buffers
+// enabled, no dynamic memory allocations are expected once the number of
+// contacts has settled.
+//
+// =============================================================================
+
+#include "chrono/core/ChAllocationCounter.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+CH_INSTALL_ALLOCATION_COUNTER()
+
+// =============================================================================
+
+const double step_size = 1e-3;
+const int num_warmup_steps = 500;
+const int num_test_steps = 500;
+
+void BuildModel(ChSystem& sys, std::shared_ptr<ChMaterialSurface> mat) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.2, 1000, false, true, mat);
+    box->SetPos(ChVector<>(0, 0, 0.1));
+    sys.AddBody(box);
+
+    auto pend = chrono_types::make_shared<ChBodyEasyBox>(1.0, 0.1, 0.1, 1000, false, false);
+    pend->SetPos(ChVector<>(1.5, 0, 2));
+    sys.AddBody(pend);
+
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(ground, pend, ChCoordsys<>(ChVector<>(1, 0, 2), Q_from_AngX(CH_C_PI_2)));
+    sys.AddLink(rev);
+}
+
+void CheckSteadyState(ChSystem& sys) {
+    sys.EnableBufferReuse(true);
+
+    // The first step sets up all buffers.
+    sys.DoStepDynamics(step_size);
+    ASSERT_GT(sys.GetNumAllocationsStep(), 0u);
+
+    for (int i = 1; i < num_warmup_steps; i++)
+        sys.DoStepDynamics(step_size);
+
+    int num_contacts = sys.GetNcontacts();
+    ASSERT_GT(num_contacts, 0);
+
+    for (int i = 0; i < num_test_steps; i++) {
+        sys.DoStepDynamics(step_size);
+        ASSERT_EQ(sys.GetNcontacts(), num_contacts);
+        ASSERT_EQ(sys.GetNumAllocationsStep(), 0u);
+    }
+}
+
+// =============================================================================
+
+TEST(ChSystem, step_allocations_NSC) {
+    ChSystemNSC sys;
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+    BuildModel(sys, mat);
+    CheckSteadyState(sys);
+}
+
+TEST(ChSystem, step_allocations_SMC) {
+    ChSystemSMC sys;
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetFriction(0.5f);
+    mat->SetYoungModulus(1e7f);
+    BuildModel(sys, mat);
+    CheckSteadyState(sys);
+}
@@ -0,0 +1,160 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Tests for the scoped-zone trace profiler.
+//
+// The tests record zone events from several threads, check the wraparound of
+// the per-thread ring buffers and the discarding of events on Reset, and check
+// that the exported Chrome trace is valid JSON with one thread id per thread.
+//
+// Note that these tests do not rely on the CH_PROFILE_ZONE macro, so they also
+// run when the profiler instrumentation is compiled out.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono/utils/ChTraceProfiler.h"
+
+#include "chrono_thirdparty/rapidjson/document.h"
+#include "chrono_thirdparty/rapidjson/filereadstream.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+// =============================================================================
+
+const std::string filename = "trace_profiler_test.json";
+
+// Export the recorded events, parse the resulting file, and return the trace events.
+// Events are collected per thread id, in the order in which they appear in the file.
+std::map<int, std::vector<const rapidjson::Value*>> ExportAndParse(rapidjson::Document& d) {
+    std::map<int, std::vector<const rapidjson::Value*>> events;
+
+    EXPECT_TRUE(ChTraceProfiler::ExportChromeTrace(filename));
+    FILE* fp = fopen(filename.c_str(), "r");
+    EXPECT_TRUE(fp != nullptr);
+    if (!fp)
+        return events;
+    char buffer[65536];
+    rapidjson::FileReadStream is(fp, buffer, sizeof(buffer));
+    d.ParseStream(is);
+    fclose(fp);
+    std::remove(filename.c_str());
+
+    EXPECT_FALSE(d.HasParseError());
+    if (d.HasParseError())
+        return events;
+    EXPECT_TRUE(d.HasMember("traceEvents"));
+    EXPECT_TRUE(d["traceEvents"].IsArray());
+
+    for (const auto& e : d["traceEvents"].GetArray()) {
+        EXPECT_TRUE(e.HasMember("name") && e["name"].IsString());
+        EXPECT_TRUE(e.HasMember("ph") && e["ph"].IsString());
+        EXPECT_TRUE(e.HasMember("tid") && e["tid"].IsInt());
+        EXPECT_TRUE(e.HasMember("ts") && e["ts"].IsNumber());
+        EXPECT_TRUE(e.HasMember("dur") && e["dur"].IsNumber());
+        events[e["tid"].GetInt()].push_back(&e);
+    }
+
+    return events;
+}
+
+// =============================================================================
+
+TEST(ChTraceProfiler, multithread) {
+    const size_t num_threads = 4;
+    const size_t num_zones = 10;
+
+    // Each thread records nested zones, in its own buffer.
+    ChTraceProfiler::Reset();
+    ChTraceProfiler::Enable(true);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; t++) {
+        threads.push_back(std::thread([]() {
+            for (size_t i = 0; i < num_zones / 2; i++) {
+                ChTraceZone outer("outer");
+                ChTraceZone inner("inner \"quoted\"");
+            }
+        }));
+    }
+    for (auto& thread : threads)
+        thread.join();
+    ChTraceProfiler::Enable(false);
+
+    // Zones are not recorded while the profiler is disabled.
+    {
+        ChTraceZone zone("disabled");
+    }
+
+    rapidjson::Document d;
+    auto events = ExportAndParse(d);
+
+    ASSERT_EQ(events.size(), num_threads);
+    for (const auto& thread_events : events) {
+        ASSERT_EQ(thread_events.second.size(), num_zones);
+        for (const auto e : thread_events.second) {
+            std::string name = (*e)["name"].GetString();
+            ASSERT_TRUE(name == "outer" || name == "inner \"quoted\"");
+            ASSERT_STREQ((*e)["ph"].GetString(), "X");
+            ASSERT_GE((*e)["dur"].GetDouble(), 0.0);
+        }
+    }
+}
+
+TEST(ChTraceProfiler, wraparound) {
+    const size_t capacity = 8;
+    const int num_events = 20;
+
+    // The buffer size only applies to threads which did not record any events yet.
+    ChTraceProfiler::Reset();
+    ChTraceProfiler::SetBufferSize(capacity);
+    std::thread thread([]() {
+        for (int i = 0; i < num_events; i++)
+            ChTraceProfiler::Record("event", i * 1000, i * 1000 + 500);
+    });
+    thread.join();
+    ChTraceProfiler::SetBufferSize(65536);
+
+    rapidjson::Document d;
+    auto events = ExportAndParse(d);
+
+    // Only the most recent events are kept, in the order in which they were recorded.
+    ASSERT_EQ(events.size(), 1u);
+    const auto& thread_events = events.begin()->second;
+    ASSERT_EQ(thread_events.size(), capacity);
+    for (size_t i = 0; i < capacity; i++) {
+        ASSERT_DOUBLE_EQ((*thread_events[i])["ts"].GetDouble(), (double)(num_events - capacity + i));
+        ASSERT_DOUBLE_EQ((*thread_events[i])["dur"].GetDouble(), 0.5);
+    }
+}
+
+TEST(ChTraceProfiler, reset) {
+    std::thread thread([]() {
+        for (int i = 0; i < 5; i++)
+            ChTraceProfiler::Record("event", i, i + 1);
+    });
+    thread.join();
+
+    ChTraceProfiler::Reset();
+
+    rapidjson::Document d;
+    auto events = ExportAndParse(d);
+    ASSERT_TRUE(events.empty());
+    ASSERT_EQ(d["traceEvents"].Size(), 0u);
+}
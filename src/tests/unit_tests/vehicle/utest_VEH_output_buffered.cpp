@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Vehicle unit test for the buffered vehicle output.
+//
+// A number of frames much larger than the number of frame buffers is written
+// with an asynchronous ASCII output database. After the database is closed,
+// all frames must be present in the output file, in order, with the recorded
+// values. The file must be identical to the one produced in synchronous mode.
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "chrono/physics/ChShaft.h"
+
+#include "chrono_vehicle/output/ChVehicleOutputASCII.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const int num_frames = 1000;
+const int num_buffers = 2;
+
+// Write all frames with the given output database, then destroy it.
+void WriteFrames(ChVehicleOutput* output, std::shared_ptr<ChShaft> shaft) {
+    std::unique_ptr<ChVehicleOutput> out(output);
+    for (int k = 0; k < num_frames; k++) {
+        shaft->SetPos(k);
+        shaft->SetPos_dt(-k);
+        out->WriteTime(k, 0.5 * k);
+        out->WriteSection("Test");
+        out->WriteShafts({shaft});
+    }
+}
+
+std::string ReadFile(const std::string& filename) {
+    std::ifstream ifs(filename);
+    return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+TEST(ChVehicleOutputBuffered, async_ascii) {
+    const std::string filename_async = "utest_VEH_output_buffered_async.txt";
+    const std::string filename_sync = "utest_VEH_output_buffered_sync.txt";
+
+    // The same shaft is used for both runs (the output includes its identifier)
+    auto shaft = chrono_types::make_shared<ChShaft>();
+    shaft->SetName("shaft");
+
+    auto out_async = new ChVehicleOutputASCII(filename_async, true, num_buffers);
+    ASSERT_TRUE(out_async->IsAsync());
+    WriteFrames(out_async, shaft);
+    WriteFrames(new ChVehicleOutputASCII(filename_sync, false, num_buffers), shaft);
+
+    std::string contents = ReadFile(filename_async);
+    std::remove(filename_async.c_str());
+    ASSERT_EQ(contents, ReadFile(filename_sync));
+    std::remove(filename_sync.c_str());
+
+    // Check that all frames were written, in order
+    std::istringstream iss(contents);
+    std::string line;
+    int num_times = 0;
+    int num_shafts = 0;
+    while (std::getline(iss, line)) {
+        if (line.rfind("Time: ", 0) == 0) {
+            ASSERT_EQ(std::stod(line.substr(6)), 0.5 * num_times) << line;
+            num_times++;
+        } else if (line.find("shaft: ") != std::string::npos) {
+            std::istringstream fields(line.substr(line.find("\"shaft\"") + 7));
+            double pos, vel;
+            fields >> pos >> vel;
+            ASSERT_EQ(num_shafts + 1, num_times) << line;
+            ASSERT_EQ(pos, num_shafts) << line;
+            ASSERT_EQ(vel, -num_shafts) << line;
+            num_shafts++;
+        }
+    }
+    ASSERT_EQ(num_times, num_frames);
+    ASSERT_EQ(num_shafts, num_frames);
+}
@@ -0,0 +1,241 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Vehicle unit test for the columnar output database and its reader.
+//
+// Output frames with constant, slowly varying, arbitrary (random bit pattern),
+// and special (NaN, signed zero, denormal, infinite) values are written with a
+// number of frames that is not a multiple of the block size. All channels must
+// be read back with identical bit patterns. Truncated and corrupted files must
+// be rejected.
+// =============================================================================
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChException.h"
+#include "chrono/physics/ChShaft.h"
+
+#include "chrono_vehicle/output/ChVehicleOutputColumnar.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const int block_size = 64;
+const int num_frames = 3 * block_size + 17;  // partial final block
+const double time_step = 1e-3;
+
+const std::string filename = "utest_VEH_output_columnar.chcol";
+
+uint64_t Bits(double val) {
+    uint64_t bits;
+    std::memcpy(&bits, &val, sizeof(double));
+    return bits;
+}
+
+double FromBits(uint64_t bits) {
+    double val;
+    std::memcpy(&val, &bits, sizeof(double));
+    return val;
+}
+
+// Expected channel values, indexed by channel name.
+class ExpectedValues {
+  public:
+    ExpectedValues() : m_rng(42) {
+        m_special = {std::numeric_limits<double>::quiet_NaN(),
+                     -std::numeric_limits<double>::quiet_NaN(),
+                     FromBits(0x7ff0000000000123ULL | 0x0008000000000000ULL),  // NaN with payload
+                     0.0,
+                     -0.0,
+                     std::numeric_limits<double>::denorm_min(),
+                     -std::numeric_limits<double>::denorm_min(),
+                     FromBits(0x000fffffffffffffULL),  // largest denormal
+                     std::numeric_limits<double>::min(),
+                     std::numeric_limits<double>::max(),
+                     std::numeric_limits<double>::lowest(),
+                     std::numeric_limits<double>::infinity(),
+                     -std::numeric_limits<double>::infinity()};
+    }
+
+    // Set the shaft states for the given frame and record the expected values.
+    void SetFrame(int k, std::vector<std::shared_ptr<ChShaft>>& shafts) {
+        Set(shafts[0], "Test/shaft/constant/", 3.25, 0.0, -0.0, 1e300);
+        Set(shafts[1], "Test/shaft/slow/", 1 + 1e-3 * std::sin(0.01 * k), k * time_step, std::cos(0.02 * k),
+            100.0 + 0.5 * k);
+        Set(shafts[2], "Test/shaft/special/", m_special[k % m_special.size()],
+            m_special[(k + 5) % m_special.size()], m_special[(3 * k) % m_special.size()],
+            m_special[(7 * k + 1) % m_special.size()]);
+        Set(shafts[3], "Test/shaft/random/", FromBits(m_rng()), FromBits(m_rng()), FromBits(m_rng()),
+            FromBits(m_rng()));
+
+        // The last shaft is only present in some frames (starting after the first frame)
+        if (k % 3 == 1)
+            Set(shafts[4], "Test/shaft/sparse/", 0.1 * k, -0.1 * k, 0.0, FromBits(m_rng()));
+        else
+            Set(nullptr, "Test/shaft/sparse/", 0, 0, 0, 0);
+    }
+
+    std::map<std::string, std::vector<double>> m_values;
+
+  private:
+    void Set(std::shared_ptr<ChShaft> shaft,
+             const std::string& prefix,
+             double pos,
+             double vel,
+             double acc,
+             double torque) {
+        const double missing = std::numeric_limits<double>::quiet_NaN();
+        if (shaft) {
+            shaft->SetPos(pos);
+            shaft->SetPos_dt(vel);
+            shaft->SetPos_dtdt(acc);
+            shaft->SetAppliedTorque(torque);
+        }
+        m_values[prefix + "pos"].push_back(shaft ? pos : missing);
+        m_values[prefix + "vel"].push_back(shaft ? vel : missing);
+        m_values[prefix + "acc"].push_back(shaft ? acc : missing);
+        m_values[prefix + "torque"].push_back(shaft ? torque : missing);
+    }
+
+    std::mt19937_64 m_rng;
+    std::vector<double> m_special;
+};
+
+class ColumnarOutputTest : public ::testing::Test {
+  protected:
+    virtual void SetUp() override {
+        std::vector<std::shared_ptr<ChShaft>> shafts;
+        std::vector<std::string> names = {"constant", "slow", "special", "random", "sparse"};
+        for (const auto& name : names) {
+            auto shaft = chrono_types::make_shared<ChShaft>();
+            shaft->SetName(name.c_str());
+            shafts.push_back(shaft);
+        }
+
+        // The index is written when the database is destroyed
+        {
+            std::unique_ptr<ChVehicleOutput> out(new ChVehicleOutputColumnar(filename, block_size));
+            for (int k = 0; k < num_frames; k++) {
+                m_expected.SetFrame(k, shafts);
+                out->WriteTime(k, k * time_step);
+                out->WriteSection("Test");
+                if (k % 3 == 1)
+                    out->WriteShafts(shafts);
+                else
+                    out->WriteShafts({shafts[0], shafts[1], shafts[2], shafts[3]});
+            }
+        }
+
+        std::ifstream ifs(filename, std::ios_base::binary);
+        m_contents.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+
+    virtual void TearDown() override { std::remove(filename.c_str()); }
+
+    // Write a modified copy of the output file.
+    void WriteCopy(const std::string& copy, const std::string& contents) {
+        std::ofstream ofs(copy, std::ios_base::binary);
+        ofs.write(contents.data(), contents.size());
+    }
+
+    ExpectedValues m_expected;
+    std::string m_contents;
+};
+
+TEST_F(ColumnarOutputTest, round_trip) {
+    ChVehicleOutputColumnarReader reader(filename);
+
+    ASSERT_EQ(reader.GetNumFrames(), num_frames);
+    ASSERT_EQ(reader.GetStartTime(), 0.0);
+    ASSERT_EQ(reader.GetEndTime(), (num_frames - 1) * time_step);
+    ASSERT_EQ(reader.GetChannelNames().size(), m_expected.m_values.size());
+
+    std::vector<double> time;
+    std::vector<double> values;
+    ASSERT_FALSE(reader.Read("Test/shaft/none/pos", 0, 1, time, values));
+
+    for (const auto& channel : m_expected.m_values) {
+        const auto& expected = channel.second;
+        ASSERT_TRUE(reader.Read(channel.first, 0, 1, time, values)) << channel.first;
+        ASSERT_EQ(time.size(), (size_t)num_frames) << channel.first;
+        ASSERT_EQ(values.size(), (size_t)num_frames) << channel.first;
+        for (int k = 0; k < num_frames; k++) {
+            ASSERT_EQ(time[k], k * time_step) << channel.first << " frame " << k;
+            if (std::isnan(expected[k]) && channel.first.find("sparse") != std::string::npos)
+                ASSERT_TRUE(std::isnan(values[k])) << channel.first << " frame " << k;
+            else
+                ASSERT_EQ(Bits(values[k]), Bits(expected[k])) << channel.first << " frame " << k;
+        }
+    }
+
+    // A time window that spans a block boundary and ends in the partial final block
+    int first = block_size - 5;
+    int last = 3 * block_size + 3;
+    ASSERT_TRUE(reader.Read("Test/shaft/random/torque", first * time_step, last * time_step, time, values));
+    ASSERT_EQ(values.size(), (size_t)(last - first + 1));
+    const auto& expected = m_expected.m_values["Test/shaft/random/torque"];
+    for (int k = first; k <= last; k++) {
+        ASSERT_EQ(time[k - first], k * time_step);
+        ASSERT_EQ(Bits(values[k - first]), Bits(expected[k]));
+    }
+}
+
+TEST_F(ColumnarOutputTest, truncated) {
+    const std::string copy = "utest_VEH_output_columnar_truncated.chcol";
+    for (size_t size : {m_contents.size() - 1, m_contents.size() / 2, (size_t)20, (size_t)0}) {
+        WriteCopy(copy, m_contents.substr(0, size));
+        EXPECT_THROW(ChVehicleOutputColumnarReader reader(copy), ChException) << "size " << size;
+    }
+    std::remove(copy.c_str());
+}
+
+TEST_F(ColumnarOutputTest, corrupted) {
+    const std::string copy = "utest_VEH_output_columnar_corrupted.chcol";
+    std::vector<double> time;
+    std::vector<double> values;
+
+    // Corrupted data chunk (the first chunk, with the output times of the first block, follows the 16-byte header)
+    auto contents = m_contents;
+    contents[20] ^= 0x10;
+    WriteCopy(copy, contents);
+    {
+        ChVehicleOutputColumnarReader reader(copy);
+        EXPECT_THROW(reader.Read("Test/shaft/slow/pos", 0, 1, time, values), ChException);
+    }
+
+    // Corrupted index (located before the 20-byte trailer)
+    contents = m_contents;
+    contents[contents.size() - 40] ^= 0x01;
+    WriteCopy(copy, contents);
+    EXPECT_THROW(ChVehicleOutputColumnarReader reader(copy), ChException);
+
+    // Corrupted index offset in the trailer
+    contents = m_contents;
+    contents[contents.size() - 20] ^= 0x04;
+    WriteCopy(copy, contents);
+    EXPECT_THROW(ChVehicleOutputColumnarReader reader(copy), ChException);
+
+    std::remove(copy.c_str());
+}
@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Vehicle unit test for the Pac02 combined-slip force calculation
+// (use mode 4, without friction ellipsis).
+//
+// The aligning moment in combined slip depends on the lateral magic formula
+// coefficients of the current step. The tire forces and moments must therefore
+// not depend on any values left over in the tire object: two tires whose
+// coefficients are overwritten with different values before each step must
+// produce identical (and finite) forces and moments.
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChBody.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/Pac02Tire.h"
+#include "chrono_vehicle/wheeled_vehicle/wheel/Wheel.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Pac02 tire in combined-slip mode, with access to the lateral magic formula coefficients.
+class CombinedSlipTire : public Pac02Tire {
+  public:
+    CombinedSlipTire(const std::string& filename) : Pac02Tire(filename) {
+        m_use_mode = 4;
+        m_use_friction_ellipsis = false;
+        // The HMMWV data set does not specify qbz10, which scales the contribution of By * Cy to the residual moment
+        m_PacCoeff.qbz10 = 0.5;
+    }
+
+    void OverwriteCoefficients(double val) {
+        m_By = val;
+        m_Cy = val;
+        m_Shf = val;
+    }
+};
+
+struct TireSetup {
+    TireSetup() {
+        spindle = chrono_types::make_shared<ChBody>();
+        wheel = chrono_types::make_shared<Wheel>(GetDataFile("hmmwv/wheel/HMMWV_Wheel.json"));
+        tire = chrono_types::make_shared<CombinedSlipTire>(GetDataFile("hmmwv/tire/HMMWV_Pac02Tire.json"));
+        wheel->Initialize(spindle, LEFT);
+        wheel->SetTire(tire);
+        std::static_pointer_cast<ChTire>(tire)->Initialize(wheel);
+    }
+
+    void SetState(const ChVector<>& pos, const ChVector<>& vel, double omega) {
+        spindle->SetPos(pos);
+        spindle->SetPos_dt(vel);
+        spindle->SetWvel_par(ChVector<>(0, omega, 0));
+    }
+
+    TerrainForce Advance(double time, ChTerrain& terrain, double step) {
+        ChTire* base = tire.get();
+        base->Synchronize(time, terrain);
+        base->Advance(step);
+        return base->ReportTireForce(&terrain);
+    }
+
+    std::shared_ptr<ChBody> spindle;
+    std::shared_ptr<Wheel> wheel;
+    std::shared_ptr<CombinedSlipTire> tire;
+};
+
+TEST(ChPac02Tire, combined_slip) {
+    FlatTerrain terrain(0, 0.8f);
+
+    TireSetup tire1;
+    TireSetup tire2;
+
+    int num_contacts = 0;
+    for (int i = 0; i < 50; i++) {
+        // Sweep through combinations of longitudinal and lateral slip at different loads
+        ChVector<> pos(0, 0, 0.43 + 0.0005 * (i % 10));
+        ChVector<> vel(10.0, 0.4 * std::sin(0.3 * i), 0);
+        double omega = -(10.0 / 0.46) * (1 + 0.02 * (i % 7 - 3));
+
+        tire1.SetState(pos, vel, omega);
+        tire2.SetState(pos, vel, omega);
+
+        tire1.tire->OverwriteCoefficients(0.0);
+        tire2.tire->OverwriteCoefficients(1.0e3);
+
+        auto frc1 = tire1.Advance(0.01 * i, terrain, 0.01);
+        auto frc2 = tire2.Advance(0.01 * i, terrain, 0.01);
+        if (frc1.force.z() > 0)
+            num_contacts++;
+
+        for (int j = 0; j < 3; j++) {
+            ASSERT_TRUE(std::isfinite(frc1.force[j])) << "step " << i;
+            ASSERT_TRUE(std::isfinite(frc1.moment[j])) << "step " << i;
+        }
+        ASSERT_EQ(frc1.force, frc2.force) << "step " << i;
+        ASSERT_EQ(frc1.moment, frc2.moment) << "step " << i;
+    }
+
+    ASSERT_GT(num_contacts, 0);
+}
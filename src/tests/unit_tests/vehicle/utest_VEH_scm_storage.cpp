@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Vehicle unit test for the storage of modified SCM grid nodes.
+//
+// A rigid wheel rolls over SCM terrain (with bulldozing), across the boundary
+// between grid tiles with negative and positive node indices. The same run is
+// performed with the hash map and the tiled node storage. Wheel states, contact
+// forces, modified node heights, and sinkage must be identical.
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const int num_steps = 500;
+const double step_size = 1e-3;
+
+class SCMRun {
+  public:
+    SCMRun(SCMDeformableTerrain::GridStorage storage) : m_terrain(&m_sys, false) {
+        m_sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+        m_wheel = chrono_types::make_shared<ChBodyEasyCylinder>(0.5, 0.3, 500, false, true, mat);
+        m_wheel->SetPos(ChVector<>(-0.3, 0.1, 0.5));
+        m_wheel->SetPos_dt(ChVector<>(2, 0, 0));
+        m_wheel->SetWvel_par(ChVector<>(0, 3, 0));
+        m_sys.AddBody(m_wheel);
+
+        m_terrain.SetGridStorage(storage);
+        m_terrain.SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+        m_terrain.EnableBulldozing(true);
+        m_terrain.SetBulldozingParameters(55, 1, 5, 10);
+        m_terrain.AddMovingPatch(m_wheel, VNULL, ChVector<>(1.2, 0.5, 1.2));
+        m_terrain.Initialize(8, 3, 0.04);
+    }
+
+    void Advance() { m_sys.DoStepDynamics(step_size); }
+
+    // Return the modified nodes, sorted by grid location.
+    std::vector<SCMDeformableTerrain::NodeLevel> GetModifiedNodes(bool all_nodes) const {
+        auto nodes = m_terrain.GetModifiedNodes(all_nodes);
+        std::sort(nodes.begin(), nodes.end(),
+                  [](const SCMDeformableTerrain::NodeLevel& a, const SCMDeformableTerrain::NodeLevel& b) {
+                      return a.first.x() < b.first.x() || (a.first.x() == b.first.x() && a.first.y() < b.first.y());
+                  });
+        return nodes;
+    }
+
+    ChSystemSMC m_sys;
+    SCMDeformableTerrain m_terrain;
+    std::shared_ptr<ChBody> m_wheel;
+};
+
+void CheckEqual(const std::vector<SCMDeformableTerrain::NodeLevel>& a,
+                const std::vector<SCMDeformableTerrain::NodeLevel>& b,
+                int step) {
+    ASSERT_EQ(a.size(), b.size()) << "step " << step;
+    for (size_t i = 0; i < a.size(); i++) {
+        const auto& ij = a[i].first;
+        ASSERT_TRUE(ij == b[i].first) << "step " << step << " node " << ij.x() << " " << ij.y();
+        ASSERT_EQ(a[i].second, b[i].second) << "step " << step << " node " << ij.x() << " " << ij.y();
+    }
+}
+
+TEST(SCMDeformableTerrain, grid_storage) {
+    SCMRun hash(SCMDeformableTerrain::GridStorage::HASH_MAP);
+    SCMRun tiled(SCMDeformableTerrain::GridStorage::TILED);
+
+    for (int step = 0; step < num_steps; step++) {
+        hash.Advance();
+        tiled.Advance();
+
+        ASSERT_EQ(hash.m_wheel->GetPos(), tiled.m_wheel->GetPos()) << "step " << step;
+        ASSERT_EQ(hash.m_wheel->GetRot(), tiled.m_wheel->GetRot()) << "step " << step;
+        ASSERT_EQ(hash.m_wheel->GetPos_dt(), tiled.m_wheel->GetPos_dt()) << "step " << step;
+
+        auto frc_hash = hash.m_terrain.GetContactForce(hash.m_wheel);
+        auto frc_tiled = tiled.m_terrain.GetContactForce(tiled.m_wheel);
+        ASSERT_EQ(frc_hash.force, frc_tiled.force) << "step " << step;
+        ASSERT_EQ(frc_hash.moment, frc_tiled.moment) << "step " << step;
+
+        CheckEqual(hash.GetModifiedNodes(false), tiled.GetModifiedNodes(false), step);
+    }
+
+    // The wheel must have sunk into the terrain and crossed into positive grid coordinates
+    ASSERT_GT(hash.m_wheel->GetPos().x(), 0.2);
+    ASSERT_LT(hash.m_wheel->GetPos().z(), 0.5);
+
+    auto nodes = hash.GetModifiedNodes(true);
+    ASSERT_GT(nodes.size(), 0u);
+    ASSERT_EQ((int)nodes.size(), hash.m_terrain.GetNumModifiedNodes());
+    ASSERT_EQ((int)nodes.size(), tiled.m_terrain.GetNumModifiedNodes());
+    CheckEqual(nodes, tiled.GetModifiedNodes(true), num_steps);
+
+    // Sinkage along the wheel track
+    double max_sinkage = 0;
+    for (int i = 0; i <= 100; i++) {
+        ChVector<> loc(-0.4 + 0.01 * i, 0.1, 0);
+        auto info_hash = hash.m_terrain.GetNodeInfo(loc);
+        auto info_tiled = tiled.m_terrain.GetNodeInfo(loc);
+        ASSERT_EQ(info_hash.sinkage, info_tiled.sinkage) << "at " << loc;
+        ASSERT_EQ(info_hash.sinkage_plastic, info_tiled.sinkage_plastic) << "at " << loc;
+        ASSERT_EQ(info_hash.sigma, info_tiled.sigma) << "at " << loc;
+        ASSERT_EQ(hash.m_terrain.GetHeight(loc), tiled.m_terrain.GetHeight(loc)) << "at " << loc;
+        max_sinkage = std::max(max_sinkage, info_hash.sinkage);
+    }
+    ASSERT_GT(max_sinkage, 0.0);
+}
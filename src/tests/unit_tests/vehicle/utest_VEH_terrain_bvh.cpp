@@ -0,0 +1,147 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Vehicle unit test for the terrain mesh BVH.
+//
+// The mesh consists of a wavy surface, an elevated overlapping patch, and a
+// vertical wall, placed with a general frame. Height and normal queries at
+// random locations (inside and outside the mesh footprint) are compared against
+// a brute-force vertical ray cast over all mesh triangles.
+// =============================================================================
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_vehicle/terrain/ChTerrainMeshBVH.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+using namespace chrono::vehicle;
+
+const int num_queries = 20000;
+
+// Add a structured grid of triangles over [x0,x1]x[y0,y1], with heights given by the specified function.
+template <typename F>
+void AddGrid(ChTriangleMeshConnected& mesh, double x0, double x1, double y0, double y1, int n, F height) {
+    int offset = (int)mesh.m_vertices.size();
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            double x = x0 + (x1 - x0) * i / n;
+            double y = y0 + (y1 - y0) * j / n;
+            mesh.m_vertices.push_back(ChVector<>(x, y, height(x, y)));
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int v0 = offset + i * (n + 1) + j;
+            int v1 = v0 + (n + 1);
+            mesh.m_face_v_indices.push_back(ChVector<int>(v0, v1, v1 + 1));
+            mesh.m_face_v_indices.push_back(ChVector<int>(v0, v1 + 1, v0 + 1));
+        }
+    }
+}
+
+// Brute-force vertical ray cast (from above) against all mesh triangles, expressed in the world frame.
+// Return the highest intersection, with the upward normal of the intersected triangle.
+bool RayCast(const std::vector<ChVector<>>& verts,
+             const std::vector<ChVector<int>>& faces,
+             double x,
+             double y,
+             double& height,
+             ChVector<>& normal) {
+    const ChVector<> orig(x, y, 1e3);
+    const ChVector<> dir(0, 0, -1);
+    bool hit = false;
+    for (const auto& face : faces) {
+        const auto& p0 = verts[face[0]];
+        const auto& p1 = verts[face[1]];
+        const auto& p2 = verts[face[2]];
+        ChVector<> e1 = p1 - p0;
+        ChVector<> e2 = p2 - p0;
+        ChVector<> pv = Vcross(dir, e2);
+        double det = Vdot(e1, pv);
+        if (std::abs(det) < 1e-14)
+            continue;
+        ChVector<> tv = orig - p0;
+        double u = Vdot(tv, pv) / det;
+        if (u < 0 || u > 1)
+            continue;
+        ChVector<> qv = Vcross(tv, e1);
+        double v = Vdot(dir, qv) / det;
+        if (v < 0 || u + v > 1)
+            continue;
+        double t = Vdot(e2, qv) / det;
+        double z = orig.z() - t;
+        if (!hit || z > height) {
+            hit = true;
+            height = z;
+            normal = Vcross(e1, e2).GetNormalized();
+            if (normal.z() < 0)
+                normal = -normal;
+        }
+    }
+    return hit;
+}
+
+TEST(ChTerrainMeshBVH, brute_force) {
+    ChTriangleMeshConnected mesh;
+    AddGrid(mesh, -5, 5, -5, 5, 40, [](double x, double y) { return 0.3 * std::sin(x) * std::cos(1.3 * y); });
+    AddGrid(mesh, -1, 1.5, -4, 3, 7, [](double x, double y) { return 2 + 0.1 * x - 0.05 * y; });
+
+    // A vertical wall (degenerate in the horizontal projection)
+    int n = (int)mesh.m_vertices.size();
+    mesh.m_vertices.push_back(ChVector<>(3, -2, 0));
+    mesh.m_vertices.push_back(ChVector<>(3, 2, 0));
+    mesh.m_vertices.push_back(ChVector<>(3, 0, 4));
+    mesh.m_face_v_indices.push_back(ChVector<int>(n, n + 1, n + 2));
+
+    ChFrame<> frame(ChVector<>(1.5, -0.5, 0.25), Q_from_AngZ(0.4));
+    ChTerrainMeshBVH bvh(mesh, frame);
+    ASSERT_EQ(bvh.GetNumTriangles(), mesh.m_face_v_indices.size() - 1);
+
+    std::vector<ChVector<>> verts;
+    for (const auto& v : mesh.m_vertices)
+        verts.push_back(frame.TransformPointLocalToParent(v));
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(-8.0, 8.0);
+    int num_hits = 0;
+    int num_upper = 0;
+    for (int k = 0; k < num_queries; k++) {
+        double x = dist(rng);
+        double y = dist(rng);
+
+        double h_ref, h;
+        ChVector<> n_ref, nrm;
+        bool hit_ref = RayCast(verts, mesh.m_face_v_indices, x, y, h_ref, n_ref);
+        bool hit = bvh.FindPoint(ChVector<>(x, y, dist(rng)), h, nrm);
+
+        ASSERT_EQ(hit, hit_ref) << "query " << k << " at (" << x << ", " << y << ")";
+        if (!hit)
+            continue;
+        num_hits++;
+        if (h > 1)
+            num_upper++;
+        ASSERT_NEAR(h, h_ref, 1e-10) << "query " << k << " at (" << x << ", " << y << ")";
+        ASSERT_NEAR((nrm - n_ref).Length(), 0.0, 1e-10) << "query " << k << " at (" << x << ", " << y << ")";
+    }
+
+    // Queries must have hit both the lower surface and the elevated patch, and missed the mesh
+    ASSERT_GT(num_hits, num_queries / 4);
+    ASSERT_LT(num_hits, num_queries);
+    ASSERT_GT(num_upper, 0);
+}
@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Vehicle unit test for the RigidTerrain query functions.
+//
+// The terrain consists of a tilted box patch, a height-map patch aligned with
+// the world vertical (queried on its height grid), a tilted height-map patch
+// (queried through its mesh hierarchy), and a mesh patch. Batched and
+// single-point GetProperties results must match the scalar GetHeight,
+// GetNormal, and GetCoefficientFriction queries at random locations. Grid
+// queries on a height-map patch must match queries on the same mesh loaded as
+// a mesh patch.
+// =============================================================================
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const int num_queries = 5000;
+
+// Create a contact material with the given friction coefficient (used to identify the patch hit by a query).
+std::shared_ptr<ChMaterialSurface> CreateMaterial(float friction) {
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(friction);
+    return mat;
+}
+
+TEST(RigidTerrain, batched_queries) {
+    ChSystemNSC sys;
+    const float frictions[4] = {0.5f, 0.6f, 0.7f, 0.9f};
+
+    RigidTerrain terrain(&sys);
+    terrain.AddPatch(CreateMaterial(frictions[0]), ChCoordsys<>(ChVector<>(0, 30, 0), Q_from_AngX(0.05)), 20, 20);
+    terrain.AddPatch(CreateMaterial(frictions[1]), ChCoordsys<>(ChVector<>(0, 0, 0.1), QUNIT),
+                     GetDataFile("terrain/height_maps/bump64.bmp"), 20, 20, 0, 1);
+    terrain.AddPatch(CreateMaterial(frictions[2]), ChCoordsys<>(ChVector<>(30, 0, 0), Q_from_AngY(0.1)),
+                     GetDataFile("terrain/height_maps/test64.bmp"), 20, 20, 0, 2);
+    terrain.AddPatch(CreateMaterial(frictions[3]), ChCoordsys<>(ChVector<>(75, 75, 0), QUNIT),
+                     GetDataFile("terrain/meshes/bump.obj"));
+    terrain.Initialize();
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist_xy(-15.0, 75.0);
+    std::uniform_real_distribution<double> dist_z(-1.0, 3.0);
+    std::vector<ChVector<>> loc(num_queries);
+    for (auto& p : loc)
+        p = ChVector<>(dist_xy(rng), dist_xy(rng), dist_z(rng));
+
+    std::vector<double> height;
+    std::vector<ChVector<>> normal;
+    std::vector<float> friction;
+    terrain.GetProperties(loc, height, normal, friction);
+    ASSERT_EQ(height.size(), loc.size());
+    ASSERT_EQ(normal.size(), loc.size());
+    ASSERT_EQ(friction.size(), loc.size());
+
+    int num_hits[4] = {0, 0, 0, 0};
+    for (int k = 0; k < num_queries; k++) {
+        double h = terrain.GetHeight(loc[k]);
+        ChVector<> n = terrain.GetNormal(loc[k]);
+        float mu = terrain.GetCoefficientFriction(loc[k]);
+        ASSERT_EQ(height[k], h) << "query " << k << " at " << loc[k];
+        ASSERT_EQ(normal[k], n) << "query " << k << " at " << loc[k];
+        ASSERT_EQ(friction[k], mu) << "query " << k << " at " << loc[k];
+
+        double h1;
+        ChVector<> n1;
+        float mu1;
+        terrain.GetProperties(loc[k], h1, n1, mu1);
+        ASSERT_EQ(h1, h) << "query " << k << " at " << loc[k];
+        ASSERT_EQ(n1, n) << "query " << k << " at " << loc[k];
+        ASSERT_EQ(mu1, mu) << "query " << k << " at " << loc[k];
+
+        double h2;
+        ChVector<> n2;
+        float mu2;
+        if (terrain.FindPoint(loc[k], h2, n2, mu2)) {
+            for (int i = 0; i < 4; i++)
+                num_hits[i] += (mu2 == frictions[i]);
+        }
+    }
+
+    // Queries must have hit all patches
+    for (int i = 0; i < 4; i++)
+        ASSERT_GT(num_hits[i], num_queries / 50) << "patch " << i;
+}
+
+TEST(RigidTerrain, height_map_grid) {
+    // The exported mesh is written with 6 significant digits; with a grid spacing of 1, the grid coordinates are
+    // represented exactly and heights are rounded to about 1e-6.
+    ChSystemNSC sys;
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    ChCoordsys<> pos(ChVector<>(1, -2, 0.5), Q_from_AngZ(0.3));
+
+    RigidTerrain terrain(&sys);
+    terrain.AddPatch(mat, pos, GetDataFile("terrain/height_maps/bump64.bmp"), 63, 63, 0, 2.55);
+    terrain.Initialize();
+    terrain.ExportMeshWavefront(".");
+
+    RigidTerrain terrain_ref(&sys);
+    terrain_ref.AddPatch(mat, pos, "bump64.obj");
+    terrain_ref.Initialize();
+    std::remove("bump64.obj");
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(-40.0, 40.0);
+    int num_hits = 0;
+    for (int k = 0; k < num_queries; k++) {
+        ChVector<> loc(dist(rng), dist(rng), 0);
+
+        double h, h_ref;
+        ChVector<> n, n_ref;
+        float mu, mu_ref;
+        bool hit = terrain.FindPoint(loc, h, n, mu);
+        bool hit_ref = terrain_ref.FindPoint(loc, h_ref, n_ref, mu_ref);
+
+        ASSERT_EQ(hit, hit_ref) << "query " << k << " at " << loc;
+        if (!hit)
+            continue;
+        num_hits++;
+        ASSERT_NEAR(h, h_ref, 1e-5) << "query " << k << " at " << loc;
+        ASSERT_NEAR((n - n_ref).Length(), 0.0, 1e-4) << "query " << k << " at " << loc;
+    }
+
+    ASSERT_GT(num_hits, num_queries / 4);
+}
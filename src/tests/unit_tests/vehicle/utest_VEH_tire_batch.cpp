@@ -0,0 +1,214 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Vehicle unit test for the batched advance of force-element tires.
+//
+// Two identical sets of tires (TMeasy, Pac02 in all force modes, and Fiala,
+// which is not batched) are driven through the same sequence of wheel states.
+// One set is advanced tire by tire, the other through ChTireBatch. The tire
+// forces and moments must match at every step.
+//
+// A second test simulates several vehicles in a single system, with all their
+// tires registered with one shared tire batch, and compares the results with
+// those obtained when each vehicle advances its own tires.
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTireBatch.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/FialaTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/Pac02Tire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/TMeasyTire.h"
+#include "chrono_vehicle/wheeled_vehicle/vehicle/WheeledVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/wheel/Wheel.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const int num_tires = 10;
+const int num_steps = 200;
+const double step_size = 1e-3;
+
+// Create a tire of the given kind: TMeasy, Pac02 (pure slip, combined slip with and without friction ellipsis),
+// or Fiala.
+std::shared_ptr<ChTire> CreateTire(int kind) {
+    switch (kind % 5) {
+        case 0:
+            return chrono_types::make_shared<TMeasyTire>(GetDataFile("hmmwv/tire/HMMWV_TMeasyTire.json"));
+        case 4:
+            return chrono_types::make_shared<FialaTire>(GetDataFile("hmmwv/tire/HMMWV_FialaTire.json"));
+        default: {
+            rapidjson::Document d;
+            ReadFileJSON(GetDataFile("hmmwv/tire/HMMWV_Pac02Tire.json"), d);
+            d["Use Mode"].SetInt(kind % 5 == 1 ? 3 : 4);
+            d.AddMember("Use Friction Ellipsis", kind % 5 == 2, d.GetAllocator());
+            return chrono_types::make_shared<Pac02Tire>(d);
+        }
+    }
+}
+
+class TireSet {
+  public:
+    TireSet() {
+        for (int i = 0; i < num_tires; i++) {
+            auto spindle = chrono_types::make_shared<ChBody>();
+            auto wheel = chrono_types::make_shared<Wheel>(GetDataFile("hmmwv/wheel/HMMWV_Wheel.json"));
+            auto tire = CreateTire(i);
+            wheel->Initialize(spindle, i % 2 == 0 ? LEFT : RIGHT);
+            wheel->SetTire(tire);
+            tire->Initialize(wheel);
+            m_spindles.push_back(spindle);
+            m_wheels.push_back(wheel);
+            m_tires.push_back(tire);
+            m_tire_ptrs.push_back(tire.get());
+        }
+    }
+
+    // Set the spindle states at the given step (each tire runs with a different load and slip history).
+    void SetStates(int step) {
+        double t = step * step_size;
+        for (int i = 0; i < num_tires; i++) {
+            double phase = 0.7 * i;
+            ChVector<> pos(0, 0, 0.43 + 0.01 * std::sin(20 * t + phase));
+            ChVector<> vel(5.0 + i, 0.5 * std::sin(10 * t + phase), 0.1 * std::cos(20 * t + phase));
+            double omega = -(vel.x() / 0.46) * (1 + 0.1 * std::sin(15 * t + phase));
+            m_spindles[i]->SetPos(pos);
+            m_spindles[i]->SetRot(Q_from_AngZ(0.02 * std::sin(5 * t + phase)));
+            m_spindles[i]->SetPos_dt(vel);
+            m_spindles[i]->SetWvel_par(ChVector<>(0, omega, 0));
+        }
+    }
+
+    void Synchronize(double time, const ChTerrain& terrain) {
+        for (auto& tire : m_tires)
+            tire->Synchronize(time, terrain);
+    }
+
+    std::vector<std::shared_ptr<ChBody>> m_spindles;
+    std::vector<std::shared_ptr<Wheel>> m_wheels;
+    std::vector<std::shared_ptr<ChTire>> m_tires;
+    std::vector<ChTire*> m_tire_ptrs;
+};
+
+void CheckEqual(const ChVector<>& a, const ChVector<>& b, int step, int tire) {
+    for (int j = 0; j < 3; j++) {
+        ASSERT_TRUE(std::isfinite(a[j])) << "step " << step << " tire " << tire;
+        ASSERT_NEAR(a[j], b[j], 1e-9 * (1 + std::abs(a[j]))) << "step " << step << " tire " << tire;
+    }
+}
+
+TEST(ChTireBatch, advance) {
+    FlatTerrain terrain(0, 0.8f);
+
+    TireSet ref;
+    TireSet batched;
+    ChTireBatch batch;
+
+    int num_contacts = 0;
+    for (int step = 0; step < num_steps; step++) {
+        double time = step * step_size;
+
+        ref.SetStates(step);
+        ref.Synchronize(time, terrain);
+        for (auto tire : ref.m_tire_ptrs)
+            tire->Advance(step_size);
+
+        batched.SetStates(step);
+        batched.Synchronize(time, terrain);
+        batch.Advance(batched.m_tire_ptrs, step_size);
+
+        for (int i = 0; i < num_tires; i++) {
+            auto frc_ref = ref.m_tires[i]->ReportTireForce(&terrain);
+            auto frc_batch = batched.m_tires[i]->ReportTireForce(&terrain);
+            if (frc_ref.force.z() > 0)
+                num_contacts++;
+            CheckEqual(frc_ref.force, frc_batch.force, step, i);
+            CheckEqual(frc_ref.moment, frc_batch.moment, step, i);
+            CheckEqual(frc_ref.point, frc_batch.point, step, i);
+        }
+    }
+
+    ASSERT_GT(num_contacts, num_steps * num_tires / 2);
+}
+
+// Create a system with several vehicles (with TMeasy, Pac02, and Fiala tires). If a tire batch is provided, the
+// tires of all vehicles are registered with it.
+void CreateVehicles(ChSystemNSC& sys, std::vector<std::shared_ptr<WheeledVehicle>>& vehicles, ChTireBatch* batch) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    for (int k = 0; k < 3; k++) {
+        auto vehicle = chrono_types::make_shared<WheeledVehicle>(
+            &sys, GetDataFile("hmmwv/vehicle/HMMWV_Vehicle.json"), false, false);
+        vehicle->Initialize(ChCoordsys<>(ChVector<>(0, 10.0 * k, 0.5), QUNIT), 5.0 + k);
+        int kind = 0;
+        for (auto& axle : vehicle->GetAxles()) {
+            for (auto& wheel : axle->GetWheels()) {
+                vehicle->InitializeTire(CreateTire(k + kind), wheel, VisualizationType::NONE);
+                kind += 2;
+            }
+        }
+        if (batch)
+            vehicle->RegisterTires(*batch);
+        vehicles.push_back(vehicle);
+    }
+}
+
+TEST(ChTireBatch, vehicles) {
+    FlatTerrain terrain(0, 0.8f);
+    DriverInputs inputs = {0.1, 0.0, 0.0};
+
+    ChSystemNSC sys_ref;
+    std::vector<std::shared_ptr<WheeledVehicle>> vehicles_ref;
+    CreateVehicles(sys_ref, vehicles_ref, nullptr);
+
+    ChSystemNSC sys_batch;
+    std::vector<std::shared_ptr<WheeledVehicle>> vehicles_batch;
+    ChTireBatch batch;
+    CreateVehicles(sys_batch, vehicles_batch, &batch);
+
+    ASSERT_EQ(batch.GetNumTires(), 3u * 4u);
+    for (const auto& vehicle : vehicles_batch)
+        ASSERT_FALSE(vehicle->IsTireAdvanceEnabled());
+
+    for (int step = 0; step < num_steps; step++) {
+        double time = sys_ref.GetChTime();
+
+        for (auto& vehicle : vehicles_ref)
+            vehicle->Synchronize(time, inputs, terrain);
+        for (auto& vehicle : vehicles_ref)
+            vehicle->Advance(step_size);
+        sys_ref.DoStepDynamics(step_size);
+
+        // All tires are advanced once, in a single batch
+        for (auto& vehicle : vehicles_batch)
+            vehicle->Synchronize(time, inputs, terrain);
+        batch.Advance(step_size);
+        for (auto& vehicle : vehicles_batch)
+            vehicle->Advance(step_size);
+        sys_batch.DoStepDynamics(step_size);
+
+        for (size_t k = 0; k < vehicles_ref.size(); k++)
+            CheckEqual(vehicles_ref[k]->GetPos(), vehicles_batch[k]->GetPos(), step, (int)k);
+    }
+
+    // The vehicles must have moved
+    for (size_t k = 0; k < vehicles_ref.size(); k++)
+        ASSERT_GT(vehicles_ref[k]->GetPos().x(), 0.5);
+}